@@ -10,6 +10,7 @@
 #include "WoWModules/RiskFingerprintAuth.hpp"
 #include "WoWModules/ThumbprintAuth.hpp"
 #include "RealmList.h"
+#include "LogonCache.h"
 #include "AuthCodes.h"
 #include "Cryptography/HMACSHA1.h"
 #include "Cryptography/BigNumber.h"
@@ -329,12 +330,7 @@ namespace BNet2 {
         {
             std::string const & l_IPAddress = GetSocket().getRemoteAddress();
 
-            PreparedStatement* l_Stmt = LoginDatabase.GetPreparedStatement(LOGIN_SEL_IP_BANNED);
-            l_Stmt->setString(0, l_IPAddress);
-
-            PreparedQueryResult l_Result = LoginDatabase.Query(l_Stmt);
-
-            if (l_Result)
+            if (sLogonCache->IsIPBanned(l_IPAddress))
             {
                 SendAuthResult(BNet2::BATTLENET2_AUTH_ACCOUNT_TEMP_BANNED);
                 sLog->outDebug(LOG_FILTER_AUTHSERVER, "BNet2::Session::None_Handle_InformationRequest '%s:%d' Banned ip tries to login!", GetSocket().getRemoteAddress().c_str(), GetSocket().getRemotePort());
@@ -343,7 +339,7 @@ namespace BNet2 {
 
             std::string l_AccountName = p_Packet->ReadString(p_Packet->ReadBits<uint32_t>(9) + 3);
 
-            l_Stmt = LoginDatabase.GetPreparedStatement(LOGIN_SEL_LOGONCHALLENGE);
+            PreparedStatement* l_Stmt = LoginDatabase.GetPreparedStatement(LOGIN_SEL_LOGONCHALLENGE);
             l_Stmt->setString(0, l_AccountName);
 
             PreparedQueryResult l_Result_2 = LoginDatabase.Query(l_Stmt);
@@ -371,18 +367,10 @@ namespace BNet2 {
 
                 if (!l_Locked)
                 {
-                    //set expired bans to inactive
-                    LoginDatabase.Execute(LoginDatabase.GetPreparedStatement(LOGIN_UPD_EXPIRED_ACCOUNT_BANS));
-
                     // If the account is banned, reject the logon attempt
-                    l_Stmt = LoginDatabase.GetPreparedStatement(LOGIN_SEL_ACCOUNT_BANNED);
-                    l_Stmt->setUInt32(0, l_Fields[1].GetUInt32());
-
-                    PreparedQueryResult l_BanResult = LoginDatabase.Query(l_Stmt);
-
-                    if (l_BanResult)
+                    if (LogonCache::BanInfo const* l_Ban = sLogonCache->GetAccountBan(l_Fields[1].GetUInt32()))
                     {
-                        if ((*l_BanResult)[0].GetUInt32() == (*l_BanResult)[1].GetUInt32())
+                        if (l_Ban->IsPermanent())
                         {
                             SendAuthResult(BNet2::BATTLENET2_AUTH_ACCOUNT_TEMP_BANNED);
                             sLog->outDebug(LOG_FILTER_AUTHSERVER, "'%s:%d' BNet2::Session::None_Handle_InformationRequest Banned account %s tried to login!", GetSocket().getRemoteAddress().c_str(), GetSocket().getRemotePort(), l_AccountName.c_str());
@@ -34,6 +34,7 @@
 #include "Util.h"
 #include "SignalHandler.h"
 #include "RealmList.h"
+#include "LogonCache.h"
 #include "RealmAcceptor.h"
 #include "Bnet2/WoWModules/PasswordAuth.hpp"
 #include "Bnet2/WoWModules/RiskFingerprintAuth.hpp"
@@ -190,6 +191,9 @@ extern int main(int argc, char **argv)
         return 1;
     }
 
+    // Load the bans checked on logon
+    sLogonCache->Initialize(ConfigMgr::GetIntDefault("LogonCache.UpdateDelay", 10), ConfigMgr::GetIntDefault("LogonCache.FullReloadDelay", 300));
+
     // Launch the listening network socket
     RealmAcceptor acceptor;
 
@@ -273,6 +277,8 @@ extern int main(int argc, char **argv)
         if (ACE_Reactor::instance()->run_reactor_event_loop(interval) == -1)
             break;
 
+        sLogonCache->Update();
+
         if ((++loopCounter) == numLoops)
         {
             loopCounter = 0;
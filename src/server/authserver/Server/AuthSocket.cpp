@@ -25,6 +25,7 @@
 #include "Configuration/Config.h"
 #include "Log.h"
 #include "RealmList.h"
+#include "LogonCache.h"
 #include "AuthSocket.h"
 #include "AuthCodes.h"
 #include "TOTP.h"
@@ -196,7 +197,7 @@ Patcher PatchesCache;
 
 // Constructor - set the N and g values for SRP6
 AuthSocket::AuthSocket(RealmSocket& socket) :
-    pPatch(NULL), socket_(socket), _status(STATUS_CHALLENGE), _build(0)
+    pPatch(NULL), socket_(socket), _status(STATUS_CHALLENGE), _accountId(0), _build(0)
 {
     N.SetHexStr("894B645E89E1535BBDAD5B8B290650530801B18EBFBF5E8FAB3C82872A3E9BB7");
     g.SetDword(7);
@@ -367,13 +368,8 @@ bool AuthSocket::_HandleLogonChallenge()
     pkt << uint8(0x00);
 
     // Verify that this IP is not in the ip_banned table
-    LoginDatabase.Execute(LoginDatabase.GetPreparedStatement(LOGIN_DEL_EXPIRED_IP_BANS));
-
     const std::string& ip_address = socket().getRemoteAddress();
-    PreparedStatement *stmt = LoginDatabase.GetPreparedStatement(LOGIN_SEL_IP_BANNED);
-    stmt->setString(0, ip_address);
-    PreparedQueryResult result = LoginDatabase.Query(stmt);
-    if (result)
+    if (sLogonCache->IsIPBanned(ip_address))
     {
         pkt << (uint8)WOW_FAIL_BANNED;
         sLog->outDebug(LOG_FILTER_AUTHSERVER, "'%s:%d' [AuthChallenge] Banned ip tries to login!",socket().getRemoteAddress().c_str(), socket().getRemotePort());
@@ -382,7 +378,7 @@ bool AuthSocket::_HandleLogonChallenge()
     {
         // Get the account details from the account table
         // No SQL injection (prepared statement)
-        stmt = LoginDatabase.GetPreparedStatement(LOGIN_SEL_LOGONCHALLENGE);
+        PreparedStatement* stmt = LoginDatabase.GetPreparedStatement(LOGIN_SEL_LOGONCHALLENGE);
         stmt->setString(0, _login);
 
         PreparedQueryResult res2 = LoginDatabase.Query(stmt);
@@ -411,17 +407,12 @@ bool AuthSocket::_HandleLogonChallenge()
 
             if (!locked)
             {
-                //set expired bans to inactive
-                LoginDatabase.Execute(LoginDatabase.GetPreparedStatement(LOGIN_UPD_EXPIRED_ACCOUNT_BANS));
-                LoginDatabase.Execute(LoginDatabase.GetPreparedStatement(LOGIN_UPD_ACCOUNT_PREMIUM));
+                _accountId = fields[1].GetUInt32();
 
                 // If the account is banned, reject the logon attempt
-                stmt = LoginDatabase.GetPreparedStatement(LOGIN_SEL_ACCOUNT_BANNED);
-                stmt->setUInt32(0, fields[1].GetUInt32());
-                PreparedQueryResult banresult = LoginDatabase.Query(stmt);
-                if (banresult)
+                if (LogonCache::BanInfo const* ban = sLogonCache->GetAccountBan(_accountId))
                 {
-                    if ((*banresult)[0].GetUInt32() == (*banresult)[1].GetUInt32())
+                    if (ban->IsPermanent())
                     {
                         pkt << (uint8)WOW_FAIL_BANNED;
                         sLog->outDebug(LOG_FILTER_AUTHSERVER, "'%s:%d' [AuthChallenge] Banned account %s tried to login!", socket().getRemoteAddress().c_str(), socket().getRemotePort(), _login.c_str ());
@@ -756,6 +747,7 @@ bool AuthSocket::_HandleReconnectChallenge()
     Field* fields = result->Fetch();
     uint8 secLevel = fields[2].GetUInt8();
     _accountSecurityLevel = secLevel <= SEC_ADMINISTRATOR ? AccountTypes(secLevel) : SEC_ADMINISTRATOR;
+    _accountId = fields[1].GetUInt32();
 
     K.SetHexStr ((*result)[0].GetCString());
 
@@ -822,21 +814,14 @@ bool AuthSocket::_HandleRealmList()
 
     socket().recv_skip(5);
 
-    // Get the user id (else close the connection)
-    // No SQL injection (prepared statement)
-    PreparedStatement* stmt = LoginDatabase.GetPreparedStatement(LOGIN_SEL_ACCOUNT_ID_BY_NAME);
-    stmt->setString(0, _login);
-    PreparedQueryResult result = LoginDatabase.Query(stmt);
-    if (!result)
+    // The user id was read by the logon or reconnect challenge
+    if (!_accountId)
     {
         sLog->outError(LOG_FILTER_AUTHSERVER, "'%s:%d' [ERROR] user %s tried to login but we cannot find him in the database.", socket().getRemoteAddress().c_str(), socket().getRemotePort(), _login.c_str());
         socket().shutdown();
         return false;
     }
 
-    Field* fields = result->Fetch();
-    uint32 id = fields[0].GetUInt32();
-
     // Update realm list if need
     sRealmList->UpdateIfNeed();
 
@@ -850,17 +835,7 @@ bool AuthSocket::_HandleRealmList()
         if (i->second.gamebuild != _build)
             continue;
 
-        uint8 AmountOfCharacters;
-
-        // No SQL injection. id of realm is controlled by the database.
-        stmt = LoginDatabase.GetPreparedStatement(LOGIN_SEL_NUM_CHARS_ON_REALM);
-        stmt->setUInt32(0, i->second.m_ID);
-        stmt->setUInt32(1, id);
-        result = LoginDatabase.Query(stmt);
-        if (result)
-            AmountOfCharacters = (*result)[0].GetUInt8();
-        else
-            AmountOfCharacters = 0;
+        uint8 AmountOfCharacters = sLogonCache->GetCharacterCount(_accountId, i->second.m_ID);
 
         uint8 lock = (i->second.allowedSecurityLevel > _accountSecurityLevel) ? 1 : 0;
 
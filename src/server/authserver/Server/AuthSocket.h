@@ -75,6 +75,7 @@ private:
 
     std::string _login;
     std::string _tokenKey;
+    uint32 _accountId;
 
     // Since GetLocaleByName() is _NOT_ bijective, we have to store the locale as a string. Otherwise we can't differ
     // between enUS and enGB, which is important for the patch system
@@ -0,0 +1,174 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Project-Hellscream https://hellscream.org
+// Copyright (C) 2018-2020 Project-Hellscream-6.2
+// Discord https://discord.gg/CWCF3C9
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include "LogonCache.h"
+#include "Database/DatabaseEnv.h"
+#include "Log.h"
+
+LogonCache::LogonCache() : m_UpdateDelay(10), m_FullReloadDelay(300), m_NextUpdateTime(0), m_NextFullReloadTime(0), m_LastBanDate(0)
+{
+}
+
+void LogonCache::Initialize(uint32 p_UpdateDelay, uint32 p_FullReloadDelay)
+{
+    m_UpdateDelay       = std::max<uint32>(p_UpdateDelay, 1);
+    m_FullReloadDelay   = std::max<uint32>(p_FullReloadDelay, m_UpdateDelay);
+
+    Update();
+
+    sLog->outInfo(LOG_FILTER_AUTHSERVER, "Loaded %u ip bans and %u account bans in the logon cache.", uint32(m_IPBans.size()), uint32(m_AccountBans.size()));
+}
+
+void LogonCache::Update()
+{
+    time_t l_Now = time(NULL);
+    if (l_Now < m_NextUpdateTime)
+        return;
+
+    m_NextUpdateTime = l_Now + m_UpdateDelay;
+
+    /// Housekeeping which used to run on every logon
+    LoginDatabase.Execute(LoginDatabase.GetPreparedStatement(LOGIN_DEL_EXPIRED_IP_BANS));
+    LoginDatabase.Execute(LoginDatabase.GetPreparedStatement(LOGIN_UPD_EXPIRED_ACCOUNT_BANS));
+    LoginDatabase.Execute(LoginDatabase.GetPreparedStatement(LOGIN_UPD_ACCOUNT_PREMIUM));
+
+    if (l_Now >= m_NextFullReloadTime)
+    {
+        m_NextFullReloadTime = l_Now + m_FullReloadDelay;
+
+        m_IPBans.clear();
+        m_AccountBans.clear();
+        m_LastBanDate = 0;
+    }
+
+    /// Bans given in the same second as the last one read are read again, it doesn't matter
+    LoadBans(m_LastBanDate);
+
+    for (auto l_Itr = m_CharacterCounts.begin(); l_Itr != m_CharacterCounts.end();)
+    {
+        if (l_Itr->second.ExpireTime <= l_Now)
+            l_Itr = m_CharacterCounts.erase(l_Itr);
+        else
+            ++l_Itr;
+    }
+}
+
+void LogonCache::MergeBan(BanInfo& p_Ban, uint32 p_BanDate, uint32 p_UnbanDate)
+{
+    /// Several active bans, the permanent one or the one ending last wins
+    if (p_Ban.IsPermanent())
+        return;
+
+    if (p_BanDate == p_UnbanDate || p_UnbanDate > p_Ban.UnbanDate)
+    {
+        p_Ban.BanDate   = p_BanDate;
+        p_Ban.UnbanDate = p_UnbanDate;
+    }
+}
+
+void LogonCache::LoadBans(uint32 p_Since)
+{
+    PreparedStatement* l_Stmt = LoginDatabase.GetPreparedStatement(LOGIN_SEL_IP_BANS_SINCE);
+    l_Stmt->setUInt32(0, p_Since);
+
+    if (PreparedQueryResult l_Result = LoginDatabase.Query(l_Stmt))
+    {
+        do
+        {
+            Field* l_Fields     = l_Result->Fetch();
+            uint32 l_BanDate    = l_Fields[1].GetUInt32();
+            uint32 l_UnbanDate  = l_Fields[2].GetUInt32();
+
+            auto l_Insert = m_IPBans.insert(std::make_pair(l_Fields[0].GetString(), BanInfo{ l_BanDate, l_UnbanDate }));
+            if (!l_Insert.second)
+                MergeBan(l_Insert.first->second, l_BanDate, l_UnbanDate);
+
+            m_LastBanDate = std::max(m_LastBanDate, l_BanDate);
+        }
+        while (l_Result->NextRow());
+    }
+
+    l_Stmt = LoginDatabase.GetPreparedStatement(LOGIN_SEL_ACCOUNT_BANS_SINCE);
+    l_Stmt->setUInt32(0, p_Since);
+
+    if (PreparedQueryResult l_Result = LoginDatabase.Query(l_Stmt))
+    {
+        do
+        {
+            Field* l_Fields     = l_Result->Fetch();
+            uint32 l_BanDate    = l_Fields[1].GetUInt32();
+            uint32 l_UnbanDate  = l_Fields[2].GetUInt32();
+
+            auto l_Insert = m_AccountBans.insert(std::make_pair(l_Fields[0].GetUInt32(), BanInfo{ l_BanDate, l_UnbanDate }));
+            if (!l_Insert.second)
+                MergeBan(l_Insert.first->second, l_BanDate, l_UnbanDate);
+
+            m_LastBanDate = std::max(m_LastBanDate, l_BanDate);
+        }
+        while (l_Result->NextRow());
+    }
+}
+
+bool LogonCache::IsIPBanned(std::string const& p_IP)
+{
+    auto l_Itr = m_IPBans.find(p_IP);
+    if (l_Itr == m_IPBans.end())
+        return false;
+
+    if (l_Itr->second.IsExpired(time(NULL)))
+    {
+        m_IPBans.erase(l_Itr);
+        return false;
+    }
+
+    return true;
+}
+
+LogonCache::BanInfo const* LogonCache::GetAccountBan(uint32 p_AccountID)
+{
+    auto l_Itr = m_AccountBans.find(p_AccountID);
+    if (l_Itr == m_AccountBans.end())
+        return nullptr;
+
+    if (l_Itr->second.IsExpired(time(NULL)))
+    {
+        m_AccountBans.erase(l_Itr);
+        return nullptr;
+    }
+
+    return &l_Itr->second;
+}
+
+uint8 LogonCache::GetCharacterCount(uint32 p_AccountID, uint32 p_RealmID)
+{
+    time_t l_Now = time(NULL);
+
+    CharacterCounts& l_Counts = m_CharacterCounts[p_AccountID];
+    if (l_Counts.ExpireTime <= l_Now)
+    {
+        /// One query for all the realms of the account
+        l_Counts.Counts.clear();
+        l_Counts.ExpireTime = l_Now + m_UpdateDelay;
+
+        PreparedStatement* l_Stmt = LoginDatabase.GetPreparedStatement(LOGIN_SEL_REALM_CHARACTERS_BY_ACCOUNT);
+        l_Stmt->setUInt32(0, p_AccountID);
+
+        if (PreparedQueryResult l_Result = LoginDatabase.Query(l_Stmt))
+        {
+            do
+            {
+                Field* l_Fields = l_Result->Fetch();
+                l_Counts.Counts[l_Fields[0].GetUInt32()] = l_Fields[1].GetUInt8();
+            }
+            while (l_Result->NextRow());
+        }
+    }
+
+    auto l_Itr = l_Counts.Counts.find(p_RealmID);
+    return l_Itr != l_Counts.Counts.end() ? l_Itr->second : 0;
+}
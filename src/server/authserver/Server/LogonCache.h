@@ -0,0 +1,70 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Project-Hellscream https://hellscream.org
+// Copyright (C) 2018-2020 Project-Hellscream-6.2
+// Discord https://discord.gg/CWCF3C9
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _LOGONCACHE_H
+#define _LOGONCACHE_H
+
+#include <ace/Singleton.h>
+#include <ace/Null_Mutex.h>
+#include "Common.h"
+
+/// Copy of the ip and account bans and of the character counts read by the logon path.
+/// New bans are fetched every update, the whole ban list is reloaded less often to forget the
+/// lifted ones, expired bans are dropped in memory. Only used by the network thread.
+class LogonCache
+{
+    public:
+        struct BanInfo
+        {
+            uint32 BanDate;
+            uint32 UnbanDate;
+
+            bool IsPermanent() const { return BanDate == UnbanDate; }
+            bool IsExpired(time_t p_Now) const { return !IsPermanent() && time_t(UnbanDate) <= p_Now; }
+        };
+
+        LogonCache();
+
+        void Initialize(uint32 p_UpdateDelay, uint32 p_FullReloadDelay);
+
+        /// Called by the main loop, refreshes the bans when needed
+        void Update();
+
+        bool IsIPBanned(std::string const& p_IP);
+
+        /// Active ban of the account, null if none
+        BanInfo const* GetAccountBan(uint32 p_AccountID);
+
+        /// Characters of the account on the realm, the counts of an account are kept p_UpdateDelay seconds
+        uint8 GetCharacterCount(uint32 p_AccountID, uint32 p_RealmID);
+
+    private:
+        struct CharacterCounts
+        {
+            time_t ExpireTime = 0;
+            std::map<uint32, uint8> Counts;                             ///< Realm ID => characters
+        };
+
+        /// Reads the bans given since p_Since, bandate of the database
+        void LoadBans(uint32 p_Since);
+
+        static void MergeBan(BanInfo& p_Ban, uint32 p_BanDate, uint32 p_UnbanDate);
+
+        std::unordered_map<std::string, BanInfo> m_IPBans;
+        std::unordered_map<uint32, BanInfo> m_AccountBans;
+        std::unordered_map<uint32, CharacterCounts> m_CharacterCounts;
+
+        uint32 m_UpdateDelay;
+        uint32 m_FullReloadDelay;
+        time_t m_NextUpdateTime;
+        time_t m_NextFullReloadTime;
+        uint32 m_LastBanDate;                                           ///< Most recent bandate read, clock of the database
+};
+
+#define sLogonCache ACE_Singleton<LogonCache, ACE_Null_Mutex>::instance()
+#endif
@@ -74,6 +74,8 @@ SmartScript::SmartScript()
     goOrigGUID = 0;
     mLastInvoker = 0;
     mScriptType = SMART_SCRIPT_TYPE_CREATURE;
+    memset(mEventIndexOffsets, 0, sizeof(mEventIndexOffsets));
+    mEventConditionsLoadCount = 0;
 }
 
 SmartScript::~SmartScript()
@@ -102,20 +104,56 @@ void SmartScript::OnReset()
 
 void SmartScript::ProcessEventsFor(SMART_EVENT e, Unit* unit, uint32 var0, uint32 var1, bool bvar, const SpellInfo* spell, GameObject* gob)
 {
-    for (SmartAIEventList::iterator i = mEvents.begin(); i != mEvents.end(); ++i)
-    {
-        SMART_EVENT eventType = SMART_EVENT((*i).GetEventType());
-        if (eventType == SMART_EVENT_LINK)//special handling
-            continue;
+    if (e == SMART_EVENT_LINK || e >= SMART_EVENT_END)//special handling
+        return;
 
-        if (eventType == e/* && (!(*i).event.event_phase_mask || IsInPhase((*i).event.event_phase_mask)) && !((*i).event.event_flags & SMART_EVENT_FLAG_NOT_REPEATABLE && (*i).runOnce)*/)
+    if (mEventConditionsLoadCount != sConditionMgr->GetLoadCount())
+        ResolveEventConditions();
+
+    // only the events of this type, the offsets are read again as a processed event may raise other ones
+    for (uint32 i = mEventIndexOffsets[e]; i < mEventIndexOffsets[e + 1]; ++i)
+    {
+        uint32 index = mEventIndex[i];
+        if (ConditionContainer const* conditions = mEventConditions[index])
         {
-            if (sConditionMgr->IsObjectMeetingSmartEventConditions(i->entryOrGuid, i->event_id, i->source_type, unit, GetBaseObject()))
-                ProcessEvent(*i, unit, var0, var1, bvar, spell, gob);
+            ConditionSourceInfo sourceInfo(unit, GetBaseObject());
+            if (!sConditionMgr->IsObjectMeetToConditions(sourceInfo, *conditions))
+                continue;
         }
+
+        ProcessEvent(mEvents[index], unit, var0, var1, bvar, spell, gob);
     }
 }
 
+void SmartScript::BuildEventIndex()
+{
+    // counting sort on the event type, keeps mEvents order inside a type
+    memset(mEventIndexOffsets, 0, sizeof(mEventIndexOffsets));
+    for (SmartAIEventList::const_iterator i = mEvents.begin(); i != mEvents.end(); ++i)
+        if (i->GetEventType() < SMART_EVENT_END)
+            ++mEventIndexOffsets[i->GetEventType() + 1];
+
+    for (uint32 type = 0; type < SMART_EVENT_END; ++type)
+        mEventIndexOffsets[type + 1] += mEventIndexOffsets[type];
+
+    std::vector<uint32> next(mEventIndexOffsets, mEventIndexOffsets + SMART_EVENT_END);
+    mEventIndex.resize(mEventIndexOffsets[SMART_EVENT_END]);
+    for (uint32 index = 0; index < mEvents.size(); ++index)
+        if (mEvents[index].GetEventType() < SMART_EVENT_END)
+            mEventIndex[next[mEvents[index].GetEventType()]++] = index;
+
+    ResolveEventConditions();
+}
+
+void SmartScript::ResolveEventConditions()
+{
+    mEventConditions.resize(mEvents.size());
+    for (uint32 index = 0; index < mEvents.size(); ++index)
+        mEventConditions[index] = sConditionMgr->GetConditionsForSmartEvent(mEvents[index].entryOrGuid, mEvents[index].event_id, mEvents[index].source_type);
+
+    mEventConditionsLoadCount = sConditionMgr->GetLoadCount();
+}
+
 void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, uint32 var1, bool bvar, const SpellInfo* spell, GameObject* gob)
 {
     //calc random
@@ -3507,6 +3545,7 @@ void SmartScript::InstallEvents()
             mEvents.push_back(*i);//must be before UpdateTimers
 
         mInstallEvents.clear();
+        BuildEventIndex();
     }
 }
 
@@ -3593,6 +3632,8 @@ void SmartScript::FillScript(SmartAIEventList e, WorldObject* obj, AreaTriggerEn
         }
         mEvents.push_back((*i));//NOTE: 'world(0)' events still get processed in ANY instance mode
     }
+    BuildEventIndex();
+
     if (mEvents.empty() && obj)
         sLog->outDebug(LOG_FILTER_SQL, "SmartScript: Entry %u has events but no events added to list because of instance flags.", obj->GetEntry());
     if (mEvents.empty() && at)
@@ -258,6 +258,13 @@ class SmartScript
         void SetPhase(uint32 p = 0) { mEventPhase = p; }
 
         SmartAIEventList mEvents;
+        /// Positions in mEvents grouped by event type, the events of type T are at mEventIndex[mEventIndexOffsets[T]]
+        /// to mEventIndex[mEventIndexOffsets[T + 1] - 1], in mEvents order
+        std::vector<uint32> mEventIndex;
+        uint32 mEventIndexOffsets[SMART_EVENT_END + 1];
+        /// Conditions of each event of mEvents, looked up again when the conditions are reloaded
+        std::vector<ConditionContainer const*> mEventConditions;
+        uint32 mEventConditionsLoadCount;
         SmartAIEventList mInstallEvents;
         SmartAIEventList mTimedActionList;
         Creature* me;
@@ -281,6 +288,8 @@ class SmartScript
 
         SMARTAI_TEMPLATE mTemplate;
         void InstallEvents();
+        void BuildEventIndex();
+        void ResolveEventConditions();
 
         void RemoveStoredEvent (uint32 id)
         {
@@ -389,7 +389,7 @@ bool AchievementCriteriaDataSet::Meets(Player const* p_Source, Unit const* p_Tar
 }
 
 template<class T>
-AchievementMgr<T>::AchievementMgr(T* owner) : _owner(owner), _achievementPoints(0), m_NeedDBSync(false)
+AchievementMgr<T>::AchievementMgr(T* owner) : _owner(owner), _achievementPoints(0), m_NeedDBSync(false), m_SavedAchievementPoints(0)
 {
 }
 
@@ -540,8 +540,10 @@ void AchievementMgr<Player>::SaveToDB(SQLTransaction& trans)
             if (AchievementEntry const* pAchievement = sAchievementStore.LookupEntry(itr->first))
                 points += pAchievement->Points;
 
-        if (points)
+        /// The count only moves when an achievement is completed, don't rewrite it on every save
+        if (points && points != m_SavedAchievementPoints)
         {
+            m_SavedAchievementPoints = points;
             sscount << "REPLACE INTO character_achievement_count (guid, count) VALUES (" << GetOwner()->GetRealGUIDLow() << "," << points << ");";
             trans->Append(sscount.str().c_str());
         }
@@ -1360,7 +1362,7 @@ void AchievementMgr<T>::UpdateAchievementCriteria(AchievementCriteriaTypes p_Typ
     if (IsGuild<T>() && !sWorld->getBoolConfig(CONFIG_GUILD_LEVELING_ENABLED))
         return;
 
-    AchievementCriteriaEntryList const& l_AchievementCriteriaList = sAchievementMgr->GetAchievementCriteriaByType(p_Type);
+    AchievementCriteriaEntryList const& l_AchievementCriteriaList = sAchievementMgr->GetAchievementCriteriaByTypeAndAsset(p_Type, p_MiscValue1);
     for (AchievementCriteriaEntryList::const_iterator i = l_AchievementCriteriaList.begin(); i != l_AchievementCriteriaList.end(); ++i)
     {
         CriteriaEntry const* l_AchievementCriteria = (*i);
@@ -3854,6 +3856,9 @@ void AchievementGlobalMgr::LoadAchievementCriteriaList()
 
         m_AchievementCriteriasByType[l_Criteria->Type].push_back(l_Criteria);
 
+        if (GetCriteriaAssetMatch(AchievementCriteriaTypes(l_Criteria->Type)) != CRITERIA_ASSET_MATCH_NONE)
+            m_AchievementCriteriasByAsset[MakeCriteriaAssetKey(l_Criteria->Type, l_Criteria->raw.criteriaArg1)].push_back(l_Criteria);
+
         if (l_Criteria->StartTimer)
             m_AchievementCriteriasByTimedType[l_Criteria->StartEvent].push_back(l_Criteria);
 
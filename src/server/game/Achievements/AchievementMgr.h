@@ -27,6 +27,15 @@ typedef std::vector<AchievementEntry const*>         AchievementEntryByCriteriaT
 typedef std::vector<ModifierTreeEntryList>           ModifierTreeEntryByTreeId;
 typedef std::vector<AchievementCriteriaTreeList>     SubCriteriaTreeListById;
 typedef std::vector<AchievementEntry const*>         AchievementEntryByCriteriaTreeId;
+typedef std::unordered_map<uint64, AchievementCriteriaEntryList> AchievementCriteriaListByAsset;
+
+/// How RequirementsSatisfied matches the miscValue1 of an update against the asset of a criteria type
+enum AchievementCriteriaAssetMatch
+{
+    CRITERIA_ASSET_MATCH_NONE,          ///< Asset not compared, or not against miscValue1
+    CRITERIA_ASSET_MATCH_REQUIRED,      ///< miscValue1 must be the asset
+    CRITERIA_ASSET_MATCH_OPTIONAL       ///< miscValue1 must be the asset when set, 0 updates every criteria (login, reload)
+};
 
 
 struct CriteriaProgress
@@ -664,6 +673,7 @@ class AchievementMgr
         TimedAchievementMap m_timedAchievements;      // Criteria id/time left in MS
         uint32 _achievementPoints;
         bool m_NeedDBSync;
+        uint32 m_SavedAchievementPoints;    ///< Points written to character_achievement_count by the last save
 };
 
 struct AchievementCriteriaUpdateTask
@@ -693,6 +703,28 @@ class AchievementGlobalMgr
             return m_AchievementCriteriasByType[type];
         }
 
+        /// Criteria of the type that can pass RequirementsSatisfied for this miscValue1, avoids walking the thousands of kill and cast criteria
+        AchievementCriteriaEntryList const& GetAchievementCriteriaByTypeAndAsset(AchievementCriteriaTypes p_Type, uint64 p_MiscValue1) const
+        {
+            switch (GetCriteriaAssetMatch(p_Type))
+            {
+                case CRITERIA_ASSET_MATCH_OPTIONAL:
+                    if (!p_MiscValue1)
+                        return m_AchievementCriteriasByType[p_Type];
+                    /// No break
+                case CRITERIA_ASSET_MATCH_REQUIRED:
+                {
+                    if (p_MiscValue1 > 0xFFFFFFFF)
+                        return m_EmptyCriteriaList;
+
+                    AchievementCriteriaListByAsset::const_iterator l_Itr = m_AchievementCriteriasByAsset.find(MakeCriteriaAssetKey(p_Type, uint32(p_MiscValue1)));
+                    return l_Itr != m_AchievementCriteriasByAsset.end() ? l_Itr->second : m_EmptyCriteriaList;
+                }
+                default:
+                    return m_AchievementCriteriasByType[p_Type];
+            }
+        }
+
         AchievementCriteriaEntryList const& GetTimedAchievementCriteriaByType(AchievementCriteriaTimedTypes type) const
         {
             return m_AchievementCriteriasByTimedType[type];
@@ -782,6 +814,49 @@ class AchievementGlobalMgr
             return false;
         }
 
+        /// Must stay in sync with RequirementsSatisfied, the asset is the first field of the criteria union for all these types
+        static AchievementCriteriaAssetMatch GetCriteriaAssetMatch(AchievementCriteriaTypes p_Type)
+        {
+            switch (p_Type)
+            {
+                case ACHIEVEMENT_CRITERIA_TYPE_KILL_CREATURE:
+                case ACHIEVEMENT_CRITERIA_TYPE_CURRENCY:
+                case ACHIEVEMENT_CRITERIA_TYPE_KILLED_BY_CREATURE:
+                case ACHIEVEMENT_CRITERIA_TYPE_BE_SPELL_TARGET:
+                case ACHIEVEMENT_CRITERIA_TYPE_BE_SPELL_TARGET2:
+                case ACHIEVEMENT_CRITERIA_TYPE_CAST_SPELL:
+                case ACHIEVEMENT_CRITERIA_TYPE_CAST_SPELL2:
+                case ACHIEVEMENT_CRITERIA_TYPE_BG_OBJECTIVE_CAPTURE:
+                case ACHIEVEMENT_CRITERIA_TYPE_HONORABLE_KILL_AT_AREA:
+                case ACHIEVEMENT_CRITERIA_TYPE_USE_ITEM:
+                case ACHIEVEMENT_CRITERIA_TYPE_LOOT_ITEM:
+                case ACHIEVEMENT_CRITERIA_TYPE_HK_CLASS:
+                case ACHIEVEMENT_CRITERIA_TYPE_HK_RACE:
+                case ACHIEVEMENT_CRITERIA_TYPE_DO_EMOTE:
+                case ACHIEVEMENT_CRITERIA_TYPE_EQUIP_ITEM:
+                case ACHIEVEMENT_CRITERIA_TYPE_USE_GAMEOBJECT:
+                case ACHIEVEMENT_CRITERIA_TYPE_FISH_IN_GAMEOBJECT:
+                case ACHIEVEMENT_CRITERIA_TYPE_DEFEAT_ENCOUNTER:
+                    return CRITERIA_ASSET_MATCH_REQUIRED;
+                case ACHIEVEMENT_CRITERIA_TYPE_REACH_SKILL_LEVEL:
+                case ACHIEVEMENT_CRITERIA_TYPE_LEARN_SKILL_LEVEL:
+                case ACHIEVEMENT_CRITERIA_TYPE_COMPLETE_QUESTS_IN_ZONE:
+                case ACHIEVEMENT_CRITERIA_TYPE_COMPLETE_QUEST:
+                case ACHIEVEMENT_CRITERIA_TYPE_LEARN_SPELL:
+                case ACHIEVEMENT_CRITERIA_TYPE_OWN_ITEM:
+                case ACHIEVEMENT_CRITERIA_TYPE_GAIN_REPUTATION:
+                case ACHIEVEMENT_CRITERIA_TYPE_LEARN_SKILLLINE_SPELLS:
+                case ACHIEVEMENT_CRITERIA_TYPE_CAPTURE_BATTLEPET:
+                case ACHIEVEMENT_CRITERIA_TYPE_LEARN_SKILL_LINE:
+                case ACHIEVEMENT_CRITERIA_TYPE_LEVELUP_BATTLEPET:
+                    return CRITERIA_ASSET_MATCH_OPTIONAL;
+                default:
+                    break;
+            }
+
+            return CRITERIA_ASSET_MATCH_NONE;
+        }
+
         void LoadAchievementCriteriaList();
         void LoadAchievementCriteriaData();
         void LoadAchievementReferenceList();
@@ -820,6 +895,12 @@ class AchievementGlobalMgr
 
         AchievementCriteriaEntryList m_AchievementCriteriasByTimedType[ACHIEVEMENT_TIMED_TYPE_MAX];
 
+        // store asset matched achievement criterias by type and asset, see GetCriteriaAssetMatch
+        AchievementCriteriaListByAsset m_AchievementCriteriasByAsset;
+        AchievementCriteriaEntryList m_EmptyCriteriaList;
+
+        static uint64 MakeCriteriaAssetKey(uint32 p_Type, uint32 p_Asset) { return uint64(p_Type) << 32 | p_Asset; }
+
         // store achievements by referenced achievement id to speed up lookup
         AchievementListByReferencedId m_AchievementListByReferencedId;
 
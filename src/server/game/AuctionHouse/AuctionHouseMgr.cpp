@@ -408,12 +408,14 @@ void AuctionHouseObject::AddAuction(AuctionEntry* auction)
     ASSERT(auction);
 
     AuctionsMap[auction->Id] = auction;
+    AddToSearchIndexes(auction);
     sScriptMgr->OnAuctionAdd(this, auction);
 }
 
 bool AuctionHouseObject::RemoveAuction(AuctionEntry* auction, uint32 /*itemEntry*/)
 {
     bool wasInMap = AuctionsMap.erase(auction->Id) ? true : false;
+    RemoveFromSearchIndexes(auction->Id);
 
     sScriptMgr->OnAuctionRemove(this, auction);
 
@@ -422,6 +424,102 @@ bool AuctionHouseObject::RemoveAuction(AuctionEntry* auction, uint32 /*itemEntry
     return wasInMap;
 }
 
+void AuctionHouseObject::AddToSearchIndexes(AuctionEntry const* p_Auction)
+{
+    Item* l_Item = sAuctionMgr->GetAItem(p_Auction->itemGUIDLow);
+    ItemTemplate const* l_Template = l_Item ? l_Item->GetTemplate() : sObjectMgr->GetItemTemplate(p_Auction->itemEntry);
+    if (!l_Template)
+        return;
+
+    RemoveFromSearchIndexes(p_Auction->Id);
+
+    AuctionSearchEntry& l_Entry = m_SearchEntries[p_Auction->Id];
+    l_Entry.Class            = l_Template->Class;
+    l_Entry.SubClass         = l_Template->SubClass;
+    l_Entry.InventoryType    = l_Template->InventoryType;
+    l_Entry.Quality          = l_Template->Quality;
+    l_Entry.RequiredLevel    = l_Template->RequiredLevel;
+    l_Entry.RandomPropertyId = l_Item ? l_Item->GetItemRandomPropertyId() : 0;
+    l_Entry.Template         = l_Template;
+
+    m_ClassIndex[l_Entry.Class].insert(p_Auction->Id);
+    m_SubClassIndex[l_Entry.Class << 16 | l_Entry.SubClass].insert(p_Auction->Id);
+    m_InventoryTypeIndex[l_Entry.InventoryType].insert(p_Auction->Id);
+    m_QualityIndex[l_Entry.Quality].insert(p_Auction->Id);
+    m_RequiredLevelIndex[l_Entry.RequiredLevel].insert(p_Auction->Id);
+}
+
+void AuctionHouseObject::RemoveFromSearchIndexes(uint32 p_AuctionId)
+{
+    AuctionSearchEntryMap::iterator l_Itr = m_SearchEntries.find(p_AuctionId);
+    if (l_Itr == m_SearchEntries.end())
+        return;
+
+    AuctionSearchEntry const& l_Entry = l_Itr->second;
+
+    auto l_RemoveFrom = [p_AuctionId](AuctionSearchIndex& p_Index, uint32 p_Key)
+    {
+        AuctionSearchIndex::iterator l_Set = p_Index.find(p_Key);
+        if (l_Set == p_Index.end())
+            return;
+
+        l_Set->second.erase(p_AuctionId);
+        if (l_Set->second.empty())
+            p_Index.erase(l_Set);
+    };
+
+    l_RemoveFrom(m_ClassIndex, l_Entry.Class);
+    l_RemoveFrom(m_SubClassIndex, l_Entry.Class << 16 | l_Entry.SubClass);
+    l_RemoveFrom(m_InventoryTypeIndex, l_Entry.InventoryType);
+    l_RemoveFrom(m_QualityIndex, l_Entry.Quality);
+    l_RemoveFrom(m_RequiredLevelIndex, l_Entry.RequiredLevel);
+
+    m_SearchEntries.erase(l_Itr);
+}
+
+std::wstring const& AuctionHouseObject::AuctionSearchEntry::GetNormalizedName(LocaleConstant p_Locale, LocaleConstant p_DbcLocale) const
+{
+    uint16 l_Key = uint16(p_Locale) << 8 | uint16(p_DbcLocale);
+
+    std::map<uint16, std::wstring>::const_iterator l_Itr = NormalizedNames.find(l_Key);
+    if (l_Itr != NormalizedNames.end())
+        return l_Itr->second;
+
+    std::wstring& l_Result = NormalizedNames[l_Key];
+
+    std::string l_Name = Template->Name1->Get(p_Locale);
+    if (l_Name.empty())
+        return l_Result;
+
+    // DO NOT use GetItemEnchantMod(proto->RandomProperty) as it may return a result
+    //  that matches the search but it may not equal item->GetItemRandomPropertyId()
+    //  used in BuildAuctionInfo() which then causes wrong items to be listed
+    if (RandomPropertyId)
+    {
+        // Append the suffix to the name (ie: of the Monkey) if one exists
+        // These are found in ItemRandomProperties.dbc, not ItemRandomSuffix.dbc
+        //  even though the DBC names seem misleading
+        if (ItemRandomPropertiesEntry const* l_RandomProperty = sItemRandomPropertiesStore.LookupEntry(RandomPropertyId))
+        {
+            char* l_Suffix = l_RandomProperty->nameSuffix;
+
+            // Append the suffix (ie: of the Monkey) to the name using localization
+            // or default enUS if localization is invalid
+            if (l_Suffix)
+            {
+                l_Name += ' ';
+                l_Name += l_Suffix[p_DbcLocale >= 0 ? p_DbcLocale : LOCALE_enUS];
+            }
+        }
+    }
+
+    if (!Utf8toWStr(l_Name, l_Result))
+        l_Result.clear();
+
+    wstrToLower(l_Result);
+    return l_Result;
+}
+
 void AuctionHouseObject::Update()
 {
     time_t curTime = sWorld->GetGameTime();
@@ -512,75 +610,99 @@ void AuctionHouseObject::BuildListAuctionItems(WorldPacket& data, Player* player
     uint32 inventoryType, uint32 itemClass, uint32 itemSubClass, uint32 quality,
     uint32& count, uint32& totalcount)
 {
-    int loc_idx = player->GetSession()->GetSessionDbLocaleIndex();
-    int locdbc_idx = player->GetSession()->GetSessionDbcLocale();
+    LocaleConstant loc_idx = player->GetSession()->GetSessionDbLocaleIndex();
+    LocaleConstant locdbc_idx = player->GetSession()->GetSessionDbcLocale();
 
-    for (AuctionEntryMap::const_iterator itr = AuctionsMap.begin(); itr != AuctionsMap.end(); ++itr)
+    static AuctionIdSet const s_EmptySet;
+
+    /// Walk the smallest index matching one of the filters, the others are checked on the cached search data
+    AuctionIdSet const* l_Candidates = nullptr;
+    auto l_Narrow = [&l_Candidates](AuctionSearchIndex const& p_Index, uint32 p_Key)
     {
-        AuctionEntry* Aentry = itr->second;
-        Item* item = sAuctionMgr->GetAItem(Aentry->itemGUIDLow);
-        if (!item)
-            continue;
+        AuctionSearchIndex::const_iterator l_Itr = p_Index.find(p_Key);
+        AuctionIdSet const* l_Set = l_Itr != p_Index.end() ? &l_Itr->second : &s_EmptySet;
+        if (!l_Candidates || l_Set->size() < l_Candidates->size())
+            l_Candidates = l_Set;
+    };
 
-        ItemTemplate const* proto = item->GetTemplate();
+    if (itemClass != 0xffffffff)
+    {
+        if (itemSubClass != 0xffffffff)
+            l_Narrow(m_SubClassIndex, itemClass << 16 | itemSubClass);
+        else
+            l_Narrow(m_ClassIndex, itemClass);
+    }
 
-        if (itemClass != 0xffffffff && proto->Class != itemClass)
-            continue;
+    if (inventoryType != 0xffffffff)
+        l_Narrow(m_InventoryTypeIndex, inventoryType);
 
-        if (itemSubClass != 0xffffffff && proto->SubClass != itemSubClass)
-            continue;
+    if (quality != 0xffffffff)
+        l_Narrow(m_QualityIndex, quality);
 
-        if (inventoryType != 0xffffffff && proto->InventoryType != inventoryType)
-            continue;
+    /// A level range spans several sets, they are merged only when that beats the other filters
+    std::vector<uint32> l_LevelCandidates;
+    bool l_UseLevelCandidates = false;
+    if (levelmin != 0x00)
+    {
+        uint32 l_MaxLevel = levelmax != 0x00 ? levelmax : std::numeric_limits<uint32>::max();
+        std::vector<AuctionIdSet const*> l_LevelSets;
+        size_t l_LevelCount = 0;
 
-        if (quality != 0xffffffff && proto->Quality != quality)
-            continue;
+        for (AuctionSearchIndex::const_iterator l_Itr = m_RequiredLevelIndex.begin(); l_Itr != m_RequiredLevelIndex.end(); ++l_Itr)
+        {
+            if (l_Itr->first < levelmin || l_Itr->first > l_MaxLevel)
+                continue;
 
-        if (levelmin != 0x00 && (proto->RequiredLevel < levelmin || (levelmax != 0x00 && proto->RequiredLevel > levelmax)))
-            continue;
+            l_LevelSets.push_back(&l_Itr->second);
+            l_LevelCount += l_Itr->second.size();
+        }
+
+        if (l_LevelCount < (l_Candidates ? l_Candidates->size() : m_SearchEntries.size()))
+        {
+            l_LevelCandidates.reserve(l_LevelCount);
+            for (AuctionIdSet const* l_Set : l_LevelSets)
+                l_LevelCandidates.insert(l_LevelCandidates.end(), l_Set->begin(), l_Set->end());
+
+            std::sort(l_LevelCandidates.begin(), l_LevelCandidates.end());
+            l_UseLevelCandidates = true;
+        }
+    }
+
+    auto l_Process = [&](uint32 p_AuctionId, AuctionSearchEntry const& p_Entry)
+    {
+        if (itemClass != 0xffffffff && p_Entry.Class != itemClass)
+            return;
+
+        if (itemSubClass != 0xffffffff && p_Entry.SubClass != itemSubClass)
+            return;
+
+        if (inventoryType != 0xffffffff && p_Entry.InventoryType != inventoryType)
+            return;
+
+        if (quality != 0xffffffff && p_Entry.Quality != quality)
+            return;
+
+        if (levelmin != 0x00 && (p_Entry.RequiredLevel < levelmin || (levelmax != 0x00 && p_Entry.RequiredLevel > levelmax)))
+            return;
+
+        AuctionEntry* Aentry = GetAuction(p_AuctionId);
+        if (!Aentry)
+            return;
+
+        Item* item = sAuctionMgr->GetAItem(Aentry->itemGUIDLow);
+        if (!item)
+            return;
 
         if (usable != 0x00 && player->CanUseItem(item) != EQUIP_ERR_OK)
-            continue;
+            return;
 
         // Allow search by suffix (ie: of the Monkey) or partial name (ie: Monkey)
         // No need to do any of this if no search term was entered
         if (!wsearchedname.empty())
         {
-            std::string name = proto->Name1->Get(loc_idx);
-            if (name.empty())
-                continue;
-
-            // DO NOT use GetItemEnchantMod(proto->RandomProperty) as it may return a result
-            //  that matches the search but it may not equal item->GetItemRandomPropertyId()
-            //  used in BuildAuctionInfo() which then causes wrong items to be listed
-            int32 propRefID = item->GetItemRandomPropertyId();
-
-            if (propRefID)
-            {
-                // Append the suffix to the name (ie: of the Monkey) if one exists
-                // These are found in ItemRandomProperties.dbc, not ItemRandomSuffix.dbc
-                //  even though the DBC names seem misleading
-                const ItemRandomPropertiesEntry* itemRandProp = sItemRandomPropertiesStore.LookupEntry(propRefID);
-
-                if (itemRandProp)
-                {
-                    char* temp = itemRandProp->nameSuffix;
-                    //char* temp = itemRandProp->nameSuffix;
-
-                    // dbc local name
-                    if (temp)
-                    {
-                        // Append the suffix (ie: of the Monkey) to the name using localization
-                        // or default enUS if localization is invalid
-                        name += ' ';
-                        name += temp[locdbc_idx >= 0 ? locdbc_idx : LOCALE_enUS];
-                    }
-                }
-            }
-
-            // Perform the search (with or without suffix)
-            if (!Utf8FitTo(name, wsearchedname))
-                continue;
+            std::wstring const& name = p_Entry.GetNormalizedName(loc_idx, locdbc_idx);
+            if (name.empty() || name.find(wsearchedname) == std::wstring::npos)
+                return;
         }
 
         // Add the item if no search term or if entered search term was found
@@ -590,6 +712,23 @@ void AuctionHouseObject::BuildListAuctionItems(WorldPacket& data, Player* player
             Aentry->BuildAuctionInfo(data);
         }
         ++totalcount;
+    };
+
+    auto l_ProcessIds = [&](uint32 p_AuctionId)
+    {
+        AuctionSearchEntryMap::const_iterator l_Itr = m_SearchEntries.find(p_AuctionId);
+        if (l_Itr != m_SearchEntries.end())
+            l_Process(p_AuctionId, l_Itr->second);
+    };
+
+    if (l_UseLevelCandidates)
+        std::for_each(l_LevelCandidates.begin(), l_LevelCandidates.end(), l_ProcessIds);
+    else if (l_Candidates)
+        std::for_each(l_Candidates->begin(), l_Candidates->end(), l_ProcessIds);
+    else
+    {
+        for (AuctionSearchEntryMap::const_iterator l_Itr = m_SearchEntries.begin(); l_Itr != m_SearchEntries.end(); ++l_Itr)
+            l_Process(l_Itr->first, l_Itr->second);
     }
 }
 
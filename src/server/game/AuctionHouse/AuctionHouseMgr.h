@@ -18,6 +18,7 @@
 class Item;
 class Player;
 class WorldPacket;
+struct ItemTemplate;
 
 #define MIN_AUCTION_TIME (12*HOUR)
 #define MAX_AUCTION_ITEMS 160
@@ -123,8 +124,40 @@ class AuctionHouseObject
         uint32& count, uint32& totalcount);
 
   private:
+    /// Search relevant data of a listed item, copied once when the auction is added
+    struct AuctionSearchEntry
+    {
+        uint32 Class;
+        uint32 SubClass;
+        uint32 InventoryType;
+        uint32 Quality;
+        uint32 RequiredLevel;
+        int32 RandomPropertyId;
+        ItemTemplate const* Template;
+
+        /// Lower case full names (suffix included), built on the first search made in a locale
+        mutable std::map<uint16, std::wstring> NormalizedNames;
+
+        std::wstring const& GetNormalizedName(LocaleConstant p_Locale, LocaleConstant p_DbcLocale) const;
+    };
+
+    typedef std::map<uint32, AuctionSearchEntry> AuctionSearchEntryMap;
+    typedef std::set<uint32> AuctionIdSet;
+    typedef std::unordered_map<uint32, AuctionIdSet> AuctionSearchIndex;
+
+    void AddToSearchIndexes(AuctionEntry const* p_Auction);
+    void RemoveFromSearchIndexes(uint32 p_AuctionId);
+
     AuctionEntryMap AuctionsMap;
 
+    /// Secondary indexes used by BuildListAuctionItems, all sets are ordered by auction id like AuctionsMap
+    AuctionSearchEntryMap m_SearchEntries;
+    AuctionSearchIndex m_ClassIndex;
+    AuctionSearchIndex m_SubClassIndex;             ///< Key is class << 16 | subclass
+    AuctionSearchIndex m_InventoryTypeIndex;
+    AuctionSearchIndex m_QualityIndex;
+    AuctionSearchIndex m_RequiredLevelIndex;
+
     // storage for "next" auction item for next Update()
     AuctionEntryMap::const_iterator next;
 };
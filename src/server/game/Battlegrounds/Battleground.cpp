@@ -805,17 +805,25 @@ void Battleground::SetTeamStartLoc(uint32 TeamID, float X, float Y, float Z, flo
 
 void Battleground::SendPacketToAll(WorldPacket* packet)
 {
+    if (m_Players.empty())
+        return;
+
+    SharedWorldPacket l_Packet = MakeSharedPacket(*packet);
     for (BattlegroundPlayerMap::const_iterator itr = m_Players.begin(); itr != m_Players.end(); ++itr)
         if (Player* player = _GetPlayer(itr, "SendPacketToAll"))
-            player->GetSession()->SendPacket(packet);
+            player->GetSession()->SendPacket(l_Packet);
 }
 
 void Battleground::SendPacketToTeam(uint32 TeamID, WorldPacket* packet, Player* sender, bool self)
 {
+    if (m_Players.empty())
+        return;
+
+    SharedWorldPacket l_Packet = MakeSharedPacket(*packet);
     for (BattlegroundPlayerMap::const_iterator itr = m_Players.begin(); itr != m_Players.end(); ++itr)
         if (Player* player = _GetPlayerForTeam(TeamID, itr, "SendPacketToTeam"))
             if (self || sender != player)
-                player->GetSession()->SendPacket(packet);
+                player->GetSession()->SendPacket(l_Packet);
 }
 
 void Battleground::PlaySoundToAll(uint32 SoundID)
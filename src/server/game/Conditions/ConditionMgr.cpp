@@ -526,7 +526,7 @@ uint32 Condition::GetMaxAvailableConditionTargets() const
     }
 }
 
-ConditionMgr::ConditionMgr()
+ConditionMgr::ConditionMgr() : m_LoadCount(0)
 {
 }
 
@@ -775,6 +775,18 @@ bool ConditionMgr::IsObjectMeetingSmartEventConditions(int32 entryOrGuid, uint32
     return true;
 }
 
+ConditionContainer const* ConditionMgr::GetConditionsForSmartEvent(int32 entryOrGuid, uint32 eventId, uint32 sourceType) const
+{
+    SmartEventConditionContainer::const_iterator itr = SmartEventConditionStore.find(std::make_pair(entryOrGuid, sourceType));
+    if (itr != SmartEventConditionStore.end())
+    {
+        ConditionsByEntryMap::const_iterator i = itr->second.find(eventId + 1);
+        if (i != itr->second.end())
+            return &i->second;
+    }
+    return NULL;
+}
+
 bool ConditionMgr::IsObjectMeetingVendorItemConditions(uint32 creatureId, uint32 itemId, Player* player, Creature* vendor) const
 {
     ConditionEntriesByCreatureIdMap::const_iterator itr = NpcVendorConditionContainerStore.find(creatureId);
@@ -828,6 +840,7 @@ void ConditionMgr::LoadConditions(bool isReload)
     uint32 oldMSTime = getMSTime();
 
     Clean();
+    ++m_LoadCount;
 
     //must clear all custom handled cases (groupped types) before reload
     if (isReload)
@@ -235,10 +235,14 @@ class ConditionMgr
         ConditionContainer const* GetConditionsForSpellClickEvent(uint32 creatureId, uint32 spellId) const;
         bool IsObjectMeetingVehicleSpellConditions(uint32 creatureId, uint32 spellId, Player* player, Unit* vehicle) const;
         bool IsObjectMeetingSmartEventConditions(int32 entryOrGuid, uint32 eventId, uint32 sourceType, Unit* unit, WorldObject* baseObject) const;
+        ConditionContainer const* GetConditionsForSmartEvent(int32 entryOrGuid, uint32 eventId, uint32 sourceType) const;
         bool IsObjectMeetingVendorItemConditions(uint32 creatureId, uint32 itemId, Player* player, Creature* vendor) const;
         bool IsObjectMeetPhaseCondition(uint32 zone, uint32 entry, WorldObject* object) const;
         ConditionContainer const* GetConditionsForPhaseDefinition(uint32 zone, uint32 entry) const;
 
+        /// Bumped by every (re)load, the containers returned above are freed by the next one
+        uint32 GetLoadCount() const { return m_LoadCount; }
+
     private:
         bool isSourceTypeValid(Condition* cond) const;
         bool addToLootTemplate(Condition* cond, LootTemplate* loot) const;
@@ -257,6 +261,8 @@ class ConditionMgr
         ConditionEntriesByCreatureIdMap     NpcVendorConditionContainerStore;
         SmartEventConditionContainer        SmartEventConditionStore;
         PhaseDefinitionConditionContainer   PhaseDefinitionsConditionStore;
+
+        uint32 m_LoadCount;
 };
 
 template <class T> bool CompareValues(ComparisionType type,  T val1, T val2)
@@ -15,6 +15,8 @@
 #include "DB2fmt.h"
 #include "Item.h"
 #include "Common.h"
+#include "World.h"
+#include "StartupLoader.h"
 
 std::map<uint32, DB2StorageBase*> sDB2PerHash;
 
@@ -203,6 +205,7 @@ AreaGroupMemebersByID sAreaGroupMemebersByIDStore;
 typedef std::list<std::string> StoreProblemList1;
 
 uint32 DB2FilesCount = 0;
+static std::mutex sDB2LoadLock;                             ///< Problem list and sDB2PerHash
 
 static bool LoadDB2_assert_print(uint32 fsize,uint32 rsize, const std::string& filename)
 {
@@ -223,39 +226,48 @@ struct LocalDB2Data
 };
 
 template<class T>
-inline void LoadDB2(StoreProblemList1& errlist, DB2Storage<T>& storage, const std::string& db2_path, const std::string& filename, std::string customTableName = "", std::string customIndexName = "")
+inline void LoadDB2(StartupLoader& p_Loader, StoreProblemList1& errlist, DB2Storage<T>& storage, const std::string& db2_path, const std::string& filename, std::string customTableName = "", std::string customIndexName = "")
 {
     // compatibility format and C++ structure sizes
     ASSERT(DB2FileLoader::GetFormatRecordSize(storage.GetFormat()) == sizeof(T) || LoadDB2_assert_print(DB2FileLoader::GetFormatRecordSize(storage.GetFormat()), sizeof(T), filename));
 
     ++DB2FilesCount;
-    std::string db2_filename = db2_path + filename;
-    std::string l_SQLFormat;
-    SqlDb2 * sql = NULL;
-    if (!customTableName.empty())
+
+    /// The file is read by the loader threads, every storage is only touched by its own step until the next Run returns
+    p_Loader.AddStep(filename, [&errlist, &storage, db2_path, filename, customTableName, customIndexName]()
     {
-        l_SQLFormat = std::string(strlen(storage.GetFormat()), FT_SQL_PRESENT);
-        l_SQLFormat.append(1, FT_SQL_SUP);
+        std::string db2_filename = db2_path + filename;
+        std::string l_SQLFormat;
+        SqlDb2 * sql = NULL;
+        if (!customTableName.empty())
+        {
+            l_SQLFormat = std::string(strlen(storage.GetFormat()), FT_SQL_PRESENT);
+            l_SQLFormat.append(1, FT_SQL_SUP);
 
-        sql = new SqlDb2(customTableName, l_SQLFormat, customIndexName, storage.GetFormat());
-    }
+            sql = new SqlDb2(customTableName, l_SQLFormat, customIndexName, storage.GetFormat());
+        }
 
-    if (!storage.Load(db2_filename.c_str(), sql, sWorld->GetDefaultDbcLocale()))
-    {
-        // sort problematic db2 to (1) non compatible and (2) nonexistent
-        if (FILE * f = fopen(db2_filename.c_str(), "rb"))
+        bool l_Loaded = storage.Load(db2_filename.c_str(), sql, sWorld->GetDefaultDbcLocale());
+
+        std::lock_guard<std::mutex> l_Lock(sDB2LoadLock);
+
+        if (!l_Loaded)
         {
-            char buf[100];
-            snprintf(buf, 100,"(exist, but have %u fields instead " SIZEFMTD ") Wrong client version DBC file?", storage.GetFieldCount(), strlen(storage.GetFormat()));
-            errlist.push_back(db2_filename + buf);
-            fclose(f);
+            // sort problematic db2 to (1) non compatible and (2) nonexistent
+            if (FILE * f = fopen(db2_filename.c_str(), "rb"))
+            {
+                char buf[100];
+                snprintf(buf, 100,"(exist, but have %u fields instead " SIZEFMTD ") Wrong client version DBC file?", storage.GetFieldCount(), strlen(storage.GetFormat()));
+                errlist.push_back(db2_filename + buf);
+                fclose(f);
+            }
+            else
+                errlist.push_back(db2_filename);
         }
-        else
-            errlist.push_back(db2_filename);
-    }
 
-    if (sDB2PerHash.find(storage.GetHash()) == sDB2PerHash.end())
-        sDB2PerHash[storage.GetHash()] = &storage;
+        if (sDB2PerHash.find(storage.GetHash()) == sDB2PerHash.end())
+            sDB2PerHash[storage.GetHash()] = &storage;
+    });
 }
 
 SpellTotemsEntry const* GetSpellTotemEntry(uint32 spellId, uint8 totem)
@@ -290,10 +302,15 @@ void LoadDB2Stores(const std::string& dataPath)
 
     StoreProblemList1 bad_db2_files;
 
-    LoadDB2(bad_db2_files, sAchievementStore,            db2Path, "Achievement.db2");
-    LoadDB2(bad_db2_files, sModifierTreeStore,           db2Path, "ModifierTree.db2");
-    LoadDB2(bad_db2_files, sCriteriaStore,               db2Path, "Criteria.db2");
-    LoadDB2(bad_db2_files, sCriteriaTreeStore,           db2Path, "CriteriaTree.db2");
+    /// Files are read concurrently between the Run calls, the code in between post-processes what is loaded
+    StartupLoader l_Loader("DB2 stores", sWorld->getIntConfig(CONFIG_STARTUP_LOADER_THREADS));
+
+    LoadDB2(l_Loader, bad_db2_files, sAchievementStore,            db2Path, "Achievement.db2");
+    LoadDB2(l_Loader, bad_db2_files, sModifierTreeStore,           db2Path, "ModifierTree.db2");
+    LoadDB2(l_Loader, bad_db2_files, sCriteriaStore,               db2Path, "Criteria.db2");
+    LoadDB2(l_Loader, bad_db2_files, sCriteriaTreeStore,           db2Path, "CriteriaTree.db2");
+
+    l_Loader.Run();
 
     /// Ko'ragh Achievement - Pair Annihilation
     if (CriteriaEntry const* l_Criteria = sCriteriaStore.LookupEntry(24693))
@@ -302,59 +319,61 @@ void LoadDB2Stores(const std::string& dataPath)
     //////////////////////////////////////////////////////////////////////////
     /// Misc DB2
     //////////////////////////////////////////////////////////////////////////
-    LoadDB2(bad_db2_files, sSoundEntriesStore,              db2Path, "SoundEntries.db2"                                                     );
-    LoadDB2(bad_db2_files, sCurrencyTypesStore,             db2Path, "CurrencyTypes.db2",               "currency_types",               "ID");
-    LoadDB2(bad_db2_files, sPathNodeStore,                  db2Path, "PathNode.db2"                                                         );
-    LoadDB2(bad_db2_files, sLocationStore,                  db2Path, "Location.db2"                                                         );
-    LoadDB2(bad_db2_files, sAreaPOIStore,                   db2Path, "AreaPOI.db2"                                                          );
-    LoadDB2(bad_db2_files, sCurvePointStore,                db2Path, "CurvePoint.db2",                  "curve_point",                  "ID");
-    LoadDB2(bad_db2_files, sGroupFinderActivityStore,       db2Path, "GroupFinderActivity.db2"                                              );
-    LoadDB2(bad_db2_files, sGroupFinderCategoryStore,       db2Path, "GroupFinderCategory.db2"                                              );
-    LoadDB2(bad_db2_files, sHolidaysStore,                  db2Path, "Holidays.db2"                                                         );
-    LoadDB2(bad_db2_files, sMapChallengeModeStore,          db2Path, "MapChallengeMode.db2",            "map_challenge_mode",           "ID");
-    LoadDB2(bad_db2_files, sMountStore,                     db2Path, "Mount.db2",                       "mount",                        "ID");
-    LoadDB2(bad_db2_files, sMountTypeStore,                 db2Path, "MountType.db2",                   "mount_type",                   "ID");
-    LoadDB2(bad_db2_files, sMountCapabilityStore,           db2Path, "MountCapability.db2",             "mount_capability",             "ID");
-    LoadDB2(bad_db2_files, sMountTypeXCapabilityStore,      db2Path, "MountTypeXCapability.db2",        "mount_type_x_capability",      "ID");
-    LoadDB2(bad_db2_files, sPlayerConditionStore,           db2Path, "PlayerCondition.db2"                                                  );
-    LoadDB2(bad_db2_files, sVignetteStore,                  db2Path, "Vignette.db2"                                                         );
-    LoadDB2(bad_db2_files, sGlyphRequiredSpecStore,         db2Path, "GlyphRequiredSpec.db2"                                                );
-    LoadDB2(bad_db2_files, sQuestPOIPointStore,             db2Path, "QuestPOIPoint.db2"                                                    );
-    LoadDB2(bad_db2_files, sAreaGroupStore,                 db2Path, "AreaGroup.db2"                                                        );
-    LoadDB2(bad_db2_files, sAreaGroupMemberStore,           db2Path, "AreaGroupMember.db2"                                                  );
+    LoadDB2(l_Loader, bad_db2_files, sSoundEntriesStore,              db2Path, "SoundEntries.db2"                                                     );
+    LoadDB2(l_Loader, bad_db2_files, sCurrencyTypesStore,             db2Path, "CurrencyTypes.db2",               "currency_types",               "ID");
+    LoadDB2(l_Loader, bad_db2_files, sPathNodeStore,                  db2Path, "PathNode.db2"                                                         );
+    LoadDB2(l_Loader, bad_db2_files, sLocationStore,                  db2Path, "Location.db2"                                                         );
+    LoadDB2(l_Loader, bad_db2_files, sAreaPOIStore,                   db2Path, "AreaPOI.db2"                                                          );
+    LoadDB2(l_Loader, bad_db2_files, sCurvePointStore,                db2Path, "CurvePoint.db2",                  "curve_point",                  "ID");
+    LoadDB2(l_Loader, bad_db2_files, sGroupFinderActivityStore,       db2Path, "GroupFinderActivity.db2"                                              );
+    LoadDB2(l_Loader, bad_db2_files, sGroupFinderCategoryStore,       db2Path, "GroupFinderCategory.db2"                                              );
+    LoadDB2(l_Loader, bad_db2_files, sHolidaysStore,                  db2Path, "Holidays.db2"                                                         );
+    LoadDB2(l_Loader, bad_db2_files, sMapChallengeModeStore,          db2Path, "MapChallengeMode.db2",            "map_challenge_mode",           "ID");
+    LoadDB2(l_Loader, bad_db2_files, sMountStore,                     db2Path, "Mount.db2",                       "mount",                        "ID");
+    LoadDB2(l_Loader, bad_db2_files, sMountTypeStore,                 db2Path, "MountType.db2",                   "mount_type",                   "ID");
+    LoadDB2(l_Loader, bad_db2_files, sMountCapabilityStore,           db2Path, "MountCapability.db2",             "mount_capability",             "ID");
+    LoadDB2(l_Loader, bad_db2_files, sMountTypeXCapabilityStore,      db2Path, "MountTypeXCapability.db2",        "mount_type_x_capability",      "ID");
+    LoadDB2(l_Loader, bad_db2_files, sPlayerConditionStore,           db2Path, "PlayerCondition.db2"                                                  );
+    LoadDB2(l_Loader, bad_db2_files, sVignetteStore,                  db2Path, "Vignette.db2"                                                         );
+    LoadDB2(l_Loader, bad_db2_files, sGlyphRequiredSpecStore,         db2Path, "GlyphRequiredSpec.db2"                                                );
+    LoadDB2(l_Loader, bad_db2_files, sQuestPOIPointStore,             db2Path, "QuestPOIPoint.db2"                                                    );
+    LoadDB2(l_Loader, bad_db2_files, sAreaGroupStore,                 db2Path, "AreaGroup.db2"                                                        );
+    LoadDB2(l_Loader, bad_db2_files, sAreaGroupMemberStore,           db2Path, "AreaGroupMember.db2"                                                  );
 
     //////////////////////////////////////////////////////////////////////////
     /// Quest DB2
     //////////////////////////////////////////////////////////////////////////
-    LoadDB2(bad_db2_files, sQuestPackageItemStore,          db2Path, "QuestPackageItem.db2",            "quest_package_item",           "ID");
-    LoadDB2(bad_db2_files, sQuestV2CliTaskStore,            db2Path, "QuestV2CliTask.db2"                                                   );
-    LoadDB2(bad_db2_files, sQuestPOIPointCliTaskStore,      db2Path, "QuestPOIPointCliTask.db2"                                             );
+    LoadDB2(l_Loader, bad_db2_files, sQuestPackageItemStore,          db2Path, "QuestPackageItem.db2",            "quest_package_item",           "ID");
+    LoadDB2(l_Loader, bad_db2_files, sQuestV2CliTaskStore,            db2Path, "QuestV2CliTask.db2"                                                   );
+    LoadDB2(l_Loader, bad_db2_files, sQuestPOIPointCliTaskStore,      db2Path, "QuestPOIPointCliTask.db2"                                             );
   
     //////////////////////////////////////////////////////////////////////////
     /// Scene Script DB2
     //////////////////////////////////////////////////////////////////////////
-    LoadDB2(bad_db2_files, sSceneScriptStore,               db2Path, "SceneScript.db2"                                                      );
-    LoadDB2(bad_db2_files, sSceneScriptPackageStore,        db2Path, "SceneScriptPackage.db2"                                               );
+    LoadDB2(l_Loader, bad_db2_files, sSceneScriptStore,               db2Path, "SceneScript.db2"                                                      );
+    LoadDB2(l_Loader, bad_db2_files, sSceneScriptPackageStore,        db2Path, "SceneScriptPackage.db2"                                               );
 
     //////////////////////////////////////////////////////////////////////////
     /// Taxi DB2
     //////////////////////////////////////////////////////////////////////////
-    LoadDB2(bad_db2_files, sTaxiNodesStore,                 db2Path, "TaxiNodes.db2"                                                        );
-    LoadDB2(bad_db2_files, sTaxiPathStore,                  db2Path, "TaxiPath.db2"                                                         );
-    LoadDB2(bad_db2_files, sTaxiPathNodeStore,              db2Path, "TaxiPathNode.db2"                                                     );
+    LoadDB2(l_Loader, bad_db2_files, sTaxiNodesStore,                 db2Path, "TaxiNodes.db2"                                                        );
+    LoadDB2(l_Loader, bad_db2_files, sTaxiPathStore,                  db2Path, "TaxiPath.db2"                                                         );
+    LoadDB2(l_Loader, bad_db2_files, sTaxiPathNodeStore,              db2Path, "TaxiPathNode.db2"                                                     );
 
     //////////////////////////////////////////////////////////////////////////
     /// Item DB2
     //////////////////////////////////////////////////////////////////////////
-    LoadDB2(bad_db2_files, sItemStore,                      db2Path, "Item.db2",                        "item",                         "ID");
-    LoadDB2(bad_db2_files, sItemCurrencyCostStore,          db2Path, "ItemCurrencyCost.db2",            "item_currency_cost",           "ID");
-    LoadDB2(bad_db2_files, sItemSparseStore,                db2Path, "Item-sparse.db2",                 "item_sparse",                  "ID");
-    LoadDB2(bad_db2_files, sItemEffectStore,                db2Path, "ItemEffect.db2",                  "item_effect",                  "ID");
-    LoadDB2(bad_db2_files, sItemModifiedAppearanceStore,    db2Path, "ItemModifiedAppearance.db2",      "item_modified_appearance",     "ID");
-    LoadDB2(bad_db2_files, sItemAppearanceStore,            db2Path, "ItemAppearance.db2",              "item_appearance",              "ID");
-    LoadDB2(bad_db2_files, sItemExtendedCostStore,          db2Path, "ItemExtendedCost.db2",            "item_extended_cost",           "ID");
-    LoadDB2(bad_db2_files, sHeirloomStore,                  db2Path, "Heirloom.db2"                                                         );
-    LoadDB2(bad_db2_files, sPvpItemStore,                   db2Path, "PvpItem.db2",                     "pvp_item",                     "ID");
+    LoadDB2(l_Loader, bad_db2_files, sItemStore,                      db2Path, "Item.db2",                        "item",                         "ID");
+    LoadDB2(l_Loader, bad_db2_files, sItemCurrencyCostStore,          db2Path, "ItemCurrencyCost.db2",            "item_currency_cost",           "ID");
+    LoadDB2(l_Loader, bad_db2_files, sItemSparseStore,                db2Path, "Item-sparse.db2",                 "item_sparse",                  "ID");
+    LoadDB2(l_Loader, bad_db2_files, sItemEffectStore,                db2Path, "ItemEffect.db2",                  "item_effect",                  "ID");
+    LoadDB2(l_Loader, bad_db2_files, sItemModifiedAppearanceStore,    db2Path, "ItemModifiedAppearance.db2",      "item_modified_appearance",     "ID");
+    LoadDB2(l_Loader, bad_db2_files, sItemAppearanceStore,            db2Path, "ItemAppearance.db2",              "item_appearance",              "ID");
+    LoadDB2(l_Loader, bad_db2_files, sItemExtendedCostStore,          db2Path, "ItemExtendedCost.db2",            "item_extended_cost",           "ID");
+    LoadDB2(l_Loader, bad_db2_files, sHeirloomStore,                  db2Path, "Heirloom.db2"                                                         );
+    LoadDB2(l_Loader, bad_db2_files, sPvpItemStore,                   db2Path, "PvpItem.db2",                     "pvp_item",                     "ID");
+
+    l_Loader.Run();
 
     for (uint32 l_I = 0; l_I < sPvpItemStore.GetNumRows(); ++l_I)
     {
@@ -362,119 +381,121 @@ void LoadDB2Stores(const std::string& dataPath)
             g_PvPItemStoreLevels[l_Entry->itemId] = l_Entry->ilvl;
     }
 
-    LoadDB2(bad_db2_files, sItemUpgradeStore,               db2Path, "ItemUpgrade.db2"                                                      );
-    LoadDB2(bad_db2_files, sRulesetItemUpgradeStore,        db2Path, "RulesetItemUpgrade.db2"                                               );
+    LoadDB2(l_Loader, bad_db2_files, sItemUpgradeStore,               db2Path, "ItemUpgrade.db2"                                                      );
+    LoadDB2(l_Loader, bad_db2_files, sRulesetItemUpgradeStore,        db2Path, "RulesetItemUpgrade.db2"                                               );
 
     //////////////////////////////////////////////////////////////////////////
     /// Item Bonus DB2
     //////////////////////////////////////////////////////////////////////////
-    LoadDB2(bad_db2_files, sItemBonusStore,                 db2Path, "ItemBonus.db2",                   "item_bonus",                   "ID");
-    LoadDB2(bad_db2_files, sItemBonusTreeNodeStore,         db2Path, "ItemBonusTreeNode.db2",           "item_bonus_tree_node",         "ID");
-    LoadDB2(bad_db2_files, sItemXBonusTreeStore,            db2Path, "ItemXBonusTree.db2",              "item_x_bonus_tree",            "ID");
+    LoadDB2(l_Loader, bad_db2_files, sItemBonusStore,                 db2Path, "ItemBonus.db2",                   "item_bonus",                   "ID");
+    LoadDB2(l_Loader, bad_db2_files, sItemBonusTreeNodeStore,         db2Path, "ItemBonusTreeNode.db2",           "item_bonus_tree_node",         "ID");
+    LoadDB2(l_Loader, bad_db2_files, sItemXBonusTreeStore,            db2Path, "ItemXBonusTree.db2",              "item_x_bonus_tree",            "ID");
 
     //////////////////////////////////////////////////////////////////////////
     /// Spell DB2
     //////////////////////////////////////////////////////////////////////////
-    LoadDB2(bad_db2_files, sSpellEffectGroupSizeStore,      db2Path, "SpellEffectGroupSize.db2",        "spell_effect_group_size",      "ID");
-    LoadDB2(bad_db2_files, sSpellReagentsStore,             db2Path, "SpellReagents.db2"                                                    );
-    LoadDB2(bad_db2_files, sSpellReagentsCurrencyStore,     db2Path, "SpellReagentsCurrency.db2"                                            );
-    LoadDB2(bad_db2_files, sSpellRuneCostStore,             db2Path, "SpellRuneCost.db2"                                                    );
-    LoadDB2(bad_db2_files, sSpellCastingRequirementsStore,  db2Path, "SpellCastingRequirements.db2",    "spell_casting_requirements",   "ID");
-    LoadDB2(bad_db2_files, sSpellAuraRestrictionsStore,     db2Path, "SpellAuraRestrictions.db2",       "spell_aura_restrictions",      "ID");
-    LoadDB2(bad_db2_files, sOverrideSpellDataStore,         db2Path, "OverrideSpellData.db2"                                                );
-    LoadDB2(bad_db2_files, sSpellMiscStore,                 db2Path, "SpellMisc.db2",                   "spell_misc",                   "ID");
-    LoadDB2(bad_db2_files, sSpellPowerStore,                db2Path, "SpellPower.db2"                                                       );
-    LoadDB2(bad_db2_files, sSpellTotemsStore,               db2Path, "SpellTotems.db2"                                                      );
-    LoadDB2(bad_db2_files, sSpellClassOptionsStore,         db2Path, "SpellClassOptions.db2"                                                );
-    LoadDB2(bad_db2_files, sSpellXSpellVisualStore,         db2Path, "SpellXSpellVisual.db2"                                                );
+    LoadDB2(l_Loader, bad_db2_files, sSpellEffectGroupSizeStore,      db2Path, "SpellEffectGroupSize.db2",        "spell_effect_group_size",      "ID");
+    LoadDB2(l_Loader, bad_db2_files, sSpellReagentsStore,             db2Path, "SpellReagents.db2"                                                    );
+    LoadDB2(l_Loader, bad_db2_files, sSpellReagentsCurrencyStore,     db2Path, "SpellReagentsCurrency.db2"                                            );
+    LoadDB2(l_Loader, bad_db2_files, sSpellRuneCostStore,             db2Path, "SpellRuneCost.db2"                                                    );
+    LoadDB2(l_Loader, bad_db2_files, sSpellCastingRequirementsStore,  db2Path, "SpellCastingRequirements.db2",    "spell_casting_requirements",   "ID");
+    LoadDB2(l_Loader, bad_db2_files, sSpellAuraRestrictionsStore,     db2Path, "SpellAuraRestrictions.db2",       "spell_aura_restrictions",      "ID");
+    LoadDB2(l_Loader, bad_db2_files, sOverrideSpellDataStore,         db2Path, "OverrideSpellData.db2"                                                );
+    LoadDB2(l_Loader, bad_db2_files, sSpellMiscStore,                 db2Path, "SpellMisc.db2",                   "spell_misc",                   "ID");
+    LoadDB2(l_Loader, bad_db2_files, sSpellPowerStore,                db2Path, "SpellPower.db2"                                                       );
+    LoadDB2(l_Loader, bad_db2_files, sSpellTotemsStore,               db2Path, "SpellTotems.db2"                                                      );
+    LoadDB2(l_Loader, bad_db2_files, sSpellClassOptionsStore,         db2Path, "SpellClassOptions.db2"                                                );
+    LoadDB2(l_Loader, bad_db2_files, sSpellXSpellVisualStore,         db2Path, "SpellXSpellVisual.db2"                                                );
 
     //////////////////////////////////////////////////////////////////////////
     /// Garrison DB2
     //////////////////////////////////////////////////////////////////////////
-    LoadDB2(bad_db2_files, sGarrSiteLevelStore,             db2Path, "GarrSiteLevel.db2"                                                    );
-    LoadDB2(bad_db2_files, sGarrSiteLevelPlotInstStore,     db2Path, "GarrSiteLevelPlotInst.db2"                                            );
-    LoadDB2(bad_db2_files, sGarrPlotInstanceStore,          db2Path, "GarrPlotInstance.db2"                                                 );
-    LoadDB2(bad_db2_files, sGarrPlotStore,                  db2Path, "GarrPlot.db2"                                                         );
-    LoadDB2(bad_db2_files, sGarrPlotUICategoryStore,        db2Path, "GarrPlotUICategory.db2"                                               );
-    LoadDB2(bad_db2_files, sGarrMissionStore,               db2Path, "GarrMission.db2"                                                      );
-    LoadDB2(bad_db2_files, sGarrMissionRewardStore,         db2Path, "GarrMissionReward.db2"                                                );
-    LoadDB2(bad_db2_files, sGarrMissionXEncouterStore,      db2Path, "GarrMissionXEncounter.db2"                                            );
-    LoadDB2(bad_db2_files, sGarrBuildingStore,              db2Path, "GarrBuilding.db2"                                                     );
-    LoadDB2(bad_db2_files, sGarrPlotBuildingStore,          db2Path, "GarrPlotBuilding.db2"                                                 );
-    LoadDB2(bad_db2_files, sGarrFollowerStore,              db2Path, "GarrFollower.db2"                                                     );
-    LoadDB2(bad_db2_files, sGarrFollowerTypeStore,          db2Path, "GarrFollowerType.db2"                                                 );
-    LoadDB2(bad_db2_files, sGarrAbilityStore,               db2Path, "GarrAbility.db2",                  "garr_ability",                "ID");
-    LoadDB2(bad_db2_files, sGarrAbilityEffectStore,         db2Path, "GarrAbilityEffect.db2"                                                );
-    LoadDB2(bad_db2_files, sGarrFollowerXAbilityStore,      db2Path, "GarrFollowerXAbility.db2"                                             );
-    LoadDB2(bad_db2_files, sGarrBuildingPlotInstStore,      db2Path, "GarrBuildingPlotInst.db2"                                             );
-    LoadDB2(bad_db2_files, sGarrMechanicTypeStore,          db2Path, "GarrMechanicType.db2"                                                 );
-    LoadDB2(bad_db2_files, sGarrMechanicStore,              db2Path, "GarrMechanic.db2"                                                     );
-    LoadDB2(bad_db2_files, sGarrEncouterXMechanicStore,     db2Path, "GarrEncounterXMechanic.db2"                                           );
-    LoadDB2(bad_db2_files, sGarrFollowerLevelXPStore,       db2Path, "GarrFollowerLevelXP.db2"                                              );
-    LoadDB2(bad_db2_files, sGarrSpecializationStore,        db2Path, "GarrSpecialization.db2"                                               );
-    LoadDB2(bad_db2_files, sCharShipmentStore,              db2Path, "CharShipment.db2"                                                     );
-    LoadDB2(bad_db2_files, sCharShipmentContainerStore,     db2Path, "CharShipmentContainer.db2"                                            );
+    LoadDB2(l_Loader, bad_db2_files, sGarrSiteLevelStore,             db2Path, "GarrSiteLevel.db2"                                                    );
+    LoadDB2(l_Loader, bad_db2_files, sGarrSiteLevelPlotInstStore,     db2Path, "GarrSiteLevelPlotInst.db2"                                            );
+    LoadDB2(l_Loader, bad_db2_files, sGarrPlotInstanceStore,          db2Path, "GarrPlotInstance.db2"                                                 );
+    LoadDB2(l_Loader, bad_db2_files, sGarrPlotStore,                  db2Path, "GarrPlot.db2"                                                         );
+    LoadDB2(l_Loader, bad_db2_files, sGarrPlotUICategoryStore,        db2Path, "GarrPlotUICategory.db2"                                               );
+    LoadDB2(l_Loader, bad_db2_files, sGarrMissionStore,               db2Path, "GarrMission.db2"                                                      );
+    LoadDB2(l_Loader, bad_db2_files, sGarrMissionRewardStore,         db2Path, "GarrMissionReward.db2"                                                );
+    LoadDB2(l_Loader, bad_db2_files, sGarrMissionXEncouterStore,      db2Path, "GarrMissionXEncounter.db2"                                            );
+    LoadDB2(l_Loader, bad_db2_files, sGarrBuildingStore,              db2Path, "GarrBuilding.db2"                                                     );
+    LoadDB2(l_Loader, bad_db2_files, sGarrPlotBuildingStore,          db2Path, "GarrPlotBuilding.db2"                                                 );
+    LoadDB2(l_Loader, bad_db2_files, sGarrFollowerStore,              db2Path, "GarrFollower.db2"                                                     );
+    LoadDB2(l_Loader, bad_db2_files, sGarrFollowerTypeStore,          db2Path, "GarrFollowerType.db2"                                                 );
+    LoadDB2(l_Loader, bad_db2_files, sGarrAbilityStore,               db2Path, "GarrAbility.db2",                  "garr_ability",                "ID");
+    LoadDB2(l_Loader, bad_db2_files, sGarrAbilityEffectStore,         db2Path, "GarrAbilityEffect.db2"                                                );
+    LoadDB2(l_Loader, bad_db2_files, sGarrFollowerXAbilityStore,      db2Path, "GarrFollowerXAbility.db2"                                             );
+    LoadDB2(l_Loader, bad_db2_files, sGarrBuildingPlotInstStore,      db2Path, "GarrBuildingPlotInst.db2"                                             );
+    LoadDB2(l_Loader, bad_db2_files, sGarrMechanicTypeStore,          db2Path, "GarrMechanicType.db2"                                                 );
+    LoadDB2(l_Loader, bad_db2_files, sGarrMechanicStore,              db2Path, "GarrMechanic.db2"                                                     );
+    LoadDB2(l_Loader, bad_db2_files, sGarrEncouterXMechanicStore,     db2Path, "GarrEncounterXMechanic.db2"                                           );
+    LoadDB2(l_Loader, bad_db2_files, sGarrFollowerLevelXPStore,       db2Path, "GarrFollowerLevelXP.db2"                                              );
+    LoadDB2(l_Loader, bad_db2_files, sGarrSpecializationStore,        db2Path, "GarrSpecialization.db2"                                               );
+    LoadDB2(l_Loader, bad_db2_files, sCharShipmentStore,              db2Path, "CharShipment.db2"                                                     );
+    LoadDB2(l_Loader, bad_db2_files, sCharShipmentContainerStore,     db2Path, "CharShipmentContainer.db2"                                            );
 
     //////////////////////////////////////////////////////////////////////////
     /// Battle pet DB2
     //////////////////////////////////////////////////////////////////////////
-    LoadDB2(bad_db2_files, sBattlePetAbilityStore,          db2Path, "BattlePetAbility.db2"                                                 );
-    LoadDB2(bad_db2_files, sBattlePetAbilityEffectStore,    db2Path, "BattlePetAbilityEffect.db2"                                           );
-    LoadDB2(bad_db2_files, sBattlePetAbilityTurnStore,      db2Path, "BattlePetAbilityTurn.db2"                                             );
-    LoadDB2(bad_db2_files, sBattlePetAbilityStateStore,     db2Path, "BattlePetAbilityState.db2"                                            );
-    LoadDB2(bad_db2_files, sBattlePetStateStore,            db2Path, "BattlePetState.db2"                                                   );
-    LoadDB2(bad_db2_files, sBattlePetEffectPropertiesStore, db2Path, "BattlePetEffectProperties.db2"                                        );
-    LoadDB2(bad_db2_files, sBattlePetBreedQualityStore,     db2Path, "BattlePetBreedQuality.db2"                                            );
-    LoadDB2(bad_db2_files, sBattlePetBreedStateStore,       db2Path, "BattlePetBreedState.db2"                                              );
-    LoadDB2(bad_db2_files, sBattlePetSpeciesStore,          db2Path, "BattlePetSpecies.db2",            "battle_pet_species",           "ID");
-    LoadDB2(bad_db2_files, sBattlePetSpeciesStateStore,     db2Path, "BattlePetSpeciesState.db2"                                            );
-    LoadDB2(bad_db2_files, sBattlePetSpeciesXAbilityStore,  db2Path, "BattlePetSpeciesXAbility.db2"                                         );
-
-    LoadDB2(bad_db2_files,  sAuctionHouseStore,           db2Path, "AuctionHouse.db2");                                                 // 17399
-    LoadDB2(bad_db2_files,  sBarberShopStyleStore,        db2Path, "BarberShopStyle.db2");                                              // 17399
-    LoadDB2(bad_db2_files,  sCharStartOutfitStore,        db2Path, "CharStartOutfit.db2");                                              // 17399
-    LoadDB2(bad_db2_files,  sChrClassXPowerTypesStore,    db2Path, "ChrClassesXPowerTypes.db2");                                        // 17399
-    LoadDB2(bad_db2_files,  sCinematicSequencesStore,     db2Path, "CinematicSequences.db2");                                           // 17399
-    LoadDB2(bad_db2_files,  sCreatureDisplayInfoStore,    db2Path, "CreatureDisplayInfo.db2");                                          // 17399
-    LoadDB2(bad_db2_files,  sCreatureTypeStore,           db2Path, "CreatureType.db2");                                                 // 17399
-    LoadDB2(bad_db2_files,  sDestructibleModelDataStore,  db2Path, "DestructibleModelData.db2");                                        // 17399
-    LoadDB2(bad_db2_files,  sDurabilityQualityStore,      db2Path, "DurabilityQuality.db2");                                            // 17399
-    LoadDB2(bad_db2_files,  sGlyphSlotStore,              db2Path, "GlyphSlot.db2");                                                    // 19027
-    LoadDB2(bad_db2_files,  sGuildPerkSpellsStore,        db2Path, "GuildPerkSpells.db2");                                              // 17399
-    LoadDB2(bad_db2_files,  sImportPriceArmorStore,       db2Path, "ImportPriceArmor.db2");                                             // 17399
-    LoadDB2(bad_db2_files,  sImportPriceQualityStore,     db2Path, "ImportPriceQuality.db2");                                           // 17399
-    LoadDB2(bad_db2_files,  sImportPriceShieldStore,      db2Path, "ImportPriceShield.db2");                                            // 17399
-    LoadDB2(bad_db2_files,  sImportPriceWeaponStore,      db2Path, "ImportPriceWeapon.db2");                                            // 17399
-    LoadDB2(bad_db2_files,  sItemPriceBaseStore,          db2Path, "ItemPriceBase.db2");                                                // 17399
-    LoadDB2(bad_db2_files,  sItemClassStore,              db2Path, "ItemClass.db2");                                                    // 17399
-    LoadDB2(bad_db2_files,  sItemLimitCategoryStore,      db2Path, "ItemLimitCategory.db2");                                            // 17399
-    LoadDB2(bad_db2_files,  sItemRandomPropertiesStore,   db2Path, "ItemRandomProperties.db2");                                         // 17399
-    LoadDB2(bad_db2_files,  sItemRandomSuffixStore,       db2Path, "ItemRandomSuffix.db2");                                             // 17399
-    LoadDB2(bad_db2_files,  sItemSpecOverrideStore,       db2Path, "ItemSpecOverride.db2", "item_spec_override","ID");                  // 17399
-    LoadDB2(bad_db2_files,  sItemSpecStore,               db2Path, "ItemSpec.db2");                                                     // 19116
-    LoadDB2(bad_db2_files,  sItemDisenchantLootStore,     db2Path, "ItemDisenchantLoot.db2");                                           // 17399
-    LoadDB2(bad_db2_files,  sNameGenStore,                db2Path, "NameGen.db2");                                                      // 17399
-    LoadDB2(bad_db2_files,  sQuestV2Store,                db2Path, "QuestV2.db2");                                                      // 19342
-    LoadDB2(bad_db2_files,  sQuestXPStore,                db2Path, "QuestXP.db2");                                                      // 17399
-    LoadDB2(bad_db2_files,  sQuestSortStore,              db2Path, "QuestSort.db2");                                                    // 17399
-    LoadDB2(bad_db2_files,  sResearchBranchStore,         db2Path, "ResearchBranch.db2");                                               // 17399
-    LoadDB2(bad_db2_files,  sResearchProjectStore,        db2Path, "ResearchProject.db2");                                              // 17399
-    LoadDB2(bad_db2_files,  sResearchSiteStore,           db2Path, "ResearchSite.db2");
-    LoadDB2(bad_db2_files,  sScalingStatDistributionStore,db2Path, "ScalingStatDistribution.db2");                                      // 17399
-    LoadDB2(bad_db2_files,  sScenarioStore,               db2Path, "Scenario.db2");                                                     // 19027
-    LoadDB2(bad_db2_files,  sSpellProcsPerMinuteStore,    db2Path,"SpellProcsPerMinute.db2", "spell_procs_per_minute", "ID");
-    LoadDB2(bad_db2_files,  sSpellProcsPerMinuteModStore, db2Path,"SpellProcsPerMinuteMod.db2", "spell_procs_per_minute_mod", "ID");
-    LoadDB2(bad_db2_files,  sSpellCastTimesStore,         db2Path, "SpellCastTimes.db2");                                               // 17399
-    LoadDB2(bad_db2_files,  sSpellDurationStore,          db2Path, "SpellDuration.db2");                                                // 17399
-    LoadDB2(bad_db2_files,  sSpellItemEnchantmentConditionStore, db2Path, "SpellItemEnchantmentCondition.db2");                         // 17399
-    LoadDB2(bad_db2_files,  sSpellRadiusStore,            db2Path, "SpellRadius.db2");                                                  // 17399
-    LoadDB2(bad_db2_files,  sSpellRangeStore,             db2Path, "SpellRange.db2");                                                   // 17399
-    LoadDB2(bad_db2_files,  sTotemCategoryStore,          db2Path, "TotemCategory.db2");                                                // 17399
-    LoadDB2(bad_db2_files,  sTransportAnimationStore,     db2Path, "TransportAnimation.db2");
-    LoadDB2(bad_db2_files,  sTransportRotationStore,      db2Path, "TransportRotation.db2");
-    LoadDB2(bad_db2_files,  sWorldMapOverlayStore,        db2Path, "WorldMapOverlay.db2");                                              // 17399
-    LoadDB2(bad_db2_files,  sMailTemplateStore,           db2Path, "MailTemplate.db2");                                                 // 17399
-    LoadDB2(bad_db2_files,  sSpecializationSpellStore,    db2Path, "SpecializationSpells.db2");                                         // 17399
+    LoadDB2(l_Loader, bad_db2_files, sBattlePetAbilityStore,          db2Path, "BattlePetAbility.db2"                                                 );
+    LoadDB2(l_Loader, bad_db2_files, sBattlePetAbilityEffectStore,    db2Path, "BattlePetAbilityEffect.db2"                                           );
+    LoadDB2(l_Loader, bad_db2_files, sBattlePetAbilityTurnStore,      db2Path, "BattlePetAbilityTurn.db2"                                             );
+    LoadDB2(l_Loader, bad_db2_files, sBattlePetAbilityStateStore,     db2Path, "BattlePetAbilityState.db2"                                            );
+    LoadDB2(l_Loader, bad_db2_files, sBattlePetStateStore,            db2Path, "BattlePetState.db2"                                                   );
+    LoadDB2(l_Loader, bad_db2_files, sBattlePetEffectPropertiesStore, db2Path, "BattlePetEffectProperties.db2"                                        );
+    LoadDB2(l_Loader, bad_db2_files, sBattlePetBreedQualityStore,     db2Path, "BattlePetBreedQuality.db2"                                            );
+    LoadDB2(l_Loader, bad_db2_files, sBattlePetBreedStateStore,       db2Path, "BattlePetBreedState.db2"                                              );
+    LoadDB2(l_Loader, bad_db2_files, sBattlePetSpeciesStore,          db2Path, "BattlePetSpecies.db2",            "battle_pet_species",           "ID");
+    LoadDB2(l_Loader, bad_db2_files, sBattlePetSpeciesStateStore,     db2Path, "BattlePetSpeciesState.db2"                                            );
+    LoadDB2(l_Loader, bad_db2_files, sBattlePetSpeciesXAbilityStore,  db2Path, "BattlePetSpeciesXAbility.db2"                                         );
+
+    LoadDB2(l_Loader, bad_db2_files, sAuctionHouseStore,           db2Path, "AuctionHouse.db2");                                                 // 17399
+    LoadDB2(l_Loader, bad_db2_files, sBarberShopStyleStore,        db2Path, "BarberShopStyle.db2");                                              // 17399
+    LoadDB2(l_Loader, bad_db2_files, sCharStartOutfitStore,        db2Path, "CharStartOutfit.db2");                                              // 17399
+    LoadDB2(l_Loader, bad_db2_files, sChrClassXPowerTypesStore,    db2Path, "ChrClassesXPowerTypes.db2");                                        // 17399
+    LoadDB2(l_Loader, bad_db2_files, sCinematicSequencesStore,     db2Path, "CinematicSequences.db2");                                           // 17399
+    LoadDB2(l_Loader, bad_db2_files, sCreatureDisplayInfoStore,    db2Path, "CreatureDisplayInfo.db2");                                          // 17399
+    LoadDB2(l_Loader, bad_db2_files, sCreatureTypeStore,           db2Path, "CreatureType.db2");                                                 // 17399
+    LoadDB2(l_Loader, bad_db2_files, sDestructibleModelDataStore,  db2Path, "DestructibleModelData.db2");                                        // 17399
+    LoadDB2(l_Loader, bad_db2_files, sDurabilityQualityStore,      db2Path, "DurabilityQuality.db2");                                            // 17399
+    LoadDB2(l_Loader, bad_db2_files, sGlyphSlotStore,              db2Path, "GlyphSlot.db2");                                                    // 19027
+    LoadDB2(l_Loader, bad_db2_files, sGuildPerkSpellsStore,        db2Path, "GuildPerkSpells.db2");                                              // 17399
+    LoadDB2(l_Loader, bad_db2_files, sImportPriceArmorStore,       db2Path, "ImportPriceArmor.db2");                                             // 17399
+    LoadDB2(l_Loader, bad_db2_files, sImportPriceQualityStore,     db2Path, "ImportPriceQuality.db2");                                           // 17399
+    LoadDB2(l_Loader, bad_db2_files, sImportPriceShieldStore,      db2Path, "ImportPriceShield.db2");                                            // 17399
+    LoadDB2(l_Loader, bad_db2_files, sImportPriceWeaponStore,      db2Path, "ImportPriceWeapon.db2");                                            // 17399
+    LoadDB2(l_Loader, bad_db2_files, sItemPriceBaseStore,          db2Path, "ItemPriceBase.db2");                                                // 17399
+    LoadDB2(l_Loader, bad_db2_files, sItemClassStore,              db2Path, "ItemClass.db2");                                                    // 17399
+    LoadDB2(l_Loader, bad_db2_files, sItemLimitCategoryStore,      db2Path, "ItemLimitCategory.db2");                                            // 17399
+    LoadDB2(l_Loader, bad_db2_files, sItemRandomPropertiesStore,   db2Path, "ItemRandomProperties.db2");                                         // 17399
+    LoadDB2(l_Loader, bad_db2_files, sItemRandomSuffixStore,       db2Path, "ItemRandomSuffix.db2");                                             // 17399
+    LoadDB2(l_Loader, bad_db2_files, sItemSpecOverrideStore,       db2Path, "ItemSpecOverride.db2", "item_spec_override","ID");                  // 17399
+    LoadDB2(l_Loader, bad_db2_files, sItemSpecStore,               db2Path, "ItemSpec.db2");                                                     // 19116
+    LoadDB2(l_Loader, bad_db2_files, sItemDisenchantLootStore,     db2Path, "ItemDisenchantLoot.db2");                                           // 17399
+    LoadDB2(l_Loader, bad_db2_files, sNameGenStore,                db2Path, "NameGen.db2");                                                      // 17399
+    LoadDB2(l_Loader, bad_db2_files, sQuestV2Store,                db2Path, "QuestV2.db2");                                                      // 19342
+    LoadDB2(l_Loader, bad_db2_files, sQuestXPStore,                db2Path, "QuestXP.db2");                                                      // 17399
+    LoadDB2(l_Loader, bad_db2_files, sQuestSortStore,              db2Path, "QuestSort.db2");                                                    // 17399
+    LoadDB2(l_Loader, bad_db2_files, sResearchBranchStore,         db2Path, "ResearchBranch.db2");                                               // 17399
+    LoadDB2(l_Loader, bad_db2_files, sResearchProjectStore,        db2Path, "ResearchProject.db2");                                              // 17399
+    LoadDB2(l_Loader, bad_db2_files, sResearchSiteStore,           db2Path, "ResearchSite.db2");
+    LoadDB2(l_Loader, bad_db2_files, sScalingStatDistributionStore,db2Path, "ScalingStatDistribution.db2");                                      // 17399
+    LoadDB2(l_Loader, bad_db2_files, sScenarioStore,               db2Path, "Scenario.db2");                                                     // 19027
+    LoadDB2(l_Loader, bad_db2_files, sSpellProcsPerMinuteStore,    db2Path,"SpellProcsPerMinute.db2", "spell_procs_per_minute", "ID");
+    LoadDB2(l_Loader, bad_db2_files, sSpellProcsPerMinuteModStore, db2Path,"SpellProcsPerMinuteMod.db2", "spell_procs_per_minute_mod", "ID");
+    LoadDB2(l_Loader, bad_db2_files, sSpellCastTimesStore,         db2Path, "SpellCastTimes.db2");                                               // 17399
+    LoadDB2(l_Loader, bad_db2_files, sSpellDurationStore,          db2Path, "SpellDuration.db2");                                                // 17399
+    LoadDB2(l_Loader, bad_db2_files, sSpellItemEnchantmentConditionStore, db2Path, "SpellItemEnchantmentCondition.db2");                         // 17399
+    LoadDB2(l_Loader, bad_db2_files, sSpellRadiusStore,            db2Path, "SpellRadius.db2");                                                  // 17399
+    LoadDB2(l_Loader, bad_db2_files, sSpellRangeStore,             db2Path, "SpellRange.db2");                                                   // 17399
+    LoadDB2(l_Loader, bad_db2_files, sTotemCategoryStore,          db2Path, "TotemCategory.db2");                                                // 17399
+    LoadDB2(l_Loader, bad_db2_files, sTransportAnimationStore,     db2Path, "TransportAnimation.db2");
+    LoadDB2(l_Loader, bad_db2_files, sTransportRotationStore,      db2Path, "TransportRotation.db2");
+    LoadDB2(l_Loader, bad_db2_files, sWorldMapOverlayStore,        db2Path, "WorldMapOverlay.db2");                                              // 17399
+    LoadDB2(l_Loader, bad_db2_files, sMailTemplateStore,           db2Path, "MailTemplate.db2");                                                 // 17399
+    LoadDB2(l_Loader, bad_db2_files, sSpecializationSpellStore,    db2Path, "SpecializationSpells.db2");                                         // 17399
+
+    l_Loader.Run();
 
     sPowersByClassStore.resize(MAX_CLASSES);
 
@@ -521,8 +542,10 @@ void LoadDB2Stores(const std::string& dataPath)
     //////////////////////////////////////////////////////////////////////////
     /// WebBrowser DB2
     //////////////////////////////////////////////////////////////////////////
-    LoadDB2(bad_db2_files, sWbAccessControlListStore,       db2Path, "WbAccessControlList.db2",          "wb_access_control_list",      "ID");
-    LoadDB2(bad_db2_files, sWbCertWhitelistStore,           db2Path, "WbCertWhitelist.db2",              "wb_cert_whitelist",           "ID");
+    LoadDB2(l_Loader, bad_db2_files, sWbAccessControlListStore,       db2Path, "WbAccessControlList.db2",          "wb_access_control_list",      "ID");
+    LoadDB2(l_Loader, bad_db2_files, sWbCertWhitelistStore,           db2Path, "WbCertWhitelist.db2",              "wb_cert_whitelist",           "ID");
+
+    l_Loader.Run();
 
     std::set<uint32> scalingCurves;
     for (uint32 i = 0; i < sScalingStatDistributionStore.GetNumRows(); ++i)
@@ -804,6 +827,7 @@ void LoadDB2Stores(const std::string& dataPath)
         exit(1);
     }
     sLog->outInfo(LOG_FILTER_GENERAL, ">> Initialized %d DB2 data stores.", DB2FilesCount);
+    l_Loader.LogTimings(5);
 }
 
 std::vector<ItemBonusEntry const*> const* GetItemBonusesByID(uint32 Id)
@@ -293,13 +293,12 @@ void LFGMgr::Update(uint32 diff)
             firstNew.push_back(frontguid);
             newToQueue.pop_front();
             uint8 alreadyInQueue = 0;
-            LfgGuidList temporalList = currentQueue;
-            if (LfgProposal* pProposal = FindNewGroups(firstNew, temporalList, LFG_CATEGORIE_DUNGEON)) // Group found!
+            if (LfgProposal* pProposal = FindNewGroups(firstNew, queueId, LFG_CATEGORIE_DUNGEON)) // Group found!
             {
                 // Remove groups in the proposal from new and current queues (not from queue map)
                 for (LfgGuidList::const_iterator itQueue = pProposal->queues.begin(); itQueue != pProposal->queues.end(); ++itQueue)
                 {
-                    currentQueue.remove(*itQueue);
+                    RemoveFromCurrentQueue(*itQueue);
                     newToQueue.remove(*itQueue);
                 }
                 m_Proposals[++m_lfgProposalId] = pProposal;
@@ -331,16 +330,14 @@ void LFGMgr::Update(uint32 diff)
             {
                 if (std::find(currentQueue.begin(), currentQueue.end(), frontguid) == currentQueue.end()) //already in queue?
                     ++alreadyInQueue; //currentQueue.push_back(frontguid);         // Lfg group not found, add this group to the queue.
-                temporalList = currentQueue;
-                m_CompatibleMap.clear();
             }
 
-            if (LfgProposal* pProposal = FindNewGroups(firstNew, temporalList, LFG_CATEGORIE_RAID)) // Group found!
+            if (LfgProposal* pProposal = FindNewGroups(firstNew, queueId, LFG_CATEGORIE_RAID)) // Group found!
             {
                 // Remove groups in the proposal from new and current queues (not from queue map)
                 for (LfgGuidList::const_iterator itQueue = pProposal->queues.begin(); itQueue != pProposal->queues.end(); ++itQueue)
                 {
-                    currentQueue.remove(*itQueue);
+                    RemoveFromCurrentQueue(*itQueue);
                     newToQueue.remove(*itQueue);
                 }
                 m_Proposals[++m_lfgProposalId] = pProposal;
@@ -372,16 +369,14 @@ void LFGMgr::Update(uint32 diff)
             {
                 if (std::find(currentQueue.begin(), currentQueue.end(), frontguid) == currentQueue.end()) //already in queue?
                     ++alreadyInQueue; //currentQueue.push_back(frontguid);         // Lfg group not found, add this group to the queue.
-                temporalList = currentQueue;
-                m_CompatibleMap.clear();
             }
 
-            if (LfgProposal* pProposal = FindNewGroups(firstNew, temporalList, LFG_CATEGORIE_SCENARIO)) // Group found!
+            if (LfgProposal* pProposal = FindNewGroups(firstNew, queueId, LFG_CATEGORIE_SCENARIO)) // Group found!
             {
                 // Remove groups in the proposal from new and current queues (not from queue map)
                 for (LfgGuidList::const_iterator itQueue = pProposal->queues.begin(); itQueue != pProposal->queues.end(); ++itQueue)
                 {
-                    currentQueue.remove(*itQueue);
+                    RemoveFromCurrentQueue(*itQueue);
                     newToQueue.remove(*itQueue);
                 }
                 m_Proposals[++m_lfgProposalId] = pProposal;
@@ -413,7 +408,6 @@ void LFGMgr::Update(uint32 diff)
             {
                 if (std::find(currentQueue.begin(), currentQueue.end(), frontguid) == currentQueue.end()) //already in queue?
                     ++alreadyInQueue; //currentQueue.push_back(frontguid);         // Lfg group not found, add this group to the queue.
-                temporalList = currentQueue;
             }
 
             if (LfgProposal* pProposal = CheckForSingle(firstNew)) // Group found!
@@ -421,7 +415,7 @@ void LFGMgr::Update(uint32 diff)
                 // Remove groups in the proposal from new and current queues (not from queue map)
                 for (LfgGuidList::const_iterator itQueue = pProposal->queues.begin(); itQueue != pProposal->queues.end(); ++itQueue)
                 {
-                    currentQueue.remove(*itQueue);
+                    RemoveFromCurrentQueue(*itQueue);
                     newToQueue.remove(*itQueue);
                 }
                 m_Proposals[++m_lfgProposalId] = pProposal;
@@ -453,11 +447,10 @@ void LFGMgr::Update(uint32 diff)
             {
                 if (std::find(currentQueue.begin(), currentQueue.end(), frontguid) == currentQueue.end()) //already in queue?
                     ++alreadyInQueue; 
-                temporalList = currentQueue;
             }
 
             if (alreadyInQueue == 4 && std::find(currentQueue.begin(), currentQueue.end(), frontguid) == currentQueue.end())
-                currentQueue.push_back(frontguid);
+                AddToCurrentQueue(frontguid, queueId, false);
 
             firstNew.clear();
         }
@@ -470,6 +463,11 @@ void LFGMgr::Update(uint32 diff)
     if (m_QueueTimer > LFG_QUEUEUPDATE_INTERVAL)
     {
         m_QueueTimer = 0;
+
+        /// Answers depend on players being online, ignore lists and locks, don't keep them forever
+        m_CompatibleMap.clear();
+        m_CompatibleKeys.clear();
+
         currTime = time(NULL);
         for (LfgQueueInfoMap::const_iterator itQueue = m_QueueInfoMap.begin(); itQueue != m_QueueInfoMap.end(); ++itQueue)
         {
@@ -540,6 +538,103 @@ void LFGMgr::AddToQueue(uint64 guid, uint8 queueId)
     }
 }
 
+/**
+   Adds a guid to the main queue and to the role buckets of its dungeons
+
+   @param[in]     p_Guid Player or group guid to add to queue
+   @param[in]     p_QueueId Queue Id to add player/group to
+   @param[in]     p_Front Add with high priority
+*/
+void LFGMgr::AddToCurrentQueue(uint64 p_Guid, uint8 p_QueueId, bool p_Front)
+{
+    LfgGuidList& l_CurrentQueue = m_currentQueue[p_QueueId];
+    if (p_Front)
+        l_CurrentQueue.push_front(p_Guid);
+    else
+        l_CurrentQueue.push_back(p_Guid);
+
+    AddToRoleBuckets(p_Guid, p_QueueId);
+}
+
+/**
+   Removes a guid from the main queue and from the role buckets
+
+   @param[in]     p_Guid Player or group guid to remove
+*/
+void LFGMgr::RemoveFromCurrentQueue(uint64 p_Guid)
+{
+    for (LfgGuidListMap::iterator l_Itr = m_currentQueue.begin(); l_Itr != m_currentQueue.end(); ++l_Itr)
+        l_Itr->second.remove(p_Guid);
+
+    RemoveFromRoleBuckets(p_Guid);
+}
+
+/**
+   Indexes a guid of the main queue by the dungeons it selected and the roles its players can fill
+
+   @param[in]     p_Guid Player or group guid
+   @param[in]     p_QueueId Queue Id the guid is in
+*/
+void LFGMgr::AddToRoleBuckets(uint64 p_Guid, uint8 p_QueueId)
+{
+    LfgQueueInfoMap::const_iterator l_QueueInfo = m_QueueInfoMap.find(p_Guid);
+    if (l_QueueInfo == m_QueueInfoMap.end() || m_RoleBucketEntries.find(p_Guid) != m_RoleBucketEntries.end())
+        return;
+
+    LfgRoleBucketEntry& l_Entry = m_RoleBucketEntries[p_Guid];
+    l_Entry.QueueId  = p_QueueId;
+    l_Entry.Roles    = LFG_ROLEMASK_NONE;
+    l_Entry.Dungeons = l_QueueInfo->second->dungeons;
+
+    for (LfgRolesMap::const_iterator l_Itr = l_QueueInfo->second->roles.begin(); l_Itr != l_QueueInfo->second->roles.end(); ++l_Itr)
+        l_Entry.Roles |= l_Itr->second;
+
+    LfgDungeonRoleBuckets& l_Buckets = m_RoleBuckets[p_QueueId];
+    for (uint32 l_DungeonId : l_Entry.Dungeons)
+    {
+        LfgRoleBucket& l_Bucket = l_Buckets[l_DungeonId];
+        if (l_Entry.Roles & LFG_ROLEMASK_TANK)
+            l_Bucket.Guids[LFG_ROLE_BUCKET_TANK].push_back(p_Guid);
+        if (l_Entry.Roles & LFG_ROLEMASK_HEALER)
+            l_Bucket.Guids[LFG_ROLE_BUCKET_HEALER].push_back(p_Guid);
+        if (l_Entry.Roles & LFG_ROLEMASK_DAMAGE)
+            l_Bucket.Guids[LFG_ROLE_BUCKET_DAMAGE].push_back(p_Guid);
+    }
+}
+
+/**
+   Removes a guid from the role buckets it was indexed in
+
+   @param[in]     p_Guid Player or group guid
+*/
+void LFGMgr::RemoveFromRoleBuckets(uint64 p_Guid)
+{
+    LfgRoleBucketEntryMap::iterator l_Entry = m_RoleBucketEntries.find(p_Guid);
+    if (l_Entry == m_RoleBucketEntries.end())
+        return;
+
+    LfgDungeonRoleBuckets& l_Buckets = m_RoleBuckets[l_Entry->second.QueueId];
+    for (uint32 l_DungeonId : l_Entry->second.Dungeons)
+    {
+        LfgDungeonRoleBuckets::iterator l_Bucket = l_Buckets.find(l_DungeonId);
+        if (l_Bucket == l_Buckets.end())
+            continue;
+
+        bool l_Empty = true;
+        for (uint8 l_I = 0; l_I < LFG_ROLE_BUCKET_MAX; ++l_I)
+        {
+            std::vector<uint64>& l_Guids = l_Bucket->second.Guids[l_I];
+            l_Guids.erase(std::remove(l_Guids.begin(), l_Guids.end(), p_Guid), l_Guids.end());
+            l_Empty &= l_Guids.empty();
+        }
+
+        if (l_Empty)
+            l_Buckets.erase(l_Bucket);
+    }
+
+    m_RoleBucketEntries.erase(l_Entry);
+}
+
 /**
    Removes a guid from the main and new queues.
 
@@ -548,8 +643,7 @@ void LFGMgr::AddToQueue(uint64 guid, uint8 queueId)
 */
 bool LFGMgr::RemoveFromQueue(uint64 guid)
 {
-    for (LfgGuidListMap::iterator it = m_currentQueue.begin(); it != m_currentQueue.end(); ++it)
-        it->second.remove(guid);
+    RemoveFromCurrentQueue(guid);
 
     for (LfgGuidListMap::iterator it = m_newToQueue.begin(); it != m_newToQueue.end(); ++it)
         it->second.remove(guid);
@@ -1124,33 +1218,69 @@ void LFGMgr::OfferContinue(Group* grp)
 }
 
 /**
-   Checks que main queue to try to form a Lfg group. Returns first match found (if any)
+   Tries to complete the group of the new guid with the current queue. The queued guids
+   sharing a dungeon with it are taken from the role buckets, tanks first, then healers
+   and damage dealers, and kept as long as the group stays compatible. Every candidate is
+   checked once per dungeon so a proposal is found in linear time in the bucket sizes.
 
-   @param[in]     check List of guids trying to match with other groups
-   @param[in]     all List of all other guids in main queue to match against
+   @param[in]     p_Check List holding the new guid trying to match with other groups
+   @param[in]     p_QueueId Queue to match against
    @return Pointer to proposal, if match is found
 */
-LfgProposal* LFGMgr::FindNewGroups(LfgGuidList& check, LfgGuidList& all, LfgCategory p_Category)
+LfgProposal* LFGMgr::FindNewGroups(LfgGuidList& p_Check, uint8 p_QueueId, LfgCategory p_Category)
 {
-    uint8 maxGroupSize = 5;
+    uint8 l_MaxGroupSize = 5;
     if (p_Category == LFG_CATEGORIE_RAID)
-        maxGroupSize = 25;
+        l_MaxGroupSize = 25;
     if (p_Category == LFG_CATEGORIE_SCENARIO)
-        maxGroupSize = 3;
+        l_MaxGroupSize = 3;
+
+    LfgProposal* l_Proposal = nullptr;
+    if (p_Check.empty() || p_Check.size() > l_MaxGroupSize || !CheckCompatibility(p_Check, l_Proposal, p_Category))
+        return nullptr;
+
+    if (l_Proposal)
+        return l_Proposal;
+
+    LfgQueueInfoMap::const_iterator l_QueueInfo = m_QueueInfoMap.find(p_Check.front());
+    if (l_QueueInfo == m_QueueInfoMap.end() || l_QueueInfo->second->category != p_Category)
+        return nullptr;
 
-    LfgProposal* pProposal = NULL;
-    if (check.empty() || check.size() > maxGroupSize || !CheckCompatibility(check, pProposal, p_Category))
-        return NULL;
+    LfgRoleBucketsMap::const_iterator l_QueueBuckets = m_RoleBuckets.find(p_QueueId);
+    if (l_QueueBuckets == m_RoleBuckets.end())
+        return nullptr;
 
-    // Try to match with queued groups
-    while (!pProposal && !all.empty())
+    /// Copied, checking compatibilities can remove guids no longer queued from the buckets
+    LfgDungeonSet l_Dungeons = l_QueueInfo->second->dungeons;
+    std::vector<uint64> l_Candidates;
+
+    for (uint32 l_DungeonId : l_Dungeons)
     {
-        check.push_back(all.front());
-        all.pop_front();
-        pProposal = FindNewGroups(check, all, p_Category);
-        check.pop_back();
+        LfgDungeonRoleBuckets::const_iterator l_Buckets = l_QueueBuckets->second.find(l_DungeonId);
+        if (l_Buckets == l_QueueBuckets->second.end())
+            continue;
+
+        l_Candidates.clear();
+        for (uint8 l_I = 0; l_I < LFG_ROLE_BUCKET_MAX; ++l_I)
+            l_Candidates.insert(l_Candidates.end(), l_Buckets->second.Guids[l_I].begin(), l_Buckets->second.Guids[l_I].end());
+
+        LfgGuidList l_Check = p_Check;
+        for (uint64 l_Guid : l_Candidates)
+        {
+            if (std::find(l_Check.begin(), l_Check.end(), l_Guid) != l_Check.end())
+                continue;
+
+            /// Added in front, CheckCompatibility then finds the rest of the group in its cache
+            l_Check.push_front(l_Guid);
+            if (!CheckCompatibility(l_Check, l_Proposal, p_Category))
+                l_Check.pop_front();
+
+            if (l_Proposal)
+                return l_Proposal;
+        }
     }
-    return pProposal;
+
+    return nullptr;
 }
 
 /**
@@ -1160,7 +1290,7 @@ LfgProposal* LFGMgr::FindNewGroups(LfgGuidList& check, LfgGuidList& all, LfgCate
    @param[out]    pProposal Proposal found if groups are compatibles and Match
    @return true if group are compatibles
 */
-bool LFGMgr::CheckCompatibility(LfgGuidList p_Check, LfgProposal*& p_Proposal, LfgCategory p_Categorie)
+bool LFGMgr::CheckCompatibility(LfgGuidList& p_Check, LfgProposal*& p_Proposal, LfgCategory p_Categorie)
 {
     if (p_Proposal)                                         // Do not check anything if we already have a proposal
         return false;
@@ -1174,16 +1304,16 @@ bool LFGMgr::CheckCompatibility(LfgGuidList p_Check, LfgProposal*& p_Proposal, L
     if (IsInDebug())
         l_MaxGroupSize = 2;
 
-    std::string strGuids = ConcatenateGuids(p_Check);
-
     if (p_Check.size() > l_MaxGroupSize || p_Check.empty())
         return false;
 
     if (p_Check.size() == 1 && IS_PLAYER_GUID(p_Check.front())) // Player joining dungeon... compatible
         return true;
 
+    uint64 l_Key = GetCompatiblesKey(p_Check, p_Categorie);
+
     // Previously cached?
-    LfgAnswer answer = GetCompatibles(strGuids);
+    LfgAnswer answer = GetCompatibles(l_Key, p_Check);
     if (answer != LFG_ANSWER_PENDING)
         return bool(answer);
 
@@ -1196,7 +1326,8 @@ bool LFGMgr::CheckCompatibility(LfgGuidList p_Check, LfgProposal*& p_Proposal, L
         // Check all-but-new compatibilities (New, A, B, C, D) --> check(A, B, C, D)
         if (!CheckCompatibility(p_Check, p_Proposal, p_Categorie))          // Group not compatible
         {
-            SetCompatibles(strGuids, false);
+            p_Check.push_front(frontGuid);
+            SetCompatibles(l_Key, p_Check, false);
             return false;
         }
         p_Check.push_front(frontGuid);
@@ -1243,7 +1374,7 @@ bool LFGMgr::CheckCompatibility(LfgGuidList p_Check, LfgProposal*& p_Proposal, L
     // Do not match - groups already in a lfgDungeon or too much players
     if (numLfgGroups > 1 || numPlayers > l_MaxGroupSize)
     {
-        SetCompatibles(strGuids, false);
+        SetCompatibles(l_Key, p_Check, false);
         return false;
     }
 
@@ -1270,7 +1401,7 @@ bool LFGMgr::CheckCompatibility(LfgGuidList p_Check, LfgProposal*& p_Proposal, L
     {
         Player* player = ObjectAccessor::FindPlayer(it->first);
         if (!player)
-            sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::CheckCompatibility: (%s) Warning! [" UI64FMTD "] offline! Marking as not compatibles!", strGuids.c_str(), it->first);
+            sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::CheckCompatibility: (%s) Warning! [" UI64FMTD "] offline! Marking as not compatibles!", ConcatenateGuids(p_Check).c_str(), it->first);
         else
         {
             for (PlayerSet::const_iterator itPlayer = players.begin(); itPlayer != players.end() && player; ++itPlayer)
@@ -1294,7 +1425,7 @@ bool LFGMgr::CheckCompatibility(LfgGuidList p_Check, LfgProposal*& p_Proposal, L
     // otherwise check if roles are compatible
     if (players.size() != numPlayers || !CheckGroupRoles(rolesMap, p_Categorie))
     {
-        SetCompatibles(strGuids, false);
+        SetCompatibles(l_Key, p_Check, false);
         return false;
     }
 
@@ -1321,10 +1452,10 @@ bool LFGMgr::CheckCompatibility(LfgGuidList p_Check, LfgProposal*& p_Proposal, L
 
     if (compatibleDungeons.empty())
     {
-        SetCompatibles(strGuids, false);
+        SetCompatibles(l_Key, p_Check, false);
         return false;
     }
-    SetCompatibles(strGuids, true);
+    SetCompatibles(l_Key, p_Check, true);
 
     // ----- Group is compatible, if we have MAXGROUPSIZE members then match is found
     if (numPlayers != l_MaxGroupSize)
@@ -1570,10 +1701,7 @@ void LFGMgr::UpdateRoleCheck(uint64 gguid, uint64 guid /* = 0 */, uint8 roles /*
 
         m_QueueInfoMap[gguid] = pqInfo;
         if (GetState(gguid) != LFG_STATE_NONE)
-        {
-            LfgGuidList& currentQueue = m_currentQueue[team];
-            currentQueue.push_front(gguid);
-        }
+            AddToCurrentQueue(gguid, team, true);
         for (LfgRolesMap::const_iterator it = check_roles.begin(); it != check_roles.end(); ++it)
         {
             Player* plrg = ObjectAccessor::FindPlayer(it->first);
@@ -1602,43 +1730,81 @@ void LFGMgr::UpdateRoleCheck(uint64 gguid, uint64 guid /* = 0 */, uint8 roles /*
 */
 void LFGMgr::RemoveFromCompatibles(uint64 guid)
 {
-    std::stringstream out;
-    out << guid;
-    std::string strGuid = out.str();
+    LfgCompatibleKeysMap::iterator l_Itr = m_CompatibleKeys.find(guid);
+    if (l_Itr == m_CompatibleKeys.end())
+        return;
+
+    for (uint64 l_Key : l_Itr->second)
+        m_CompatibleMap.erase(l_Key);
 
-    for (LfgCompatibleMap::iterator itNext = m_CompatibleMap.begin(); itNext != m_CompatibleMap.end();)
+    m_CompatibleKeys.erase(l_Itr);
+}
+
+/**
+   Hash of a list of guids, independent of their order, and of the category they are checked for
+
+   @param[in]     p_Check List of guids
+   @param[in]     p_Category Category the guids are checked for
+*/
+uint64 LFGMgr::GetCompatiblesKey(LfgGuidList const& p_Check, LfgCategory p_Category)
+{
+    uint64 l_Sum = 0;
+    uint64 l_Xor = 0;
+
+    for (uint64 l_Guid : p_Check)
     {
-        LfgCompatibleMap::iterator it = itNext++;
-        if (it->first.find(strGuid) != std::string::npos)  // Found, remove it
-            m_CompatibleMap.erase(it);
+        uint64 l_Hash = (l_Guid ^ (l_Guid >> 31)) * UI64LIT(0x9E3779B97F4A7C15);
+        l_Hash ^= l_Hash >> 29;
+        l_Sum += l_Hash;
+        l_Xor ^= l_Hash * UI64LIT(0xBF58476D1CE4E5B9);
     }
+
+    return (l_Sum ^ ((l_Xor << 1) | (l_Xor >> 63))) + (uint64(p_Category) << 56) + p_Check.size();
 }
 
 /**
    Stores the compatibility of a list of guids
 
-   @param[in]     key String concatenation of guids (| used as separator)
-   @param[in]     compatibles Compatibles or not
+   @param[in]     p_Key Key of the list, see GetCompatiblesKey
+   @param[in]     p_Check List of guids
+   @param[in]     p_Compatibles Compatibles or not
 */
-void LFGMgr::SetCompatibles(std::string const& key, bool compatibles)
+void LFGMgr::SetCompatibles(uint64 p_Key, LfgGuidList const& p_Check, bool p_Compatibles)
 {
-    m_CompatibleMap[key] = LfgAnswer(compatibles);
+    LfgCompatibleEntry& l_Entry = m_CompatibleMap[p_Key];
+    l_Entry.Answer = LfgAnswer(p_Compatibles);
+
+    if (!l_Entry.Guids.empty() && GetCompatibles(p_Key, p_Check) != LFG_ANSWER_PENDING)
+        return;
+
+    /// New entry or hash collision, the previous list is replaced
+    l_Entry.Guids.assign(p_Check.begin(), p_Check.end());
+    std::sort(l_Entry.Guids.begin(), l_Entry.Guids.end());
+
+    for (uint64 l_Guid : p_Check)
+        m_CompatibleKeys[l_Guid].push_back(p_Key);
 }
 
 /**
    Get the compatibility of a group of guids
 
-   @param[in]     key String concatenation of guids (| used as separator)
+   @param[in]     p_Key Key of the list, see GetCompatiblesKey
+   @param[in]     p_Check List of guids
    @return 1 (Compatibles), 0 (Not compatibles), -1 (Not set)
 */
-LfgAnswer LFGMgr::GetCompatibles(std::string const& key)
+LfgAnswer LFGMgr::GetCompatibles(uint64 p_Key, LfgGuidList const& p_Check)
 {
-    LfgAnswer answer = LFG_ANSWER_PENDING;
-    LfgCompatibleMap::iterator it = m_CompatibleMap.find(key);
-    if (it != m_CompatibleMap.end())
-        answer = it->second;
+    LfgCompatibleMap::const_iterator l_Itr = m_CompatibleMap.find(p_Key);
+    if (l_Itr == m_CompatibleMap.end() || l_Itr->second.Guids.size() != p_Check.size())
+        return LFG_ANSWER_PENDING;
+
+    for (uint64 l_Guid : p_Check)
+    {
+        if (!std::binary_search(l_Itr->second.Guids.begin(), l_Itr->second.Guids.end(), l_Guid))
+            return LFG_ANSWER_PENDING;
+    }
 
-    return answer;
+    return l_Itr->second.Answer;
 }
 
 /**
@@ -2084,8 +2250,7 @@ void LFGMgr::RemoveProposal(LfgProposalMap::iterator itProposal, LfgUpdateType t
     for (LfgGuidList::const_iterator it = pProposal->queues.begin(); it != pProposal->queues.end(); ++it)
     {
         uint64 guid = *it;
-        LfgGuidList& currentQueue = m_currentQueue[team];
-        currentQueue.push_front(guid);         //Add GUID for high priority
+        AddToCurrentQueue(guid, team, true);   //Add GUID for high priority
         AddToQueue(guid, team);                //We have to add each GUID in newQueue to check for a new groups
     }
 
@@ -186,7 +186,15 @@ typedef std::map<uint8, LfgGuidList> LfgGuidListMap;
 typedef std::set<Player*> PlayerSet;
 typedef std::list<Player*> LfgPlayerList;
 typedef std::map<uint32, LfgReward const*> LfgRewardMap;
-typedef std::map<std::string, LfgAnswer> LfgCompatibleMap;
+/// Compatibility of a set of queued guids, stored under a hash of the set and of the category
+struct LfgCompatibleEntry
+{
+    std::vector<uint64> Guids;                             ///< Sorted, to tell hash collisions apart
+    LfgAnswer Answer;
+};
+
+typedef std::unordered_map<uint64, LfgCompatibleEntry> LfgCompatibleMap;
+typedef std::unordered_map<uint64, std::vector<uint64>> LfgCompatibleKeysMap;
 typedef std::map<uint64, LfgDungeonSet> LfgDungeonMap;
 typedef std::map<uint64, uint8> LfgRolesMap;
 typedef std::map<uint64, LfgAnswer> LfgAnswerMap;
@@ -258,6 +266,32 @@ struct LfgQueueInfo
     uint8 category;
 };
 
+enum LfgRoleBucketType
+{
+    LFG_ROLE_BUCKET_TANK    = 0,
+    LFG_ROLE_BUCKET_HEALER  = 1,
+    LFG_ROLE_BUCKET_DAMAGE  = 2,
+    LFG_ROLE_BUCKET_MAX
+};
+
+/// Queued guids of a dungeon by role they can fill, in queue order
+struct LfgRoleBucket
+{
+    std::vector<uint64> Guids[LFG_ROLE_BUCKET_MAX];
+};
+
+/// Buckets a guid of the current queue was inserted in
+struct LfgRoleBucketEntry
+{
+    uint8 QueueId;
+    uint8 Roles;
+    LfgDungeonSet Dungeons;
+};
+
+typedef std::map<uint32, LfgRoleBucket> LfgDungeonRoleBuckets;
+typedef std::map<uint8, LfgDungeonRoleBuckets> LfgRoleBucketsMap;
+typedef std::unordered_map<uint64, LfgRoleBucketEntry> LfgRoleBucketEntryMap;
+
 /// Stores player data related to proposal to join
 struct LfgProposalPlayer
 {
@@ -405,17 +439,22 @@ class LFGMgr
         // Queue
         void AddToQueue(uint64 guid, uint8 queueId);
         bool RemoveFromQueue(uint64 guid);
+        void AddToCurrentQueue(uint64 p_Guid, uint8 p_QueueId, bool p_Front);
+        void RemoveFromCurrentQueue(uint64 p_Guid);
+        void AddToRoleBuckets(uint64 p_Guid, uint8 p_QueueId);
+        void RemoveFromRoleBuckets(uint64 p_Guid);
 
         // Proposals
         void RemoveProposal(LfgProposalMap::iterator itProposal, LfgUpdateType type);
 
         // Group Matching
-        LfgProposal* FindNewGroups(LfgGuidList& check, LfgGuidList& all, LfgCategory type);
+        LfgProposal* FindNewGroups(LfgGuidList& p_Check, uint8 p_QueueId, LfgCategory p_Category);
         bool CheckGroupRoles(LfgRolesMap &groles, LfgCategory type, bool removeLeaderFlag = true);
-        bool CheckCompatibility(LfgGuidList check, LfgProposal*& pProposal, LfgCategory type);
+        bool CheckCompatibility(LfgGuidList& check, LfgProposal*& pProposal, LfgCategory type);
         void GetCompatibleDungeons(LfgDungeonSet& dungeons, const PlayerSet& players, LfgLockPartyMap& lockMap);
-        void SetCompatibles(std::string const& concatenatedGuids, bool compatibles);
-        LfgAnswer GetCompatibles(std::string const& concatenatedGuids);
+        static uint64 GetCompatiblesKey(LfgGuidList const& p_Check, LfgCategory p_Category);
+        void SetCompatibles(uint64 p_Key, LfgGuidList const& p_Check, bool p_Compatibles);
+        LfgAnswer GetCompatibles(uint64 p_Key, LfgGuidList const& p_Check);
         void RemoveFromCompatibles(uint64 guid);
         LfgProposal* CheckForSingle(LfgGuidList& check);
 
@@ -448,6 +487,9 @@ class LFGMgr
         LfgGuidListMap m_currentQueue;                     ///< Ordered list. Used to find groups
         LfgGuidListMap m_newToQueue;                       ///< New groups to add to queue
         LfgCompatibleMap m_CompatibleMap;                  ///< Compatible dungeons
+        LfgCompatibleKeysMap m_CompatibleKeys;             ///< Keys of m_CompatibleMap each guid is part of
+        LfgRoleBucketsMap m_RoleBuckets;                   ///< Current queue by queue id, dungeon and role, used to find groups
+        LfgRoleBucketEntryMap m_RoleBucketEntries;         ///< Buckets of each guid of the current queue
         LfgGuidList m_teleport;                            ///< Players being teleported
         // Rolecheck - Proposal - Vote Kicks
         LfgRoleCheckMap m_RoleChecks;                      ///< Current Role checks
@@ -19,6 +19,19 @@
 #include "ObjectMgr.h"
 #include "ScriptMgr.h"
 #include "MoveSplineInit.h"
+#include "ObjectPool.h"
+
+static ObjectPool s_AreaTriggerPool("AreaTrigger", sizeof(AreaTrigger), 32);
+
+void* AreaTrigger::operator new(size_t p_Size)
+{
+    return s_AreaTriggerPool.Allocate(p_Size);
+}
+
+void AreaTrigger::operator delete(void* p_Object, size_t p_Size)
+{
+    s_AreaTriggerPool.Deallocate(p_Object, p_Size);
+}
 
 AreaTrigger::AreaTrigger()
     : WorldObject(false),
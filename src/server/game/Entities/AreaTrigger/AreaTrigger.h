@@ -249,6 +249,10 @@ class AreaTrigger : public WorldObject, public GridObject<AreaTrigger>
         AreaTrigger();
         ~AreaTrigger();
 
+        /// Taken from an ObjectPool
+        static void* operator new(size_t p_Size);
+        static void operator delete(void* p_Object, size_t p_Size);
+
         void AddToWorld();
         void RemoveFromWorld();
 
@@ -42,6 +42,7 @@
 #include "MoveSpline.h"
 #include "WildBattlePet.h"
 #include "Transport.h"
+#include "ObjectPool.h"
 
 #ifndef CROSS
 # include "GarrisonNPCAI.hpp"
@@ -134,6 +135,18 @@ bool ForcedDespawnDelayEvent::Execute(uint64 /*e_time*/, uint32 /*p_time*/)
     return true;
 }
 
+static ObjectPool s_CreaturePool("Creature", sizeof(Creature), 64);
+
+void* Creature::operator new(size_t p_Size)
+{
+    return s_CreaturePool.Allocate(p_Size);
+}
+
+void Creature::operator delete(void* p_Object, size_t p_Size)
+{
+    s_CreaturePool.Deallocate(p_Object, p_Size);
+}
+
 Creature::Creature(bool isWorldObject) : Unit(isWorldObject), MapObject(),
 lootForPickPocketed(false), lootForBody(false), m_groupLootTimer(0), lootingGroupLowGUID(0),
 m_PlayerDamageReq(0), m_lootRecipient(0), m_lootRecipientGroup(0), m_corpseRemoveTime(0), m_respawnTime(0),
@@ -347,7 +360,7 @@ bool Creature::InitEntry(uint32 Entry, uint32 /*team*/, const CreatureData* data
     SetName(normalInfo->Name);                              // at normal entry always
 
     SetFloatValue(UNIT_FIELD_BOUNDING_RADIUS, minfo->bounding_radius);
-    SetFloatValue(UNIT_FIELD_COMBAT_REACH, minfo->combat_reach);
+    SetCombatReach(minfo->combat_reach);
 
     SetFloatValue(UNIT_FIELD_MOD_CASTING_SPEED, 1.0f);
     SetFloatValue(UNIT_FIELD_MOD_SPELL_HASTE, 1.0f);
@@ -531,6 +531,10 @@ class Creature : public Unit, public GridObject<Creature>, public MapObject
         explicit Creature(bool isWorldObject = true);
         virtual ~Creature();
 
+        /// Taken from an ObjectPool, pets and summons are bigger and use the global allocator
+        static void* operator new(size_t p_Size);
+        static void operator delete(void* p_Object, size_t p_Size);
+
         void AddToWorld() override;
         void RemoveFromWorld() override;
 
@@ -16,6 +16,19 @@
 #include "CellImpl.h"
 #include "GridNotifiersImpl.h"
 #include "ScriptMgr.h"
+#include "ObjectPool.h"
+
+static ObjectPool s_DynamicObjectPool(sizeof(DynamicObject), 32);
+
+void* DynamicObject::operator new(size_t p_Size)
+{
+    return s_DynamicObjectPool.Allocate(p_Size);
+}
+
+void DynamicObject::operator delete(void* p_Object, size_t p_Size)
+{
+    s_DynamicObjectPool.Deallocate(p_Object, p_Size);
+}
 
 DynamicObject::DynamicObject(bool isWorldObject) : WorldObject(isWorldObject),
     _aura(NULL), _removedAura(NULL), _caster(NULL), _duration(0), _isViewpoint(false)
@@ -31,6 +31,10 @@ class DynamicObject : public WorldObject, public GridObject<DynamicObject>
         DynamicObject(bool isWorldObject);
         ~DynamicObject();
 
+        /// Taken from an ObjectPool
+        static void* operator new(size_t p_Size);
+        static void operator delete(void* p_Object, size_t p_Size);
+
         void AddToWorld();
         void RemoveFromWorld();
 
@@ -26,6 +26,19 @@
 #include "SpellAuraEffects.h"
 #include "UpdateFieldFlags.h"
 #include "Transport.h"
+#include "ObjectPool.h"
+
+static ObjectPool s_GameObjectPool(sizeof(GameObject), 64);
+
+void* GameObject::operator new(size_t p_Size)
+{
+    return s_GameObjectPool.Allocate(p_Size);
+}
+
+void GameObject::operator delete(void* p_Object, size_t p_Size)
+{
+    s_GameObjectPool.Deallocate(p_Object, p_Size);
+}
 
 GameObject::GameObject() : WorldObject(false), MapObject(),
 m_model(NULL), m_goValue(new GameObjectValue), m_AI(NULL)
@@ -2422,18 +2435,25 @@ void GameObject::BuildValuesUpdate(uint8 updateType, ByteBuffer* data, Player* t
         return;
 
     bool forcedFlags = GetGoType() == GAMEOBJECT_TYPE_CHEST && GetGOInfo()->chest.usegrouplootrules && HasLootRecipient();
-    bool targetIsGM = target->isGameMaster();
-    bool isStoppableTransport = GetGoType() == GAMEOBJECT_TYPE_TRANSPORT && !m_goValue->Transport.StopFrames->empty();
+
+    uint32* flags = GameObjectUpdateFieldFlags;
+    uint32 visibleFlag = UF_FLAG_PUBLIC | UF_FLAG_VIEWER_DEPENDENT;
+    if (GetOwnerGUID() == target->GetGUID())
+        visibleFlag |= UF_FLAG_OWNER;
+
+    if (AppendCachedValuesUpdate(updateType, visibleFlag, data, target))
+        return;
+
+    size_t l_StartPos = data->wpos();
 
     ByteBuffer fieldBuffer;
 
     UpdateMask updateMask;
     updateMask.SetCount(m_valuesCount);
 
-    uint32* flags = GameObjectUpdateFieldFlags;
-    uint32 visibleFlag = UF_FLAG_PUBLIC | UF_FLAG_VIEWER_DEPENDENT;
-    if (GetOwnerGUID() == target->GetGUID())
-        visibleFlag |= UF_FLAG_OWNER;
+    /// Values following the block count and the mask in the block
+    uint32 l_FieldsOffset = sizeof(uint8) + updateMask.GetBlockCount() * sizeof(UpdateMask::ClientUpdateMaskType);
+    ValuesUpdateTargetFields l_TargetFields;
 
     for (uint16 index = 0; index < m_valuesCount; ++index)
     {
@@ -2443,78 +2463,89 @@ void GameObject::BuildValuesUpdate(uint8 updateType, ByteBuffer* data, Player* t
         {
             updateMask.SetBit(index);
 
-            if (index == OBJECT_FIELD_DYNAMIC_FLAGS)
-            {
-                uint16 dynFlags = 0;
-                int16 pathProgress = -1;
-                switch (GetGoType())
-                {
-                    case GAMEOBJECT_TYPE_CHEST:
-                    case GAMEOBJECT_TYPE_GOOBER:
-                        if (ActivateToQuest(target))
-                            dynFlags |= GO_DYNFLAG_LO_ACTIVATE | GO_DYNFLAG_LO_SPARKLE;
-                        else if (targetIsGM)
-                            dynFlags |= GO_DYNFLAG_LO_ACTIVATE;
-                        break;
-                    case GAMEOBJECT_TYPE_GENERIC:
-                        if (ActivateToQuest(target))
-                            dynFlags |= GO_DYNFLAG_LO_SPARKLE;
-                        break;
-                    case GAMEOBJECT_TYPE_TRANSPORT:
-                    {
-                        float timer = float(m_goValue->Transport.PathProgress % GetTransportPeriod());
-                        pathProgress = int16(timer / float(GetTransportPeriod()) * 65535.0f);
-                        break;
-                    }
-                    case GAMEOBJECT_TYPE_MAP_OBJ_TRANSPORT:
-                        pathProgress = int16(float(m_goValue->Transport.PathProgress) / float(GetUInt32Value(GAMEOBJECT_FIELD_LEVEL)) * 65535.0f);
-                        break;
-                }
+            if (index == OBJECT_FIELD_DYNAMIC_FLAGS || index == GAMEOBJECT_FIELD_FLAGS)
+                l_TargetFields.emplace_back(index, l_FieldsOffset + fieldBuffer.wpos());
 
-                fieldBuffer << uint16(dynFlags);
-                fieldBuffer << int16(pathProgress);
-            }
-            else if (index == GAMEOBJECT_FIELD_FLAGS)
-            {
-                uint32 flags = m_uint32Values[GAMEOBJECT_FIELD_FLAGS];
-				if (GetGoType() == GAMEOBJECT_TYPE_CHEST)
-				{
-					if ((GetGOInfo()->chest.usegrouplootrules || GetGOInfo()->GetTrackingQuestId()) && (!IsLootAllowedFor(target) || GetOwner() && GetOwner()->ToCreature()))
-						flags |= GO_FLAG_LOCKED | GO_FLAG_NOT_SELECTABLE;
-				}
-
-                fieldBuffer << flags;
-            }
-            else if (index == GAMEOBJECT_FIELD_LEVEL)
+            fieldBuffer << GetValuesUpdateFieldForTarget(index, target);
+        }
+    }
+
+    *data << uint8(updateMask.GetBlockCount());
+    updateMask.AppendToPacket(data);
+    data->append(fieldBuffer);
+
+    StoreValuesUpdate(updateType, visibleFlag, data, l_StartPos, &l_TargetFields);
+}
+
+uint32 GameObject::GetValuesUpdateFieldForTarget(uint16 index, Player* target) const
+{
+    bool isStoppableTransport = GetGoType() == GAMEOBJECT_TYPE_TRANSPORT && !m_goValue->Transport.StopFrames->empty();
+
+    if (index == OBJECT_FIELD_DYNAMIC_FLAGS)
+    {
+        uint16 dynFlags = 0;
+        int16 pathProgress = -1;
+        switch (GetGoType())
+        {
+            case GAMEOBJECT_TYPE_CHEST:
+            case GAMEOBJECT_TYPE_GOOBER:
+                if (ActivateToQuest(target))
+                    dynFlags |= GO_DYNFLAG_LO_ACTIVATE | GO_DYNFLAG_LO_SPARKLE;
+                else if (target->isGameMaster())
+                    dynFlags |= GO_DYNFLAG_LO_ACTIVATE;
+                break;
+            case GAMEOBJECT_TYPE_GENERIC:
+                if (ActivateToQuest(target))
+                    dynFlags |= GO_DYNFLAG_LO_SPARKLE;
+                break;
+            case GAMEOBJECT_TYPE_TRANSPORT:
             {
-                if (isStoppableTransport)
-                    fieldBuffer << uint32(m_goValue->Transport.PathProgress);
-                else
-                    fieldBuffer << m_uint32Values[index];
+                float timer = float(m_goValue->Transport.PathProgress % GetTransportPeriod());
+                pathProgress = int16(timer / float(GetTransportPeriod()) * 65535.0f);
+                break;
             }
-            else if (index == GAMEOBJECT_FIELD_PERCENT_HEALTH)
+            case GAMEOBJECT_TYPE_MAP_OBJ_TRANSPORT:
+                pathProgress = int16(float(m_goValue->Transport.PathProgress) / float(GetUInt32Value(GAMEOBJECT_FIELD_LEVEL)) * 65535.0f);
+                break;
+        }
+
+        /// Sent as two uint16, dynFlags first
+        return uint32(dynFlags) | (uint32(uint16(pathProgress)) << 16);
+    }
+    else if (index == GAMEOBJECT_FIELD_FLAGS)
+    {
+        uint32 flags = m_uint32Values[GAMEOBJECT_FIELD_FLAGS];
+        if (GetGoType() == GAMEOBJECT_TYPE_CHEST)
+        {
+            if ((GetGOInfo()->chest.usegrouplootrules || GetGOInfo()->GetTrackingQuestId()) && (!IsLootAllowedFor(target) || GetOwner() && GetOwner()->ToCreature()))
+                flags |= GO_FLAG_LOCKED | GO_FLAG_NOT_SELECTABLE;
+        }
+
+        return flags;
+    }
+    else if (index == GAMEOBJECT_FIELD_LEVEL)
+    {
+        if (isStoppableTransport)
+            return uint32(m_goValue->Transport.PathProgress);
+    }
+    else if (index == GAMEOBJECT_FIELD_PERCENT_HEALTH)
+    {
+        uint32 bytes1 = m_uint32Values[index];
+        if (isStoppableTransport
+            && GetGoState() == GO_STATE_TRANSPORT_ACTIVE
+            && sScriptMgr->OnGameObjectElevatorCheck(this))
+        {
+            if ((m_goValue->Transport.StateUpdateTimer / 20000) & 1)
             {
-                uint32 bytes1 = m_uint32Values[index];
-                if (isStoppableTransport
-                    && GetGoState() == GO_STATE_TRANSPORT_ACTIVE
-                    && sScriptMgr->OnGameObjectElevatorCheck(this))
-                {
-                    if ((m_goValue->Transport.StateUpdateTimer / 20000) & 1)
-                    {
-                        bytes1 &= 0xFFFFFF00;
-                        bytes1 |= GO_STATE_TRANSPORT_STOPPED;
-                    }
-                }
-                fieldBuffer << bytes1;
+                bytes1 &= 0xFFFFFF00;
+                bytes1 |= GO_STATE_TRANSPORT_STOPPED;
             }
-            else
-                fieldBuffer << m_uint32Values[index]; // other cases
         }
+
+        return bytes1;
     }
 
-    *data << uint8(updateMask.GetBlockCount());
-    updateMask.AppendToPacket(data);
-    data->append(fieldBuffer);
+    return m_uint32Values[index]; // other cases
 }
 
 void GameObject::GetRespawnPosition(float &x, float &y, float &z, float* ori /* = NULL*/) const
@@ -935,7 +935,12 @@ class GameObject : public WorldObject, public GridObject<GameObject>, public Map
         explicit GameObject();
         ~GameObject();
 
+        /// Taken from an ObjectPool, transports are bigger and use the global allocator
+        static void* operator new(size_t p_Size);
+        static void operator delete(void* p_Object, size_t p_Size);
+
         void BuildValuesUpdate(uint8 updatetype, ByteBuffer* data, Player* target) const;
+        uint32 GetValuesUpdateFieldForTarget(uint16 index, Player* target) const override;
 
         void AddToWorld();
         void RemoveFromWorld();
@@ -1580,6 +1580,14 @@ void Item::BuildUpdate(UpdateDataMapType& data_map)
     ClearUpdateMask(false);
 }
 
+Map* Item::GetObjectUpdateMap() const
+{
+    if (Player* l_Owner = GetOwner())
+        return l_Owner->IsInWorld() ? l_Owner->FindMap() : nullptr;
+
+    return nullptr;
+}
+
 void Item::BuildDynamicValuesUpdate(uint8 p_UpdateType, ByteBuffer* p_Data, Player* p_Target) const
 {
     if (p_Target == nullptr)
@@ -463,6 +463,7 @@ class Item : public Object
         bool CheckSoulboundTradeExpire();
 
         void BuildUpdate(UpdateDataMapType&) override;
+        Map* GetObjectUpdateMap() const override;
         void BuildDynamicValuesUpdate(uint8 p_UpdateType, ByteBuffer* p_Data, Player* p_Target) const override;
 
         uint32 GetScriptId() const { return GetTemplate()->ScriptId; }
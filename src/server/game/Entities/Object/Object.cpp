@@ -81,6 +81,9 @@ Object::Object() : m_PackGUID(sizeof(uint64)+1)
 
     m_inWorld           = false;
     m_objectUpdated     = false;
+    m_objectUpdateMap   = nullptr;
+
+    m_ValuesUpdateCacheEnabled = false;
 
     m_PackGUID.appendPackGUID(0);
 }
@@ -114,7 +117,7 @@ Object::~Object()
     {
         sLog->outFatal(LOG_FILTER_GENERAL, "Object::~Object - guid=" UI64FMTD ", typeid=%d, entry=%u deleted but still in update list!!", GetGUID(), GetTypeId(), GetEntry());
         //ASSERT(false);
-        sObjectAccessor->RemoveUpdateObject(this);
+        RemoveFromObjectUpdate();
     }
 
     if (m_uint32Values)
@@ -846,38 +849,94 @@ void Object::BuildValuesUpdate(uint8 updateType, ByteBuffer* data, Player* targe
     if (!target)
         return;
 
-    ByteBuffer fieldBuffer;
-    UpdateMask updateMask;
-    updateMask.SetCount(m_valuesCount);
-
     uint32* flags = NULL;
     uint32 visibleFlag = GetUpdateFieldData(target, flags);
 
-    int sendedCount = 0;
+    if (AppendCachedValuesUpdate(updateType, visibleFlag, data, target))
+        return;
+
+    size_t l_StartPos = data->wpos();
+    UpdateFieldFlagsMasks const& l_FieldMasks = GetUpdateFieldFlagsMasks(flags);
+
+    ByteBuffer fieldBuffer;
+    UpdateMask updateMask;
+    updateMask.SetCount(m_valuesCount);
 
-    for (uint16 index = 0; index < m_valuesCount; ++index)
+    for (uint32 l_Block = 0; l_Block < updateMask.GetBlockCount(); ++l_Block)
     {
-        if (_fieldNotifyFlags & flags[index] ||
-            ((updateType == UPDATETYPE_VALUES ? _changesMask.GetBit(index) : m_uint32Values[index]) && (flags[index] & visibleFlag)))
+        uint32 l_FieldMask = updateMask.GetBlockFieldMask(l_Block);
+        uint32 l_Candidates = l_FieldMasks.GetBlock(_fieldNotifyFlags, l_Block);
+        l_Candidates |= l_FieldMasks.GetBlock(visibleFlag, l_Block) & (updateType == UPDATETYPE_VALUES ? _changesMask.GetBlock(l_Block) : l_FieldMask);
+        l_Candidates &= l_FieldMask;
+
+        while (l_Candidates)
         {
-            updateMask.SetBit(index);
-            fieldBuffer << m_uint32Values[index];
+            uint16 index = l_Block * UpdateMask::CLIENT_UPDATE_MASK_BITS + UpdateMask::GetLowestBit(l_Candidates);
+            l_Candidates &= l_Candidates - 1;
 
-            ++sendedCount;
+            if (_fieldNotifyFlags & flags[index] ||
+                ((updateType == UPDATETYPE_VALUES ? _changesMask.GetBit(index) : m_uint32Values[index]) && (flags[index] & visibleFlag)))
+            {
+                updateMask.SetBit(index);
+                fieldBuffer << m_uint32Values[index];
+            }
         }
     }
 
-    for (uint16 index = 0; index < m_valuesCount; ++index)
+    *data << uint8(updateMask.GetBlockCount());
+    updateMask.AppendToPacket(data);
+    data->append(fieldBuffer);
+
+    StoreValuesUpdate(updateType, visibleFlag, data, l_StartPos);
+}
+
+void Object::EnableValuesUpdateCache()
+{
+    m_ValuesUpdateCacheEnabled = true;
+}
+
+void Object::DisableValuesUpdateCache()
+{
+    m_ValuesUpdateCacheEnabled = false;
+    m_ValuesUpdateCache.clear();
+}
+
+bool Object::AppendCachedValuesUpdate(uint8 p_UpdateType, uint32 p_VisibleFlags, ByteBuffer* p_Data, Player* p_Target) const
+{
+    if (!m_ValuesUpdateCacheEnabled)
+        return false;
+
+    for (ValuesUpdateCacheEntry const& l_Entry : m_ValuesUpdateCache)
     {
-        if (updateMask.GetBit(index))
-            --sendedCount;
+        if (l_Entry.UpdateType != p_UpdateType || l_Entry.VisibleFlags != p_VisibleFlags)
+            continue;
+
+        size_t l_StartPos = p_Data->wpos();
+        p_Data->append(l_Entry.Block);
+
+        for (auto const& l_Field : l_Entry.TargetFields)
+            p_Data->put<uint32>(l_StartPos + l_Field.second, GetValuesUpdateFieldForTarget(l_Field.first, p_Target));
+
+        return true;
     }
 
-    ASSERT(sendedCount == 0);
+    return false;
+}
 
-    *data << uint8(updateMask.GetBlockCount());
-    updateMask.AppendToPacket(data);
-    data->append(fieldBuffer);
+void Object::StoreValuesUpdate(uint8 p_UpdateType, uint32 p_VisibleFlags, ByteBuffer const* p_Data, size_t p_StartPos, ValuesUpdateTargetFields const* p_TargetFields) const
+{
+    if (!m_ValuesUpdateCacheEnabled)
+        return;
+
+    m_ValuesUpdateCache.emplace_back();
+
+    ValuesUpdateCacheEntry& l_Entry = m_ValuesUpdateCache.back();
+    l_Entry.UpdateType   = p_UpdateType;
+    l_Entry.VisibleFlags = p_VisibleFlags;
+    l_Entry.Block.append(p_Data->contents() + p_StartPos, p_Data->wpos() - p_StartPos);
+
+    if (p_TargetFields)
+        l_Entry.TargetFields = *p_TargetFields;
 }
 
 void Object::BuildDynamicValuesUpdate(uint8 p_UpdateType, ByteBuffer* p_Data, Player* p_Target) const
@@ -933,9 +992,66 @@ void Object::ClearUpdateMask(bool remove)
     if (m_objectUpdated)
     {
         if (remove)
-            sObjectAccessor->RemoveUpdateObject(this);
+            RemoveFromObjectUpdate();
         m_objectUpdated = false;
+        m_objectUpdateMap = nullptr;
+    }
+}
+
+void Object::AddToObjectUpdate()
+{
+    Map* l_Map = GetObjectUpdateMap();
+    if (l_Map != nullptr)
+        l_Map->AddUpdateObject(this);
+    else
+        sObjectAccessor->AddUpdateObject(this);
+
+    m_objectUpdateMap = l_Map;
+    m_objectUpdated = true;
+}
+
+void Object::RemoveFromObjectUpdate()
+{
+    if (!m_objectUpdated)
+        return;
+
+    if (m_objectUpdateMap != nullptr)
+        m_objectUpdateMap->RemoveUpdateObject(this);
+    else
+        sObjectAccessor->RemoveUpdateObject(this);
+
+    m_objectUpdateMap = nullptr;
+    m_objectUpdated = false;
+}
+
+void Object::MoveObjectUpdate(Map const* p_LeftMap)
+{
+    if (!m_objectUpdated)
+        return;
+
+    /// Changes of objects out of world aren't sent
+    if (!m_inWorld)
+    {
+        RemoveFromObjectUpdate();
+        return;
     }
+
+    Map* l_Map = GetObjectUpdateMap();
+    if (l_Map == p_LeftMap)
+        l_Map = nullptr;
+
+    if (l_Map == m_objectUpdateMap)
+        return;
+
+    RemoveFromObjectUpdate();
+
+    if (l_Map != nullptr)
+        l_Map->AddUpdateObject(this);
+    else
+        sObjectAccessor->AddUpdateObject(this);
+
+    m_objectUpdateMap = l_Map;
+    m_objectUpdated = true;
 }
 
 void Object::BuildFieldsUpdate(Player* player, UpdateDataMapType& data_map) const
@@ -1119,8 +1235,7 @@ bool Object::AddGuidValue(uint16 index, uint64 value)
 
         if (l_Changed && m_inWorld && !m_objectUpdated)
         {
-            sObjectAccessor->AddUpdateObject(this);
-            m_objectUpdated = true;
+            AddToObjectUpdate();
         }
 
         return true;
@@ -1148,8 +1263,7 @@ bool Object::RemoveGuidValue(uint16 index, uint64 value)
 
         if (m_inWorld && !m_objectUpdated)
         {
-            sObjectAccessor->AddUpdateObject(this);
-            m_objectUpdated = true;
+            AddToObjectUpdate();
         }
 
         return true;
@@ -1192,8 +1306,7 @@ void Object::SetGuidValue(uint16 index, uint64 value)
 
     if (l_Changed && m_inWorld && !m_objectUpdated)
     {
-        sObjectAccessor->AddUpdateObject(this);
-        m_objectUpdated = true;
+        AddToObjectUpdate();
     }
 }
 
@@ -1208,8 +1321,7 @@ void Object::SetInt32Value(uint16 index, int32 value)
 
         if (m_inWorld && !m_objectUpdated)
         {
-            sObjectAccessor->AddUpdateObject(this);
-            m_objectUpdated = true;
+            AddToObjectUpdate();
         }
     }
 }
@@ -1225,8 +1337,7 @@ void Object::SetUInt32Value(uint16 index, uint32 value)
 
         if (m_inWorld && !m_objectUpdated)
         {
-            sObjectAccessor->AddUpdateObject(this);
-            m_objectUpdated = true;
+            AddToObjectUpdate();
         }
     }
 }
@@ -1251,8 +1362,7 @@ void Object::SetUInt64Value(uint16 index, uint64 value)
 
         if (m_inWorld && !m_objectUpdated)
         {
-            sObjectAccessor->AddUpdateObject(this);
-            m_objectUpdated = true;
+            AddToObjectUpdate();
         }
     }
 }
@@ -1269,8 +1379,7 @@ bool Object::AddUInt64Value(uint16 index, uint64 value)
 
         if (m_inWorld && !m_objectUpdated)
         {
-            sObjectAccessor->AddUpdateObject(this);
-            m_objectUpdated = true;
+            AddToObjectUpdate();
         }
 
         return true;
@@ -1291,8 +1400,7 @@ bool Object::RemoveUInt64Value(uint16 index, uint64 value)
 
         if (m_inWorld && !m_objectUpdated)
         {
-            sObjectAccessor->AddUpdateObject(this);
-            m_objectUpdated = true;
+            AddToObjectUpdate();
         }
 
         return true;
@@ -1312,8 +1420,7 @@ void Object::SetFloatValue(uint16 index, float value)
 
         if (m_inWorld && !m_objectUpdated)
         {
-            sObjectAccessor->AddUpdateObject(this);
-            m_objectUpdated = true;
+            AddToObjectUpdate();
         }
     }
 }
@@ -1336,8 +1443,7 @@ void Object::SetByteValue(uint16 index, uint8 offset, uint8 value)
 
         if (m_inWorld && !m_objectUpdated)
         {
-            sObjectAccessor->AddUpdateObject(this);
-            m_objectUpdated = true;
+            AddToObjectUpdate();
         }
     }
 }
@@ -1360,8 +1466,7 @@ void Object::SetUInt16Value(uint16 index, uint8 offset, uint16 value)
 
         if (m_inWorld && !m_objectUpdated)
         {
-            sObjectAccessor->AddUpdateObject(this);
-            m_objectUpdated = true;
+            AddToObjectUpdate();
         }
     }
 }
@@ -1427,8 +1532,7 @@ void Object::SetFlag(uint16 index, uint32 newFlag)
 
         if (m_inWorld && !m_objectUpdated)
         {
-            sObjectAccessor->AddUpdateObject(this);
-            m_objectUpdated = true;
+            AddToObjectUpdate();
         }
     }
 }
@@ -1448,8 +1552,7 @@ void Object::RemoveFlag(uint16 index, uint32 oldFlag)
 
         if (m_inWorld && !m_objectUpdated)
         {
-            sObjectAccessor->AddUpdateObject(this);
-            m_objectUpdated = true;
+            AddToObjectUpdate();
         }
     }
 }
@@ -1471,8 +1574,7 @@ void Object::SetByteFlag(uint16 index, uint8 offset, uint8 newFlag)
 
         if (m_inWorld && !m_objectUpdated)
         {
-            sObjectAccessor->AddUpdateObject(this);
-            m_objectUpdated = true;
+            AddToObjectUpdate();
         }
     }
 }
@@ -1494,8 +1596,7 @@ void Object::RemoveByteFlag(uint16 index, uint8 offset, uint8 oldFlag)
 
         if (m_inWorld && !m_objectUpdated)
         {
-            sObjectAccessor->AddUpdateObject(this);
-            m_objectUpdated = true;
+            AddToObjectUpdate();
         }
     }
 }
@@ -1535,8 +1636,7 @@ void Object::AddDynamicValue(uint16 index, uint32 value)
 
     if (m_inWorld && !m_objectUpdated)
     {
-        sObjectAccessor->AddUpdateObject(this);
-        m_objectUpdated = true;
+        AddToObjectUpdate();
     }
 }
 
@@ -1570,8 +1670,7 @@ void Object::AddDynamicGuidValue(uint16 p_Index, uint64 p_Guid)
 
     if (m_inWorld && !m_objectUpdated)
     {
-        sObjectAccessor->AddUpdateObject(this);
-        m_objectUpdated = true;
+        AddToObjectUpdate();
     }
 }
 
@@ -1586,8 +1685,7 @@ void Object::RemoveDynamicValue(uint16 index, uint32 offset)
 
     if (m_inWorld && !m_objectUpdated)
     {
-        sObjectAccessor->AddUpdateObject(this);
-        m_objectUpdated = true;
+        AddToObjectUpdate();
     }
 }
 
@@ -1603,8 +1701,7 @@ void Object::ClearDynamicValue(uint16 index)
 
         if (m_inWorld && !m_objectUpdated)
         {
-            sObjectAccessor->AddUpdateObject(this);
-            m_objectUpdated = true;
+            AddToObjectUpdate();
         }
     }
 }
@@ -1631,8 +1728,7 @@ void Object::SetDynamicValue(uint16 index, uint8 offset, uint32 value)
 
         if (m_inWorld && !m_objectUpdated)
         {
-            sObjectAccessor->AddUpdateObject(this);
-            m_objectUpdated = true;
+            AddToObjectUpdate();
         }
     }
 }
@@ -1745,7 +1841,8 @@ void MovementInfo::Normalize()
 WorldObject::WorldObject(bool isWorldObject): WorldLocation(),
  m_zoneScript(NULL), m_name(""), m_isActive(false), m_isWorldObject(isWorldObject),
 m_transport(NULL), m_currMap(NULL), m_InstanceId(0),
-m_phaseMask(PHASEMASK_NORMAL), m_AIAnimKitId(0), m_MovementAnimKitId(0), m_MeleeAnimKitId(0)
+m_phaseMask(PHASEMASK_NORMAL), m_AIAnimKitId(0), m_MovementAnimKitId(0), m_MeleeAnimKitId(0),
+m_SpatialCell(nullptr), m_SpatialSlot(0)
 {
     m_serverSideVisibility.SetValue(SERVERSIDE_VISIBILITY_GHOST, GHOST_VISIBILITY_ALIVE | GHOST_VISIBILITY_GHOST);
     m_serverSideVisibilityDetect.SetValue(SERVERSIDE_VISIBILITY_GHOST, GHOST_VISIBILITY_ALIVE);
@@ -1754,6 +1851,11 @@ m_phaseMask(PHASEMASK_NORMAL), m_AIAnimKitId(0), m_MovementAnimKitId(0), m_Melee
     m_summonCounter = 0;
 }
 
+void WorldObject::UpdateSpatialIndex()
+{
+    m_currMap->GetUnitSpatialIndex().Relocate(ToUnit());
+}
+
 void WorldObject::SetWorldObject(bool on)
 {
     if (!IsInWorld())
@@ -2609,8 +2711,7 @@ void Object::ForceValuesUpdateAtIndex(uint32 i)
     _changesMask.SetBit(i);
     if (m_inWorld && !m_objectUpdated)
     {
-        sObjectAccessor->AddUpdateObject(this);
-        m_objectUpdated = true;
+        AddToObjectUpdate();
     }
 }
 
@@ -4131,7 +4232,9 @@ void WorldObject::BuildUpdate(UpdateDataMapType& data_map)
         TypeContainerVisitor<WorldObjectChangeAccumulator, WorldTypeMapContainer > player_notifier(notifier);
         Map& map = *GetMap();
         //we must build packets for all visible players
+        EnableValuesUpdateCache();
         cell.Visit(p, player_notifier, map, *this, GetVisibilityRange());
+        DisableValuesUpdateCache();
     }
 
     ClearUpdateMask(false);
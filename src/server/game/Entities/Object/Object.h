@@ -110,6 +110,8 @@ class CreatureAI;
 class ZoneScript;
 class Unit;
 class Transport;
+class UnitSpatialIndex;
+struct SpatialCell;
 
 typedef std::unordered_set<uint64> GuidUnorderedSet;
 typedef std::unordered_map<Player*, UpdateData> UpdateDataMapType;
@@ -361,6 +363,18 @@ class Object
 
         void ClearUpdateMask(bool remove);
 
+        /// Objects with pending value changes are listed by their map, and sent at the end of its update
+        /// Objects without a known map are listed by ObjectAccessor, and sent by the world thread
+        void AddToObjectUpdate();
+        void RemoveFromObjectUpdate();
+
+        /// Move the pending update to the map now returned by GetObjectUpdateMap
+        /// @p_LeftMap map which must not list the object anymore
+        void MoveObjectUpdate(Map const* p_LeftMap);
+
+        /// Map holding the object in its list of objects to update, nullptr if not known yet
+        virtual Map* GetObjectUpdateMap() const { return nullptr; }
+
         uint16 GetValuesCount() const { return m_valuesCount; }
 
         // Dynamic Field function
@@ -417,12 +431,24 @@ class Object
         void _LoadIntoDataField(const char* p_Data, uint32 p_StartOffset, uint32 p_Count, bool p_Force);
 
         uint32 GetUpdateFieldData(Player const* target, uint32*& flags) const;
+
         uint32 GetDynamicUpdateFieldData(Player const* target, uint32*& flags) const;
 
         void BuildMovementUpdate(ByteBuffer * data, uint32 flags) const;
         virtual void BuildValuesUpdate(uint8 updatetype, ByteBuffer* data, Player* target) const;
         virtual void BuildDynamicValuesUpdate(uint8 updateType, ByteBuffer* data, Player* target) const;
 
+        /// Values blocks only depend on the visibility flags of the observer while the object is broadcasted,
+        /// observers sharing the same flags reuse the block serialized for the first of them
+        void EnableValuesUpdateCache();
+        void DisableValuesUpdateCache();
+        /// Fields of a values block adjusted for each observer, as field index and offset of the value in the block
+        typedef std::vector<std::pair<uint16, uint32>> ValuesUpdateTargetFields;
+
+        bool AppendCachedValuesUpdate(uint8 p_UpdateType, uint32 p_VisibleFlags, ByteBuffer* p_Data, Player* p_Target) const;
+        void StoreValuesUpdate(uint8 p_UpdateType, uint32 p_VisibleFlags, ByteBuffer const* p_Data, size_t p_StartPos, ValuesUpdateTargetFields const* p_TargetFields = nullptr) const;
+        virtual uint32 GetValuesUpdateFieldForTarget(uint16 p_Index, Player* /*p_Target*/) const { return m_uint32Values[p_Index]; }
+
         uint16 m_objectType;
 
         TypeID m_objectTypeId;
@@ -440,6 +466,7 @@ class Object
         uint16 _fieldNotifyFlags;
 
         bool m_objectUpdated;
+        Map* m_objectUpdateMap;
 
         std::vector<uint32>* _dynamicValues;
         uint32 _dynamicValuesCount;
@@ -448,6 +475,17 @@ class Object
         UpdateMask* _dynamicChangesArrayMask;
 
     private:
+        struct ValuesUpdateCacheEntry
+        {
+            uint8 UpdateType;
+            uint32 VisibleFlags;
+            ByteBuffer Block;
+            ValuesUpdateTargetFields TargetFields;
+        };
+
+        bool m_ValuesUpdateCacheEnabled;
+        mutable std::vector<ValuesUpdateCacheEntry> m_ValuesUpdateCache;
+
         bool m_inWorld;
 #ifdef CROSS
 
@@ -845,11 +883,20 @@ class MapObject
 
 class WorldObject : public Object, public WorldLocation
 {
+    friend class UnitSpatialIndex;
+
     protected:
         explicit WorldObject(bool isWorldObject); //note: here it means if it is in grid object list or world object list
     public:
         virtual ~WorldObject();
 
+        /// Position::Relocate plus the update of the spatial index of the map for units in world
+        void Relocate(float x, float y)                         { Position::Relocate(x, y); if (m_SpatialCell) UpdateSpatialIndex(); }
+        void Relocate(float x, float y, float z)                { Position::Relocate(x, y, z); if (m_SpatialCell) UpdateSpatialIndex(); }
+        void Relocate(float x, float y, float z, float o)       { Position::Relocate(x, y, z, o); if (m_SpatialCell) UpdateSpatialIndex(); }
+        void Relocate(Position const& pos)                      { Position::Relocate(pos); if (m_SpatialCell) UpdateSpatialIndex(); }
+        void Relocate(Position const* pos)                      { Position::Relocate(pos); if (m_SpatialCell) UpdateSpatialIndex(); }
+
         virtual void Update (uint32 /*time_diff*/) { }
 
         void _Create(uint32 guidlow, HighGuid guidhigh, uint32 phaseMask);
@@ -1113,6 +1160,7 @@ class WorldObject : public Object, public WorldLocation
         void DestroyForNearbyPlayers();
         virtual void UpdateObjectVisibility(bool forced = true);
         void BuildUpdate(UpdateDataMapType&);
+        Map* GetObjectUpdateMap() const override { return m_currMap; }
 
         bool isActiveObject() const { return m_isActive; }
         void setActive(bool isActiveObject);
@@ -1218,6 +1266,11 @@ class WorldObject : public Object, public WorldLocation
         uint16 m_AIAnimKitId;
         uint16 m_MovementAnimKitId;
         uint16 m_MeleeAnimKitId;
+
+        void UpdateSpatialIndex();
+
+        SpatialCell* m_SpatialCell;                         ///< Set while the unit is in the UnitSpatialIndex of its map
+        uint32 m_SpatialSlot;
 };
 
 namespace JadeCore
@@ -8,6 +8,7 @@
 
 #include "Common.h"
 #include "UpdateFieldFlags.h"
+#include "Errors.h"
 
 uint32 ContainerUpdateFieldFlags[CONTAINER_END]
 {
@@ -4057,3 +4058,49 @@ uint32 ConversationDynamicUpdateFieldFlags[CONVERSATION_DYNAMIC_END]
     UF_FLAG_PUBLIC, // CONVERSATION_DYNAMIC_FIELD_ACTORS
     UF_FLAG_VIEWER_DEPENDENT, // CONVERSATION_DYNAMIC_FIELD_LINES
 };
+
+UpdateFieldFlagsMasks::UpdateFieldFlagsMasks(uint32 const* p_Flags, uint32 p_Count)
+{
+    uint32 l_BlockCount = (p_Count + 31) / 32;
+    for (uint32 l_Bit = 0; l_Bit < MAX_UPDATE_FIELD_FLAG_BITS; ++l_Bit)
+        m_Masks[l_Bit].assign(l_BlockCount, 0);
+
+    for (uint32 l_Index = 0; l_Index < p_Count; ++l_Index)
+    {
+        for (uint32 l_Bit = 0; l_Bit < MAX_UPDATE_FIELD_FLAG_BITS; ++l_Bit)
+        {
+            if (p_Flags[l_Index] & (1 << l_Bit))
+                m_Masks[l_Bit][l_Index / 32] |= 1 << (l_Index % 32);
+        }
+    }
+}
+
+static UpdateFieldFlagsMasks const s_ContainerUpdateFieldMasks(ContainerUpdateFieldFlags, CONTAINER_END);
+static UpdateFieldFlagsMasks const s_PlayerUpdateFieldMasks(PlayerUpdateFieldFlags, PLAYER_END);
+static UpdateFieldFlagsMasks const s_GameObjectUpdateFieldMasks(GameObjectUpdateFieldFlags, GAMEOBJECT_END);
+static UpdateFieldFlagsMasks const s_DynamicObjectUpdateFieldMasks(DynamicObjectUpdateFieldFlags, DYNAMICOBJECT_END);
+static UpdateFieldFlagsMasks const s_CorpseUpdateFieldMasks(CorpseUpdateFieldFlags, CORPSE_END);
+static UpdateFieldFlagsMasks const s_AreaTriggerUpdateFieldMasks(AreaTriggerUpdateFieldFlags, AREATRIGGER_END);
+static UpdateFieldFlagsMasks const s_SceneObjectUpdateFieldMasks(SceneObjectUpdateFieldFlags, SCENEOBJECT_END);
+static UpdateFieldFlagsMasks const s_ConversationUpdateFieldMasks(ConversationUpdateFieldFlags, CONVERSATION_END);
+
+UpdateFieldFlagsMasks const& GetUpdateFieldFlagsMasks(uint32 const* p_Flags)
+{
+    if (p_Flags == ContainerUpdateFieldFlags)
+        return s_ContainerUpdateFieldMasks;
+    if (p_Flags == PlayerUpdateFieldFlags)
+        return s_PlayerUpdateFieldMasks;
+    if (p_Flags == GameObjectUpdateFieldFlags)
+        return s_GameObjectUpdateFieldMasks;
+    if (p_Flags == DynamicObjectUpdateFieldFlags)
+        return s_DynamicObjectUpdateFieldMasks;
+    if (p_Flags == CorpseUpdateFieldFlags)
+        return s_CorpseUpdateFieldMasks;
+    if (p_Flags == AreaTriggerUpdateFieldFlags)
+        return s_AreaTriggerUpdateFieldMasks;
+    if (p_Flags == SceneObjectUpdateFieldFlags)
+        return s_SceneObjectUpdateFieldMasks;
+
+    ASSERT(p_Flags == ConversationUpdateFieldFlags);
+    return s_ConversationUpdateFieldMasks;
+}
@@ -12,6 +12,8 @@
 #include "UpdateFields.h"
 #include "Define.h"
 
+#include <vector>
+
 enum UpdatefieldFlags
 {
     UF_FLAG_NONE                = 0x000,
@@ -41,4 +43,33 @@ extern uint32 SceneObjectUpdateFieldFlags[SCENEOBJECT_END];
 extern uint32 ConversationUpdateFieldFlags[CONVERSATION_END];
 extern uint32 ConversationDynamicUpdateFieldFlags[CONVERSATION_DYNAMIC_END];
 
+#define MAX_UPDATE_FIELD_FLAG_BITS 11
+
+/// Fields carrying each UF_FLAG_* bit of an update field flags array, stored as UpdateMask blocks
+/// so the fields an observer may see can be selected 32 at a time
+class UpdateFieldFlagsMasks
+{
+    public:
+        UpdateFieldFlagsMasks(uint32 const* p_Flags, uint32 p_Count);
+
+        /// Fields of the block having at least one of p_Flags
+        uint32 GetBlock(uint32 p_Flags, uint32 p_Block) const
+        {
+            uint32 l_Result = 0;
+            for (uint32 l_Bit = 0; l_Bit < MAX_UPDATE_FIELD_FLAG_BITS; ++l_Bit)
+            {
+                if (p_Flags & (1 << l_Bit))
+                    l_Result |= m_Masks[l_Bit][p_Block];
+            }
+
+            return l_Result;
+        }
+
+    private:
+        std::vector<uint32> m_Masks[MAX_UPDATE_FIELD_FLAG_BITS];
+};
+
+/// Returns the masks built from one of the values flags arrays above
+UpdateFieldFlagsMasks const& GetUpdateFieldFlagsMasks(uint32 const* p_Flags);
+
 #endif // _UPDATEFIELDFLAGS_H
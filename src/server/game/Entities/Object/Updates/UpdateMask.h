@@ -13,6 +13,10 @@
 #include "Errors.h"
 #include "ByteBuffer.h"
 
+#if COMPILER == COMPILER_MICROSOFT
+#  include <intrin.h>
+#endif
+
 class UpdateMask
 {
     public:
@@ -26,11 +30,11 @@ class UpdateMask
 
         UpdateMask() : _fieldCount(0), _blockCount(0), _bits(nullptr) { }
 
-        UpdateMask(UpdateMask const& right) : _bits(nullptr)
+        UpdateMask(UpdateMask const& right) : _fieldCount(0), _blockCount(0), _bits(nullptr)
         {
             SetCount(right.GetCount());
             if (right._bits)
-                memcpy(_bits, right._bits, sizeof (uint8) * _blockCount * 32);
+                memcpy(_bits, right._bits, sizeof(ClientUpdateMaskType) * _blockCount);
         }
 
         ~UpdateMask()
@@ -42,23 +46,39 @@ class UpdateMask
             }
         }
 
-        void SetBit(uint32 index) { _bits[index] = 1; }
-        void UnsetBit(uint32 index) { _bits[index] = 0; }
-        bool GetBit(uint32 index) const { return _bits[index] != 0; }
+        void SetBit(uint32 index) { _bits[index / CLIENT_UPDATE_MASK_BITS] |= ClientUpdateMaskType(1) << (index % CLIENT_UPDATE_MASK_BITS); }
+        void UnsetBit(uint32 index) { _bits[index / CLIENT_UPDATE_MASK_BITS] &= ~(ClientUpdateMaskType(1) << (index % CLIENT_UPDATE_MASK_BITS)); }
+        bool GetBit(uint32 index) const { return (_bits[index / CLIENT_UPDATE_MASK_BITS] & (ClientUpdateMaskType(1) << (index % CLIENT_UPDATE_MASK_BITS))) != 0; }
+
+        /// Bits are stored the way the client reads them, a whole block can be scanned at once
+        ClientUpdateMaskType GetBlock(uint32 block) const { return _bits[block]; }
+
+        /// Mask of the bits of a block which map to an existing field
+        ClientUpdateMaskType GetBlockFieldMask(uint32 block) const
+        {
+            uint32 l_Remaining = _fieldCount - block * CLIENT_UPDATE_MASK_BITS;
+            if (l_Remaining >= CLIENT_UPDATE_MASK_BITS)
+                return ~ClientUpdateMaskType(0);
+
+            return (ClientUpdateMaskType(1) << l_Remaining) - 1;
+        }
+
+        /// Returns the lowest set bit of a non zero block
+        static uint32 GetLowestBit(ClientUpdateMaskType block)
+        {
+#if COMPILER == COMPILER_MICROSOFT
+            unsigned long l_Index;
+            _BitScanForward(&l_Index, block);
+            return uint32(l_Index);
+#else
+            return uint32(__builtin_ctz(block));
+#endif
+        }
 
         void AppendToPacket(ByteBuffer* data)
         {
             for (uint32 i = 0; i < GetBlockCount(); ++i)
-            {
-                ClientUpdateMaskType maskPart = 0;
-                for (uint32 j = 0; j < CLIENT_UPDATE_MASK_BITS; ++j)
-                {
-                    if (_bits[CLIENT_UPDATE_MASK_BITS * i + j])
-                        maskPart |= 1 << j;
-                }
-
-                *data << maskPart;
-            }
+                *data << _bits[i];
         }
 
         uint32 GetBlockCount() const { return _blockCount; }
@@ -78,21 +98,21 @@ class UpdateMask
             if (!valuesCount)
                 return;
 
-            _bits = new uint8[_blockCount * CLIENT_UPDATE_MASK_BITS];
-            memset(_bits, 0, sizeof (uint8) * _blockCount * CLIENT_UPDATE_MASK_BITS);
+            _bits = new ClientUpdateMaskType[_blockCount];
+            memset(_bits, 0, sizeof(ClientUpdateMaskType) * _blockCount);
         }
 
         void AddBlock()
         {
-            uint8* curr = _bits;
+            ClientUpdateMaskType* curr = _bits;
             _fieldCount += CLIENT_UPDATE_MASK_BITS;
             ++_blockCount;
 
-            _bits = new uint8[_blockCount * CLIENT_UPDATE_MASK_BITS];
-            memset(&_bits[(_blockCount - 1) * CLIENT_UPDATE_MASK_BITS], 0, sizeof (uint8) * CLIENT_UPDATE_MASK_BITS);
+            _bits = new ClientUpdateMaskType[_blockCount];
+            _bits[_blockCount - 1] = 0;
             if (curr)
             {
-                memcpy(_bits, curr, sizeof (uint8) * (_blockCount - 1) * CLIENT_UPDATE_MASK_BITS);
+                memcpy(_bits, curr, sizeof(ClientUpdateMaskType) * (_blockCount - 1));
                 delete[] curr;
             }
         }
@@ -100,7 +120,7 @@ class UpdateMask
         void Clear()
         {
             if (_bits)
-                memset(_bits, 0, sizeof (uint8) * _blockCount * CLIENT_UPDATE_MASK_BITS);
+                memset(_bits, 0, sizeof(ClientUpdateMaskType) * _blockCount);
         }
 
         UpdateMask& operator=(UpdateMask const& right)
@@ -109,14 +129,15 @@ class UpdateMask
                 return *this;
 
             SetCount(right.GetCount());
-            memcpy(_bits, right._bits, sizeof (uint8) * _blockCount * CLIENT_UPDATE_MASK_BITS);
+            if (right._bits)
+                memcpy(_bits, right._bits, sizeof(ClientUpdateMaskType) * _blockCount);
             return *this;
         }
 
         UpdateMask& operator&=(UpdateMask const& right)
         {
             ASSERT(right.GetCount() <= GetCount());
-            for (uint32 i = 0; i < _fieldCount; ++i)
+            for (uint32 i = 0; i < right._blockCount; ++i)
                 _bits[i] &= right._bits[i];
 
             return *this;
@@ -125,7 +146,7 @@ class UpdateMask
         UpdateMask& operator|=(UpdateMask const& right)
         {
             ASSERT(right.GetCount() <= GetCount());
-            for (uint32 i = 0; i < _fieldCount; ++i)
+            for (uint32 i = 0; i < right._blockCount; ++i)
                 _bits[i] |= right._bits[i];
 
             return *this;
@@ -141,7 +162,7 @@ class UpdateMask
     private:
         uint32 _fieldCount;
         uint32 _blockCount;
-        uint8* _bits;
+        ClientUpdateMaskType* _bits;
 };
 
 #endif
@@ -967,7 +967,7 @@ bool Guardian::InitStatsForLevel(uint8 p_PetLevel)
         if (sObjectMgr->GetCreatureModelInfo(GetDisplayId()) && l_Owner)
         {
             SetFloatValue(UNIT_FIELD_BOUNDING_RADIUS, l_Owner->GetFloatValue(UNIT_FIELD_BOUNDING_RADIUS));
-            SetFloatValue(UNIT_FIELD_COMBAT_REACH, l_Owner->GetFloatValue(UNIT_FIELD_COMBAT_REACH));
+            SetCombatReach(l_Owner->GetFloatValue(UNIT_FIELD_COMBAT_REACH));
         }
     }
 
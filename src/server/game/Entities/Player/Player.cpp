@@ -435,6 +435,8 @@ Player::Player(WorldSession* session) : Unit(true), m_achievementMgr(this), m_re
 
     m_glyphsChanged = false;
 
+    ResetSavedRows();
+
     for (uint8 i = 0; i < BASEMOD_END; ++i)
     {
         m_auraBaseMod[i][FLAT_MOD] = 0.0f;
@@ -706,7 +708,7 @@ bool Player::Create(uint32 guidlow, CharacterCreateInfo* createInfo)
     uint8 powertype = cEntry->DisplayPower;
 
     SetFloatValue(UNIT_FIELD_BOUNDING_RADIUS, DEFAULT_WORLD_OBJECT_SIZE);
-    SetFloatValue(UNIT_FIELD_COMBAT_REACH, 1.5f);
+    SetCombatReach(1.5f);
 
     setFactionForRace(createInfo->Race);
 
@@ -5861,10 +5863,6 @@ void Player::_LoadChargesCooldowns(PreparedQueryResult p_Result)
 
 void Player::_SaveSpellCooldowns(SQLTransaction& trans)
 {
-    PreparedStatement* stmt = RealmDatabase.GetPreparedStatement(CHAR_DEL_CHAR_SPELL_COOLDOWN);
-    stmt->setUInt32(0, GetRealGUIDLow());
-    trans->Append(stmt);
-
     uint64 curTime = 0;
     ACE_OS::gettimeofday().msec(curTime);
     uint64 infTime = curTime + infinityCooldownDelayCheck;
@@ -5893,6 +5891,17 @@ void Player::_SaveSpellCooldowns(SQLTransaction& trans)
         else
             ++itr;
     }
+
+    // cooldowns are stored with their end time, the rows only change when a cooldown starts or ends
+    if (ss.str() == m_SavedSpellCooldownsRows)
+        return;
+
+    m_SavedSpellCooldownsRows = ss.str();
+
+    PreparedStatement* stmt = RealmDatabase.GetPreparedStatement(CHAR_DEL_CHAR_SPELL_COOLDOWN);
+    stmt->setUInt32(0, GetRealGUIDLow());
+    trans->Append(stmt);
+
     // if something changed execute
     if (!first_round)
         trans->Append(ss.str().c_str());
@@ -5906,6 +5915,20 @@ void Player::_SaveChargesCooldowns(SQLTransaction& p_Transaction)
     auto l_Database = &CharacterDatabase;
 #endif
 
+    /// Charges are stored with their recharge times, the rows only change when a charge is used or recovered
+    std::ostringstream l_Rows;
+
+    for (auto const& p : m_CategoryCharges)
+    {
+        for (ChargeEntry const& l_Charge : p.second)
+            l_Rows << p.first << ',' << uint32(Clock::to_time_t(l_Charge.RechargeStart)) << ',' << uint32(Clock::to_time_t(l_Charge.RechargeEnd)) << ';';
+    }
+
+    if (l_Rows.str() == m_SavedChargesCooldownsRows)
+        return;
+
+    m_SavedChargesCooldownsRows = l_Rows.str();
+
     PreparedStatement* l_Statement = l_Database->GetPreparedStatement(CHAR_DEL_CHARGES_COOLDOWN);
     l_Statement->setUInt32(0, GetRealGUIDLow());
     p_Transaction->Append(l_Statement);
@@ -21191,7 +21214,7 @@ bool Player::LoadFromDB(uint32 guid, SQLQueryHolder* holder, SQLQueryHolder* p_L
     _LoadIntoDataField(fields[60].GetCString(), PLAYER_FIELD_KNOWN_TITLES, KNOWN_TITLES_SIZE, true);
 
     SetFloatValue(UNIT_FIELD_BOUNDING_RADIUS, DEFAULT_WORLD_OBJECT_SIZE);
-    SetFloatValue(UNIT_FIELD_COMBAT_REACH, 1.5f);
+    SetCombatReach(1.5f);
     SetFloatValue(UNIT_FIELD_HOVER_HEIGHT, 1.0f);
 
     // load achievements before anything else to prevent multiple gains for the same achievement/criteria on every loading (as loading does call UpdateAchievementCriteria)
@@ -24058,7 +24081,21 @@ void Player::SaveToDB(bool create /*=false*/, MS::Utilities::CallBackPtr p_Callb
         l_Pet->Save(accountTrans);
     }
 
-    CommitTransaction(RealmDatabase, trans, p_Callback);
+    /// The rows kept by _SaveAuras and the cooldown saves are only known to be written once the transaction succeeded
+    uint64 l_PlayerGUID = GetGUID();
+    MS::Utilities::CallBackPtr l_CallBack = std::make_shared<MS::Utilities::Callback>([l_PlayerGUID, p_Callback](bool p_Success) -> void
+    {
+        if (!p_Success)
+        {
+            if (Player* l_Player = HashMapHolder<Player>::Find(l_PlayerGUID))
+                l_Player->ResetSavedRows();
+        }
+
+        if (p_Callback != nullptr)
+            p_Callback->m_CallBack(p_Success);
+    });
+
+    CommitTransaction(RealmDatabase, trans, l_CallBack);
     LoginDatabase.CommitTransaction(accountTrans);
 
     // we save the data here to prevent spamming
@@ -24136,12 +24173,11 @@ void Player::_SaveActions(SQLTransaction& trans)
 
 void Player::_SaveAuras(SQLTransaction& trans)
 {
-    PreparedStatement* stmt = RealmDatabase.GetPreparedStatement(CHAR_DEL_CHAR_AURA);
-    stmt->setUInt32(0, GetRealGUIDLow());
-    trans->Append(stmt);
-    stmt = RealmDatabase.GetPreparedStatement(CHAR_DEL_CHAR_AURA_EFFECT);
-    stmt->setUInt32(0, GetRealGUIDLow());
-    trans->Append(stmt);
+    /// Saved auras with their slot
+    std::vector<std::pair<Aura const*, uint8>> l_Auras;
+
+    /// Everything written for the auras but their durations, which change at each save of a timed aura
+    std::ostringstream l_Rows;
 
     for (AuraMap::const_iterator itr = m_ownedAuras.begin(); itr != m_ownedAuras.end(); ++itr)
     {
@@ -24154,10 +24190,55 @@ void Player::_SaveAuras(SQLTransaction& trans)
         if (!foundAura)
             continue;
 
+        l_Auras.emplace_back(aura, foundAura->GetSlot());
+
+        l_Rows << uint32(foundAura->GetSlot()) << ',' << aura->GetCasterGUID() << ',' << aura->GetCastItemGUID() << ',' << aura->GetId() << ','
+            << uint32(aura->GetStackAmount()) << ',' << uint32(aura->GetCharges()) << ',' << aura->GetCastItemLevel();
+
+        for (uint8 i = 0; i < aura->GetEffectCount(); ++i)
+        {
+            if (AuraEffect const* effect = aura->GetEffect(i))
+                l_Rows << ',' << uint32(i) << ':' << effect->GetBaseAmount() << ':' << effect->GetAmount() << ':' << effect->CanBeRecalculated();
+        }
+
+        l_Rows << ';';
+    }
+
+    PreparedStatement* stmt = NULL;
+
+    /// Nothing changed since the last save but the time left of the timed auras, only update it
+    if (l_Rows.str() == m_SavedAurasRows)
+    {
+        for (auto const& l_Aura : l_Auras)
+        {
+            if (l_Aura.first->IsPermanent())
+                continue;
+
+            stmt = RealmDatabase.GetPreparedStatement(CHAR_UPD_AURA_DURATION);
+            stmt->setInt32(0, l_Aura.first->GetMaxDuration());
+            stmt->setInt32(1, l_Aura.first->GetDuration());
+            stmt->setUInt32(2, GetRealGUIDLow());
+            stmt->setUInt8(3, l_Aura.second);
+            trans->Append(stmt);
+        }
+
+        return;
+    }
+
+    m_SavedAurasRows = l_Rows.str();
+
+    stmt = RealmDatabase.GetPreparedStatement(CHAR_DEL_CHAR_AURA);
+    stmt->setUInt32(0, GetRealGUIDLow());
+    trans->Append(stmt);
+    stmt = RealmDatabase.GetPreparedStatement(CHAR_DEL_CHAR_AURA_EFFECT);
+    stmt->setUInt32(0, GetRealGUIDLow());
+    trans->Append(stmt);
+
+    for (auto const& l_Aura : l_Auras)
+    {
+        Aura const* aura = l_Aura.first;
 
         uint8 index = 0;
-        int32 damage[SpellEffIndex::MAX_EFFECTS];
-        int32 baseDamage[SpellEffIndex::MAX_EFFECTS];
         uint32 effMask = 0;
         uint32 recalculateMask = 0;
         for (uint8 i = 0; i < aura->GetEffectCount(); ++i)
@@ -24167,39 +24248,32 @@ void Player::_SaveAuras(SQLTransaction& trans)
                 index = 0;
                 stmt = RealmDatabase.GetPreparedStatement(CHAR_INS_AURA_EFFECT);
                 stmt->setUInt32(index++, GetRealGUIDLow());
-                stmt->setUInt8(index++, foundAura->GetSlot());
+                stmt->setUInt8(index++, l_Aura.second);
                 stmt->setUInt8(index++, i);
                 stmt->setInt32(index++, effect->GetBaseAmount());
                 stmt->setInt32(index++, effect->GetAmount());
 
                 trans->Append(stmt);
 
-                baseDamage[i] = effect->GetBaseAmount();
-                damage[i] = effect->GetAmount();
                 effMask |= 1 << i;
                 if (effect->CanBeRecalculated())
                     recalculateMask |= 1 << i;
             }
-            else
-            {
-                baseDamage[i] = 0;
-                damage[i] = 0;
-            }
         }
 
         index = 0;
         stmt = RealmDatabase.GetPreparedStatement(CHAR_INS_AURA);
         stmt->setUInt32(index++, GetRealGUIDLow());
-        stmt->setUInt8(index++, foundAura->GetSlot());
-        stmt->setUInt64(index++, itr->second->GetCasterGUID());
-        stmt->setUInt64(index++, itr->second->GetCastItemGUID());
-        stmt->setUInt32(index++, itr->second->GetId());
+        stmt->setUInt8(index++, l_Aura.second);
+        stmt->setUInt64(index++, aura->GetCasterGUID());
+        stmt->setUInt64(index++, aura->GetCastItemGUID());
+        stmt->setUInt32(index++, aura->GetId());
         stmt->setUInt32(index++, effMask);
         stmt->setUInt32(index++, recalculateMask);
-        stmt->setUInt8(index++, itr->second->GetStackAmount());
-        stmt->setInt32(index++, itr->second->GetMaxDuration());
-        stmt->setInt32(index++, itr->second->GetDuration());
-        stmt->setUInt8(index++, itr->second->GetCharges());
+        stmt->setUInt8(index++, aura->GetStackAmount());
+        stmt->setInt32(index++, aura->GetMaxDuration());
+        stmt->setInt32(index++, aura->GetDuration());
+        stmt->setUInt8(index++, aura->GetCharges());
         stmt->setInt32(index++, aura->GetCastItemLevel());
         trans->Append(stmt);
     }
@@ -24643,6 +24717,10 @@ void Player::_SaveMonthlyQuestStatus(SQLTransaction& trans)
 void Player::_SaveSkills(SQLTransaction& trans)
 {
     PreparedStatement* stmt = NULL;
+
+    std::ostringstream l_DeletedSkills;
+    std::ostringstream l_NewSkills;
+
     // we don't need transactions here.
     for (SkillStatusMap::iterator itr = mSkillStatus.begin(); itr != mSkillStatus.end();)
     {
@@ -24654,10 +24732,10 @@ void Player::_SaveSkills(SQLTransaction& trans)
 
         if (itr->second.uState == SKILL_DELETED)
         {
-            stmt = RealmDatabase.GetPreparedStatement(CHAR_DEL_CHAR_SKILL_BY_SKILL);
-            stmt->setUInt32(0, GetRealGUIDLow());
-            stmt->setUInt32(1, itr->first);
-            trans->Append(stmt);
+            if (l_DeletedSkills.tellp() > 0)
+                l_DeletedSkills << ',';
+
+            l_DeletedSkills << itr->first;
 
             mSkillStatus.erase(itr++);
             continue;
@@ -24672,12 +24750,10 @@ void Player::_SaveSkills(SQLTransaction& trans)
         switch (itr->second.uState)
         {
             case SKILL_NEW:
-                stmt = RealmDatabase.GetPreparedStatement(CHAR_INS_CHAR_SKILLS);
-                stmt->setUInt32(0, GetRealGUIDLow());
-                stmt->setUInt16(1, uint16(itr->first));
-                stmt->setUInt16(2, value);
-                stmt->setUInt16(3, max);
-                trans->Append(stmt);
+                if (l_NewSkills.tellp() > 0)
+                    l_NewSkills << ',';
+
+                l_NewSkills << '(' << GetRealGUIDLow() << ',' << uint16(itr->first) << ',' << value << ',' << max << ')';
                 break;
             case SKILL_CHANGED:
                 stmt = RealmDatabase.GetPreparedStatement(CHAR_UDP_CHAR_SKILLS);
@@ -24694,6 +24770,16 @@ void Player::_SaveSkills(SQLTransaction& trans)
         itr->second.uState = SKILL_UNCHANGED;
         ++itr;
     }
+
+    if (l_DeletedSkills.tellp() > 0)
+    {
+        std::ostringstream l_Query;
+        l_Query << "DELETE FROM character_skills WHERE guid = " << GetRealGUIDLow() << " AND skill IN (" << l_DeletedSkills.str() << ")";
+        trans->Append(l_Query.str().c_str());
+    }
+
+    if (l_NewSkills.tellp() > 0)
+        trans->Append(("INSERT INTO character_skills (guid, skill, value, max) VALUES " + l_NewSkills.str()).c_str());
 }
 
 #define SKILL_MOUNT     777
@@ -24709,7 +24795,11 @@ void Player::_SaveSpells(SQLTransaction& charTrans, SQLTransaction& accountTrans
 #endif
 
     uint32 l_ShopGroupRealmMask = sWorld->getIntConfig(WorldIntConfigs::CONFIG_ACCOUNT_BIND_SHOP_GROUP_MASK);
-    PreparedStatement* stmt = NULL;
+
+    /// Changed rows are batched in one statement per table
+    std::ostringstream l_DeletedSpells;
+    std::ostringstream l_CharacterSpells;
+    std::ostringstream l_AccountSpells;
 
     for (PlayerSpellMap::iterator itr = m_spells.begin(); itr != m_spells.end();)
     {
@@ -24731,10 +24821,10 @@ void Player::_SaveSpells(SQLTransaction& charTrans, SQLTransaction& accountTrans
                 }
                 else
                 {
-                    stmt = RealmDatabase.GetPreparedStatement(CHAR_DEL_CHAR_SPELL_BY_SPELL);
-                    stmt->setUInt32(0, itr->first);
-                    stmt->setUInt32(1, GetRealGUIDLow());
-                    charTrans->Append(stmt);
+                    if (l_DeletedSpells.tellp() > 0)
+                        l_DeletedSpells << ',';
+
+                    l_DeletedSpells << itr->first;
                 }
             }
         }
@@ -24748,26 +24838,19 @@ void Player::_SaveSpells(SQLTransaction& charTrans, SQLTransaction& accountTrans
                     || spell->IsAbilityOfSkillType(SKILL_MINIPET))
                     && sWorld->CanBeSaveInLoginDatabase())
                 {
-                    stmt = LoginDatabase.GetPreparedStatement(LOGIN_INS_CHAR_SPELL);
-                    stmt->setUInt32(0, GetSession()->GetAccountId());
-                    stmt->setUInt32(1, itr->first);
-                    stmt->setBool(2, itr->second->active);
-                    stmt->setBool(3, itr->second->disabled);
-                    stmt->setBool(4, itr->second->IsMountFavorite);
-                    stmt->setUInt32(5, itr->second->FromShopItem ? l_ShopGroupRealmMask : l_GroupRealmMask);
-                    stmt->setUInt32(6, itr->second->FromShopItem ? l_ShopGroupRealmMask : l_GroupRealmMask);
-
-                    accountTrans->Append(stmt);
+                    if (l_AccountSpells.tellp() > 0)
+                        l_AccountSpells << ',';
+
+                    l_AccountSpells << '(' << GetSession()->GetAccountId() << ',' << itr->first << ',' << uint32(itr->second->active) << ',' << uint32(itr->second->disabled) << ','
+                        << uint32(itr->second->IsMountFavorite) << ',' << (itr->second->FromShopItem ? l_ShopGroupRealmMask : l_GroupRealmMask) << ')';
                 }
                 else
                 {
-                    stmt = RealmDatabase.GetPreparedStatement(CHAR_INS_CHAR_SPELL);
-                    stmt->setUInt32(0, GetRealGUIDLow());
-                    stmt->setUInt32(1, itr->first);
-                    stmt->setBool(2, itr->second->active);
-                    stmt->setBool(3, itr->second->disabled);
-                    stmt->setBool(4, itr->second->IsMountFavorite);
-                    charTrans->Append(stmt);
+                    if (l_CharacterSpells.tellp() > 0)
+                        l_CharacterSpells << ',';
+
+                    l_CharacterSpells << '(' << GetRealGUIDLow() << ',' << itr->first << ',' << uint32(itr->second->active) << ',' << uint32(itr->second->disabled) << ','
+                        << uint32(itr->second->IsMountFavorite) << ')';
                 }
             }
         }
@@ -24783,6 +24866,20 @@ void Player::_SaveSpells(SQLTransaction& charTrans, SQLTransaction& accountTrans
             ++itr;
         }
     }
+
+    if (l_DeletedSpells.tellp() > 0)
+    {
+        std::ostringstream l_Query;
+        l_Query << "DELETE FROM character_spell WHERE guid = " << GetRealGUIDLow() << " AND spell IN (" << l_DeletedSpells.str() << ")";
+        charTrans->Append(l_Query.str().c_str());
+    }
+
+    if (l_CharacterSpells.tellp() > 0)
+        charTrans->Append(("REPLACE INTO character_spell (guid, spell, active, disabled, IsMountFavorite) VALUES " + l_CharacterSpells.str()).c_str());
+
+    if (l_AccountSpells.tellp() > 0)
+        accountTrans->Append(("INSERT INTO account_spell (accountId, spell, active, disabled, IsMountFavorite, groupRealmMask) VALUES " + l_AccountSpells.str()
+            + " ON DUPLICATE KEY UPDATE groupRealmMask = groupRealmMask | VALUES(groupRealmMask)").c_str());
 }
 
 // save player stats -- only for external usage
@@ -31832,7 +31929,8 @@ void Player::_LoadTalents(PreparedQueryResult result)
 
 void Player::_SaveTalents(SQLTransaction& trans)
 {
-    PreparedStatement* stmt = NULL;
+    std::ostringstream l_DeletedTalents;
+    std::ostringstream l_NewTalents;
 
     for (uint8 i = 0; i < MAX_TALENT_SPECS; ++i)
     {
@@ -31840,11 +31938,10 @@ void Player::_SaveTalents(SQLTransaction& trans)
         {
             if (itr->second->state == PLAYERSPELL_REMOVED || itr->second->state == PLAYERSPELL_CHANGED)
             {
-                stmt = RealmDatabase.GetPreparedStatement(CHAR_DEL_CHAR_TALENT_BY_SPELL_SPEC);
-                stmt->setUInt32(0, GetRealGUIDLow());
-                stmt->setUInt32(1, itr->first);
-                stmt->setUInt8(2, itr->second->spec);
-                trans->Append(stmt);
+                if (l_DeletedTalents.tellp() > 0)
+                    l_DeletedTalents << ',';
+
+                l_DeletedTalents << '(' << itr->first << ',' << uint32(itr->second->spec) << ')';
             }
 
             if (itr->second->state == PLAYERSPELL_NEW || itr->second->state == PLAYERSPELL_CHANGED)
@@ -31855,11 +31952,10 @@ void Player::_SaveTalents(SQLTransaction& trans)
                     continue;
                 }
 
-                stmt = RealmDatabase.GetPreparedStatement(CHAR_INS_CHAR_TALENT);
-                stmt->setUInt32(0, GetRealGUIDLow());
-                stmt->setUInt32(1, itr->first);
-                stmt->setUInt8(2, itr->second->spec);
-                trans->Append(stmt);
+                if (l_NewTalents.tellp() > 0)
+                    l_NewTalents << ',';
+
+                l_NewTalents << '(' << GetRealGUIDLow() << ',' << itr->first << ',' << uint32(itr->second->spec) << ')';
             }
 
             if (itr->second->state == PLAYERSPELL_REMOVED)
@@ -31874,6 +31970,16 @@ void Player::_SaveTalents(SQLTransaction& trans)
             }
         }
     }
+
+    if (l_DeletedTalents.tellp() > 0)
+    {
+        std::ostringstream l_Query;
+        l_Query << "DELETE FROM character_talent WHERE guid = " << GetRealGUIDLow() << " AND (spell, spec) IN (" << l_DeletedTalents.str() << ")";
+        trans->Append(l_Query.str().c_str());
+    }
+
+    if (l_NewTalents.tellp() > 0)
+        trans->Append(("REPLACE INTO character_talent (guid, spell, spec) VALUES " + l_NewTalents.str()).c_str());
 }
 
 void Player::UpdateSpecCount(uint8 count)
@@ -35837,7 +35943,7 @@ void Player::RemovePlayer()
         RemoveFromGrid();
 
     sObjectAccessor->RemoveObject(this);
-    sObjectAccessor->RemoveUpdateObject(this);
+    RemoveFromObjectUpdate();
 
     ResetMap();
 }
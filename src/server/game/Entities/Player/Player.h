@@ -2123,6 +2123,15 @@ class Player : public Unit, public GridObject<Player>
         void SaveInventoryAndGoldToDB(SQLTransaction& trans);                    // fast save function for item/money cheating preventing
         void SaveGoldToDB(SQLTransaction& trans);
 
+        /// Forget the rows of the last save, the next one rewrites auras and cooldowns
+        /// "-" never matches built rows
+        void ResetSavedRows()
+        {
+            m_SavedAurasRows            = "-";
+            m_SavedSpellCooldownsRows   = "-";
+            m_SavedChargesCooldownsRows = "-";
+        }
+
         static void SetUInt32ValueInArray(Tokenizer& data, uint16 index, uint32 value);
         static void SetFloatValueInArray(Tokenizer& data, uint16 index, float value);
         static void Customize(uint64 guid, uint8 gender, uint8 skin, uint8 face, uint8 hairStyle, uint8 hairColor, uint8 facialHair);
@@ -4072,6 +4081,12 @@ class Player : public Unit, public GridObject<Player>
 
         bool m_glyphsChanged;
 
+        /// Rows written by the last save of the collections rewritten as a whole, the save is skipped while they don't change
+        /// Aura durations aren't part of them, they are updated in place
+        std::string m_SavedAurasRows;
+        std::string m_SavedSpellCooldownsRows;
+        std::string m_SavedChargesCooldownsRows;
+
         ActionButtonList m_actionButtons;
 
         float m_auraBaseMod[BASEMOD_END][MOD_END];
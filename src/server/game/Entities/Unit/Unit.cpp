@@ -225,6 +225,8 @@ Unit::Unit(bool isWorldObject): WorldObject(isWorldObject)
     m_auraUpdateIterator = m_ownedAuras.end();
 
     m_interruptMask = 0;
+    m_ProcAuraWalks = 0;
+    m_ProcAuraDirty = false;
     m_transform = 0;
     m_canModifyStats = false;
 
@@ -626,6 +628,14 @@ bool Unit::IsWithinBoundaryRadius(Unit const* p_Unit) const
     return IsInDist(p_Unit, l_ObjBoundaryRadius);
 }
 
+void Unit::SetCombatReach(float p_Reach)
+{
+    SetFloatValue(UNIT_FIELD_COMBAT_REACH, p_Reach);
+
+    if (IsInWorld())
+        GetMap()->GetUnitSpatialIndex().UpdateReach(this);
+}
+
 void Unit::GetRandomContactPoint(const Unit* obj, float &x, float &y, float &z, float distance2dMin, float distance2dMax) const
 {
     float combat_reach = GetCombatReach();
@@ -3955,6 +3965,7 @@ AuraApplication * Unit::_CreateAuraApplication(Aura* aura, uint32 effMask)
 
     AuraApplication * aurApp = new AuraApplication(this, caster, aura, effMask);
     m_appliedAuras.insert(AuraApplicationMap::value_type(aurId, aurApp));
+    AddProcAura(aurApp);
 
     if (aurSpellInfo->AuraInterruptFlags)
     {
@@ -4055,6 +4066,7 @@ void Unit::_UnapplyAura(AuraApplicationMap::iterator &i, AuraRemoveMode removeMo
 
     // Remove all pointers from lists here to prevent possible pointer invalidation on spellcast/auraapply/auraremove
     m_appliedAuras.erase(i);
+    RemoveProcAura(aurApp);
 
     if (aura->GetSpellInfo()->AuraInterruptFlags)
     {
@@ -16348,6 +16360,7 @@ void Unit::AddToWorld()
     if (!IsInWorld())
     {
         WorldObject::AddToWorld();
+        GetMap()->GetUnitSpatialIndex().Insert(this);
     }
 }
 
@@ -16400,6 +16413,7 @@ void Unit::RemoveFromWorld()
             }
         }
 
+        GetMap()->GetUnitSpatialIndex().Remove(this);
         WorldObject::RemoveFromWorld();
         m_duringRemoveFromWorld = false;
     }
@@ -17086,13 +17100,20 @@ void Unit::ProcDamageAndSpellFor(bool isVictim, Unit* target, uint32 procFlag, u
     uint32 now = getMSTime();
 
     ProcTriggeredList procTriggered;
-    // Fill procTriggered list
-    for (AuraApplicationMap::const_iterator itr = GetAppliedAuras().begin(); itr!= GetAppliedAuras().end(); ++itr)
+    // Fill procTriggered list, only with the auras sharing a flag with the event
+    // Walked by index, the script hooks below may apply or remove auras
+    ++m_ProcAuraWalks;
+    for (size_t l_I = 0; l_I < m_ProcAuraApplications.size(); ++l_I)
     {
+        if (!(m_ProcAuraFlags[l_I] & procFlag))
+            continue;
+
+        AuraApplication* aurApp = m_ProcAuraApplications[l_I];
+
         // Do not allow auras to proc from effect triggered by itself
-        if (procAura && procAura->Id == itr->first)
+        if (procAura && procAura->Id == aurApp->GetBase()->GetId())
             continue;
-        ProcTriggeredData triggerData(itr->second->GetBase());
+        ProcTriggeredData triggerData(aurApp->GetBase());
 
         // Defensive procs are active on absorbs (so absorption effects are not a hindrance)
         bool active = (damage + absorb) || (procExtra & PROC_EX_BLOCK && isVictim);
@@ -17100,7 +17121,7 @@ void Unit::ProcDamageAndSpellFor(bool isVictim, Unit* target, uint32 procFlag, u
             procExtra &= ~PROC_EX_INTERNAL_REQ_FAMILY;
 
         // only auras that has triggered spell should proc from fully absorbed damage
-        SpellInfo const* spellProto = itr->second->GetBase()->GetSpellInfo();
+        SpellInfo const* spellProto = aurApp->GetBase()->GetSpellInfo();
         if ((procExtra & PROC_EX_ABSORB && isVictim) || (procFlag & PROC_FLAG_DONE_SPELL_MAGIC_DMG_CLASS_NEG))
         {
             bool triggerSpell = false;
@@ -17117,12 +17138,12 @@ void Unit::ProcDamageAndSpellFor(bool isVictim, Unit* target, uint32 procFlag, u
 
         // Custom MoP Script
         // Breath of Fire DoT shoudn't remove Breath of Fire disorientation - Hack Fix
-        if (procSpell && procSpell->Id == 123725 && itr->first == 123393)
+        if (procSpell && procSpell->Id == 123725 && aurApp->GetBase()->GetId() == 123393)
             continue;
 
         /// Custom WoD Script
         /// Ruthlessness can proc just from finishing spells
-        if (itr->first == 14161 && (!procSpell || (procSpell && procSpell->Id != 2098 && procSpell->Id != 408 && procSpell->Id != 26679 && procSpell->Id != 1943 && procSpell->Id != 121411)))
+        if (aurApp->GetBase()->GetId() == 14161 && (!procSpell || (procSpell && procSpell->Id != 2098 && procSpell->Id != 408 && procSpell->Id != 26679 && procSpell->Id != 1943 && procSpell->Id != 121411)))
             continue;
 
         /// Item - Druid T17 Restoration 4P Bonus - 167714
@@ -17137,7 +17158,7 @@ void Unit::ProcDamageAndSpellFor(bool isVictim, Unit* target, uint32 procFlag, u
             continue;
 
         // AuraScript Hook
-        if (!triggerData.aura->CallScriptCheckProcHandlers(itr->second, eventInfo))
+        if (!triggerData.aura->CallScriptCheckProcHandlers(aurApp, eventInfo))
             continue;
 
         bool procSuccess = RollProcResult(target, triggerData.aura, attType, isVictim, triggerData.spellProcEvent);
@@ -17149,11 +17170,11 @@ void Unit::ProcDamageAndSpellFor(bool isVictim, Unit* target, uint32 procFlag, u
         bool triggered = !(spellProto->AttributesEx3 & SPELL_ATTR3_CAN_PROC_WITH_TRIGGERED) ?
             (procExtra & PROC_EX_INTERNAL_TRIGGERED && !(procFlag & PROC_FLAG_DONE_TRAP_ACTIVATION)) : false;
 
-        for (uint8 i = 0; i < itr->second->GetEffectCount(); ++i)
+        for (uint8 i = 0; i < aurApp->GetEffectCount(); ++i)
         {
-            if (itr->second->HasEffect(i))
+            if (aurApp->HasEffect(i))
             {
-                AuraEffect* aurEff = itr->second->GetBase()->GetEffect(i);
+                AuraEffect* aurEff = aurApp->GetBase()->GetEffect(i);
                 // Skip this auras
                 if (isNonTriggerAura[aurEff->GetAuraType()])
                     continue;
@@ -17168,6 +17189,7 @@ void Unit::ProcDamageAndSpellFor(bool isVictim, Unit* target, uint32 procFlag, u
         if (triggerData.effMask)
             procTriggered.push_front(triggerData);
     }
+    EndProcAuraWalk();
 
     // Nothing found
     if (procTriggered.empty())
@@ -17539,17 +17561,23 @@ void Unit::GetProcAurasTriggeredOnEvent(std::list<AuraApplication*>& aurasTrigge
                 }
         }
     }
-    // or generate one on our own
+    // or generate one on our own, from the auras sharing a flag with the event
     else
     {
-        for (AuraApplicationMap::iterator itr = GetAppliedAuras().begin(); itr!= GetAppliedAuras().end(); ++itr)
+        ++m_ProcAuraWalks;
+        for (size_t l_I = 0; l_I < m_ProcAuraApplications.size(); ++l_I)
         {
-            if (itr->second->GetBase()->IsProcTriggeredOnEvent(itr->second, eventInfo))
+            if (!(m_ProcAuraFlags[l_I] & eventInfo.GetTypeMask()))
+                continue;
+
+            AuraApplication* aurApp = m_ProcAuraApplications[l_I];
+            if (aurApp->GetBase()->IsProcTriggeredOnEvent(aurApp, eventInfo))
             {
-                itr->second->GetBase()->PrepareProcToTrigger(itr->second, eventInfo);
-                aurasTriggeringProc.push_back(itr->second);
+                aurApp->GetBase()->PrepareProcToTrigger(aurApp, eventInfo);
+                aurasTriggeringProc.push_back(aurApp);
             }
         }
+        EndProcAuraWalk();
     }
 }
 
@@ -17903,20 +17931,27 @@ void Unit::UpdateStackOnDuration(uint32 p_Time)
     }
 }
 
-void Unit::GetAttackableUnitListInRange(std::list<Unit*> &list, float fMaxSearchRange) const
+/// Same result as an UnitListSearcher visiting p_Range around p_Searcher, for the checks based on IsWithinDistInMap
+template<class Check>
+static void SearchUnitsInObjectRange(Unit const* p_Searcher, std::list<Unit*>& p_List, float p_Range, Check& p_Check)
 {
-    CellCoord p(JadeCore::ComputeCellCoord(GetPositionX(), GetPositionY()));
-    Cell cell(p);
-    cell.SetNoCreate();
+    if (!p_Searcher->IsInWorld())
+        return;
 
-    JadeCore::AnyUnitInObjectRangeCheck u_check(this, fMaxSearchRange);
-    JadeCore::UnitListSearcher<JadeCore::AnyUnitInObjectRangeCheck> searcher(this, list, u_check);
+    uint32 l_PhaseMask = p_Searcher->GetPhaseMask();
 
-    TypeContainerVisitor<JadeCore::UnitListSearcher<JadeCore::AnyUnitInObjectRangeCheck>, WorldTypeMapContainer > world_unit_searcher(searcher);
-    TypeContainerVisitor<JadeCore::UnitListSearcher<JadeCore::AnyUnitInObjectRangeCheck>, GridTypeMapContainer >  grid_unit_searcher(searcher);
+    /// The check also counts the size of the searcher, the index only knows the one of the target
+    p_Searcher->GetMap()->GetUnitSpatialIndex().Visit(p_Searcher->GetPositionX(), p_Searcher->GetPositionY(), p_Range + p_Searcher->GetObjectSize(), [&](Unit* p_Unit) -> void
+    {
+        if (p_Unit->InSamePhase(l_PhaseMask) && p_Check(p_Unit))
+            p_List.push_back(p_Unit);
+    });
+}
 
-    cell.Visit(p, world_unit_searcher, *GetMap(), *this, fMaxSearchRange);
-    cell.Visit(p, grid_unit_searcher, *GetMap(), *this, fMaxSearchRange);
+void Unit::GetAttackableUnitListInRange(std::list<Unit*> &list, float fMaxSearchRange) const
+{
+    JadeCore::AnyUnitInObjectRangeCheck u_check(this, fMaxSearchRange);
+    SearchUnitsInObjectRange(this, list, fMaxSearchRange, u_check);
 }
 
 void Unit::GetAreatriggerListInRange(std::list<AreaTrigger*>& p_List, float p_Range) const
@@ -17982,8 +18017,7 @@ Unit* Unit::SelectNearbyTarget(Unit* exclude /*= NULL*/, float dist /*= NOMINAL_
 {
     std::list<Unit*> l_Targets;
     JadeCore::AnyUnfriendlyUnitInObjectRangeCheck u_check(this, this, dist);
-    JadeCore::UnitListSearcher<JadeCore::AnyUnfriendlyUnitInObjectRangeCheck> searcher(this, l_Targets, u_check);
-    VisitNearbyObject(dist, searcher);
+    SearchUnitsInObjectRange(this, l_Targets, dist, u_check);
 
     // remove current target
     if (!p_ExcludeVictim)
@@ -18045,8 +18079,7 @@ Unit* Unit::SelectNearbyAlly(Unit* exclude, float dist, bool p_CheckValidAssist
 {
     std::list<Unit*> targets;
     JadeCore::AnyFriendlyUnitInObjectRangeCheck u_check(this, this, dist);
-    JadeCore::UnitListSearcher<JadeCore::AnyFriendlyUnitInObjectRangeCheck> searcher(this, targets, u_check);
-    VisitNearbyObject(dist, searcher);
+    SearchUnitsInObjectRange(this, targets, dist, u_check);
 
     if (exclude)
         targets.remove(exclude);
@@ -18074,8 +18107,7 @@ Unit* Unit::SelectNearbyMostInjuredAlly(Unit* p_Exclude /*= nullptr*/, float p_D
 {
     std::list<Unit*> l_Targets;
     JadeCore::AnyFriendlyUnitInObjectRangeCheck l_Check(this, this, p_Dist);
-    JadeCore::UnitListSearcher<JadeCore::AnyFriendlyUnitInObjectRangeCheck> l_Searcher(this, l_Targets, l_Check);
-    VisitNearbyObject(p_Dist, l_Searcher);
+    SearchUnitsInObjectRange(this, l_Targets, p_Dist, l_Check);
 
     if (p_Exclude)
         l_Targets.remove(p_Exclude);
@@ -18417,6 +18449,113 @@ bool Unit::InitTamedPet(Pet* pet, uint8 level, uint32 spell_id)
     return true;
 }
 
+uint32 Unit::GetAuraProcFlags(SpellInfo const* p_SpellInfo)
+{
+    /// New proc system, see SpellMgr::CanSpellTriggerProcOnEvent
+    if (SpellProcEntry const* l_ProcEntry = sSpellMgr->GetSpellProcEntry(p_SpellInfo->Id))
+        return l_ProcEntry->typeMask;
+
+    /// Same flags as IsTriggeredAtSpellProcEvent
+    SpellProcEventEntry const* l_ProcEvent = sSpellMgr->GetSpellProcEvent(p_SpellInfo->Id);
+    uint32 l_ProcFlags = l_ProcEvent && l_ProcEvent->procFlags ? l_ProcEvent->procFlags : p_SpellInfo->ProcFlags;
+    if (!l_ProcFlags)
+        return 0;
+
+    /// Forced to proc by IsTriggeredAtSpellProcEvent whatever the event flags are
+    switch (p_SpellInfo->Id)
+    {
+        case 44448:
+        case 76669:
+        case 108446:
+        case 121152:
+        case 165459:
+        case 165476:
+            return 0xFFFFFFFF;
+        default:
+            break;
+    }
+
+    return l_ProcFlags;
+}
+
+void Unit::AddProcAura(AuraApplication* p_AurApp)
+{
+    uint32 l_ProcFlags = GetAuraProcFlags(p_AurApp->GetBase()->GetSpellInfo());
+    if (!l_ProcFlags)
+        return;
+
+    /// Appending keeps the entries under a walk in place, they are ordered once the walks are over
+    if (m_ProcAuraWalks)
+    {
+        m_ProcAuraFlags.push_back(l_ProcFlags);
+        m_ProcAuraApplications.push_back(p_AurApp);
+        m_ProcAuraDirty = true;
+        return;
+    }
+
+    /// Ordered by spell id like m_appliedAuras, after the applications of the same spell
+    auto l_Itr = std::upper_bound(m_ProcAuraApplications.begin(), m_ProcAuraApplications.end(), p_AurApp->GetBase()->GetId(), [](uint32 p_SpellId, AuraApplication const* p_Other) -> bool
+    {
+        return p_SpellId < p_Other->GetBase()->GetId();
+    });
+
+    m_ProcAuraFlags.insert(m_ProcAuraFlags.begin() + std::distance(m_ProcAuraApplications.begin(), l_Itr), l_ProcFlags);
+    m_ProcAuraApplications.insert(l_Itr, p_AurApp);
+}
+
+void Unit::RemoveProcAura(AuraApplication* p_AurApp)
+{
+    auto l_Itr = std::find(m_ProcAuraApplications.begin(), m_ProcAuraApplications.end(), p_AurApp);
+    if (l_Itr == m_ProcAuraApplications.end())
+        return;
+
+    size_t l_Index = std::distance(m_ProcAuraApplications.begin(), l_Itr);
+
+    /// Erasing would shift the entries under a walk, the cleared one matches no event
+    if (m_ProcAuraWalks)
+    {
+        m_ProcAuraFlags[l_Index] = 0;
+        *l_Itr = nullptr;
+        m_ProcAuraDirty = true;
+        return;
+    }
+
+    m_ProcAuraFlags.erase(m_ProcAuraFlags.begin() + l_Index);
+    m_ProcAuraApplications.erase(l_Itr);
+}
+
+void Unit::EndProcAuraWalk()
+{
+    if (--m_ProcAuraWalks || !m_ProcAuraDirty)
+        return;
+
+    m_ProcAuraDirty = false;
+
+    size_t l_Kept = 0;
+    for (size_t l_I = 0; l_I < m_ProcAuraApplications.size(); ++l_I)
+    {
+        if (!m_ProcAuraApplications[l_I])
+            continue;
+
+        m_ProcAuraFlags[l_Kept]        = m_ProcAuraFlags[l_I];
+        m_ProcAuraApplications[l_Kept] = m_ProcAuraApplications[l_I];
+        ++l_Kept;
+    }
+
+    m_ProcAuraFlags.resize(l_Kept);
+    m_ProcAuraApplications.resize(l_Kept);
+
+    /// Moves the auras appended during the walks to their spell id slot, the others are already ordered
+    for (size_t l_I = 1; l_I < l_Kept; ++l_I)
+    {
+        for (size_t l_J = l_I; l_J > 0 && m_ProcAuraApplications[l_J - 1]->GetBase()->GetId() > m_ProcAuraApplications[l_J]->GetBase()->GetId(); --l_J)
+        {
+            std::swap(m_ProcAuraFlags[l_J - 1], m_ProcAuraFlags[l_J]);
+            std::swap(m_ProcAuraApplications[l_J - 1], m_ProcAuraApplications[l_J]);
+        }
+    }
+}
+
 bool Unit::IsTriggeredAtSpellProcEvent(Unit* victim, Aura* aura, SpellInfo const* procSpell, uint32 procFlag, uint32 procExtra, WeaponAttackType attType, bool isVictim, bool active, SpellProcEventEntry const* & spellProcEvent)
 {
     SpellInfo const* spellProto = aura->GetSpellInfo();
@@ -22730,163 +22869,209 @@ void Unit::BuildValuesUpdate(uint8 updateType, ByteBuffer* data, Player* target)
     if (!target)
         return;
 
+    uint32* flags;
+    uint32 visibleFlag = GetUpdateFieldData(target, flags);
+
+    if (AppendCachedValuesUpdate(updateType, visibleFlag, data, target))
+        return;
+
+    size_t l_StartPos = data->wpos();
+    UpdateFieldFlagsMasks const& l_FieldMasks = GetUpdateFieldFlagsMasks(flags);
+
     ByteBuffer fieldBuffer;
 
     UpdateMask updateMask;
     updateMask.SetCount(m_valuesCount);
 
-    uint32* flags;
-    uint32 visibleFlag = GetUpdateFieldData(target, flags);
+    /// Values following the block count and the mask in the block
+    uint32 l_FieldsOffset = sizeof(uint8) + updateMask.GetBlockCount() * sizeof(UpdateMask::ClientUpdateMaskType);
+    ValuesUpdateTargetFields l_TargetFields;
 
-    Creature const* creature = ToCreature();
-    for (uint16 index = 0; index < m_valuesCount; ++index)
+    bool l_PerCasterAuraState = HasFlag(UNIT_FIELD_AURA_STATE, PER_CASTER_AURA_STATE_MASK);
+
+    for (uint32 l_Block = 0; l_Block < updateMask.GetBlockCount(); ++l_Block)
     {
-        if (_fieldNotifyFlags & flags[index] ||
-            ((flags[index] & visibleFlag) & UF_FLAG_SPECIAL_INFO) ||
-            ((updateType == UPDATETYPE_VALUES ? _changesMask.GetBit(index) : m_uint32Values[index]) && (flags[index] & visibleFlag)) ||
-            (index == UNIT_FIELD_AURA_STATE && HasFlag(UNIT_FIELD_AURA_STATE, PER_CASTER_AURA_STATE_MASK)))
+        uint32 l_FieldMask = updateMask.GetBlockFieldMask(l_Block);
+        uint32 l_Candidates = l_FieldMasks.GetBlock(_fieldNotifyFlags | (visibleFlag & UF_FLAG_SPECIAL_INFO), l_Block);
+        l_Candidates |= l_FieldMasks.GetBlock(visibleFlag, l_Block) & (updateType == UPDATETYPE_VALUES ? _changesMask.GetBlock(l_Block) : l_FieldMask);
+        if (l_PerCasterAuraState && l_Block == UNIT_FIELD_AURA_STATE / UpdateMask::CLIENT_UPDATE_MASK_BITS)
+            l_Candidates |= 1 << (UNIT_FIELD_AURA_STATE % UpdateMask::CLIENT_UPDATE_MASK_BITS);
+        l_Candidates &= l_FieldMask;
+
+        while (l_Candidates)
         {
-            updateMask.SetBit(index);
+            uint16 index = l_Block * UpdateMask::CLIENT_UPDATE_MASK_BITS + UpdateMask::GetLowestBit(l_Candidates);
+            l_Candidates &= l_Candidates - 1;
 
-            if (index == UNIT_FIELD_NPC_FLAGS)
+            if (_fieldNotifyFlags & flags[index] ||
+                ((flags[index] & visibleFlag) & UF_FLAG_SPECIAL_INFO) ||
+                ((updateType == UPDATETYPE_VALUES ? _changesMask.GetBit(index) : m_uint32Values[index]) && (flags[index] & visibleFlag)) ||
+                (index == UNIT_FIELD_AURA_STATE && l_PerCasterAuraState))
             {
-                uint32 appendValue = m_uint32Values[UNIT_FIELD_NPC_FLAGS];
+                updateMask.SetBit(index);
 
-                if (creature)
-                    if (!target->canSeeSpellClickOn(creature))
-                        appendValue &= ~UNIT_NPC_FLAG_SPELLCLICK;
+                switch (index)
+                {
+                    case UNIT_FIELD_NPC_FLAGS:
+                    case UNIT_FIELD_AURA_STATE:
+                    case UNIT_FIELD_FLAGS:
+                    case UNIT_FIELD_DISPLAY_ID:
+                    case OBJECT_FIELD_DYNAMIC_FLAGS:
+                    case UNIT_FIELD_SHAPESHIFT_FORM:
+                    case UNIT_FIELD_FACTION_TEMPLATE:
+                        l_TargetFields.emplace_back(index, l_FieldsOffset + fieldBuffer.wpos());
+                        break;
+                    default:
+                        break;
+                }
 
-                fieldBuffer << uint32(appendValue);
-            }
-            else if (index == UNIT_FIELD_AURA_STATE)
-            {
-                // Check per caster aura states to not enable using a spell in client if specified aura is not by target
-                fieldBuffer << BuildAuraStateUpdateForTarget(target);
-            }
-            // FIXME: Some values at server stored in float format but must be sent to client in uint32 format
-            else if (index >= UNIT_FIELD_ATTACK_ROUND_BASE_TIME && index <= UNIT_FIELD_RANGED_ATTACK_ROUND_BASE_TIME)
-            {
-                // convert from float to uint32 and send
-                fieldBuffer << uint32(m_floatValues[index] < 0 ? 0 : m_floatValues[index]);
+                fieldBuffer << GetValuesUpdateFieldForTarget(index, target);
             }
-            // there are some float values which may be negative or can't get negative due to other checks
-            else if ((index >= UNIT_FIELD_STAT_NEG_BUFF   && index < UNIT_FIELD_STAT_NEG_BUFF + MAX_STATS) ||
-                (index >= UNIT_FIELD_STAT_POS_BUFF   && index < UNIT_FIELD_STAT_POS_BUFF + MAX_STATS) ||
-                (index >= UNIT_FIELD_RESISTANCE_BUFF_MODS_POSITIVE  && index < (UNIT_FIELD_RESISTANCE_BUFF_MODS_POSITIVE + MAX_SPELL_SCHOOL)) ||
-                (index >= UNIT_FIELD_RESISTANCE_BUFF_MODS_NEGATIVE  && index < (UNIT_FIELD_RESISTANCE_BUFF_MODS_NEGATIVE + MAX_SPELL_SCHOOL)))
-            {
-                fieldBuffer << uint32(m_floatValues[index]);
-            }
-            // Gamemasters should be always able to select units - remove not selectable flag
-            else if (index == UNIT_FIELD_FLAGS)
-            {
-                uint32 appendValue = m_uint32Values[UNIT_FIELD_FLAGS];
-                if (target->isGameMaster())
-                    appendValue &= ~UNIT_FLAG_NOT_SELECTABLE;
+        }
+    }
 
-                fieldBuffer << uint32(appendValue);
-            }
-            // use modelid_a if not gm, _h if gm for CREATURE_FLAG_EXTRA_TRIGGER creatures
-            else if (index == UNIT_FIELD_DISPLAY_ID)
-            {
-                uint32 displayId = m_uint32Values[UNIT_FIELD_DISPLAY_ID];
-                if (creature)
-                {
-                    CreatureTemplate const* cinfo = creature->GetCreatureTemplate();
+    *data << uint8(updateMask.GetBlockCount());
+    updateMask.AppendToPacket(data);
+    data->append(fieldBuffer);
 
-                    // this also applies for transform auras
-                    if (SpellInfo const* transform = sSpellMgr->GetSpellInfo(getTransForm()))
-                        for (uint8 i = 0; i < transform->EffectCount; ++i)
-                            if (transform->Effects[i].IsAura(SPELL_AURA_TRANSFORM))
-                                if (CreatureTemplate const* transformInfo = sObjectMgr->GetCreatureTemplate(transform->Effects[i].MiscValue))
-                                {
-                                    cinfo = transformInfo;
-                                    break;
-                                }
+    StoreValuesUpdate(updateType, visibleFlag, data, l_StartPos, &l_TargetFields);
+}
 
-                    if (cinfo->flags_extra & CREATURE_FLAG_EXTRA_TRIGGER)
-                    {
-                        if (target->isGameMaster())
-                        {
-                            if (cinfo->Modelid1)
-                                displayId = cinfo->Modelid1; // Modelid1 is a visible model for gms
-                            else
-                                displayId = 17519; // world visible trigger's model
-                        }
-                        else
-                        {
-                            if (cinfo->Modelid2)
-                                displayId = cinfo->Modelid2; // Modelid2 is an invisible model for players
-                            else
-                                displayId = 11686; // world invisible trigger's model
-                        }
-                    }
-                }
+uint32 Unit::GetValuesUpdateFieldForTarget(uint16 index, Player* target) const
+{
+    Creature const* creature = ToCreature();
 
-                fieldBuffer << uint32(displayId);
-            }
-            // hide lootable animation for unallowed players
-            else if (index == OBJECT_FIELD_DYNAMIC_FLAGS)
-            {
-                uint32 dynamicFlags = m_uint32Values[OBJECT_FIELD_DYNAMIC_FLAGS] & ~(UNIT_DYNFLAG_TAPPED | UNIT_DYNFLAG_TAPPED_BY_PLAYER);
+    if (index == UNIT_FIELD_NPC_FLAGS)
+    {
+        uint32 appendValue = m_uint32Values[UNIT_FIELD_NPC_FLAGS];
 
-                if (creature)
-                {
-                    if (creature->hasLootRecipient())
-                    {
-                        dynamicFlags |= UNIT_DYNFLAG_TAPPED;
-                        if (creature->isTappedBy(target))
-                            dynamicFlags |= UNIT_DYNFLAG_TAPPED_BY_PLAYER;
-                    }
+        if (creature)
+            if (!target->canSeeSpellClickOn(creature))
+                appendValue &= ~UNIT_NPC_FLAG_SPELLCLICK;
 
-                    if (!target->isAllowedToLoot(creature))
-                        dynamicFlags &= ~UNIT_DYNFLAG_LOOTABLE;
-                }
+        return appendValue;
+    }
+    else if (index == UNIT_FIELD_AURA_STATE)
+    {
+        // Check per caster aura states to not enable using a spell in client if specified aura is not by target
+        return BuildAuraStateUpdateForTarget(target);
+    }
+    // FIXME: Some values at server stored in float format but must be sent to client in uint32 format
+    else if (index >= UNIT_FIELD_ATTACK_ROUND_BASE_TIME && index <= UNIT_FIELD_RANGED_ATTACK_ROUND_BASE_TIME)
+    {
+        // convert from float to uint32 and send
+        return uint32(m_floatValues[index] < 0 ? 0 : m_floatValues[index]);
+    }
+    // there are some float values which may be negative or can't get negative due to other checks
+    else if ((index >= UNIT_FIELD_STAT_NEG_BUFF   && index < UNIT_FIELD_STAT_NEG_BUFF + MAX_STATS) ||
+        (index >= UNIT_FIELD_STAT_POS_BUFF   && index < UNIT_FIELD_STAT_POS_BUFF + MAX_STATS) ||
+        (index >= UNIT_FIELD_RESISTANCE_BUFF_MODS_POSITIVE  && index < (UNIT_FIELD_RESISTANCE_BUFF_MODS_POSITIVE + MAX_SPELL_SCHOOL)) ||
+        (index >= UNIT_FIELD_RESISTANCE_BUFF_MODS_NEGATIVE  && index < (UNIT_FIELD_RESISTANCE_BUFF_MODS_NEGATIVE + MAX_SPELL_SCHOOL)))
+    {
+        return uint32(m_floatValues[index]);
+    }
+    // Gamemasters should be always able to select units - remove not selectable flag
+    else if (index == UNIT_FIELD_FLAGS)
+    {
+        uint32 appendValue = m_uint32Values[UNIT_FIELD_FLAGS];
+        if (target->isGameMaster())
+            appendValue &= ~UNIT_FLAG_NOT_SELECTABLE;
 
-                // unit UNIT_DYNFLAG_TRACK_UNIT should only be sent to caster of SPELL_AURA_MOD_STALKED auras
-                if (dynamicFlags & UNIT_DYNFLAG_TRACK_UNIT)
-                    if (!HasAuraTypeWithCaster(SPELL_AURA_MOD_STALKED, target->GetGUID()))
-                        dynamicFlags &= ~UNIT_DYNFLAG_TRACK_UNIT;
+        return appendValue;
+    }
+    // use modelid_a if not gm, _h if gm for CREATURE_FLAG_EXTRA_TRIGGER creatures
+    else if (index == UNIT_FIELD_DISPLAY_ID)
+    {
+        uint32 displayId = m_uint32Values[UNIT_FIELD_DISPLAY_ID];
+        if (creature)
+        {
+            CreatureTemplate const* cinfo = creature->GetCreatureTemplate();
 
-                fieldBuffer << dynamicFlags;
-            }
-            // FG: pretend that OTHER players in own group are friendly ("blue")
-            else if (index == UNIT_FIELD_SHAPESHIFT_FORM || index == UNIT_FIELD_FACTION_TEMPLATE)
-            {
-                uint32 l_Value = m_uint32Values[index];
-                if (index == UNIT_FIELD_FACTION_TEMPLATE && creature && creature->IsAIEnabled)
-                    creature->AI()->OnSendFactionTemplate(l_Value, target);
+            // this also applies for transform auras
+            if (SpellInfo const* transform = sSpellMgr->GetSpellInfo(getTransForm()))
+                for (uint8 i = 0; i < transform->EffectCount; ++i)
+                    if (transform->Effects[i].IsAura(SPELL_AURA_TRANSFORM))
+                        if (CreatureTemplate const* transformInfo = sObjectMgr->GetCreatureTemplate(transform->Effects[i].MiscValue))
+                        {
+                            cinfo = transformInfo;
+                            break;
+                        }
 
-                if (IsControlledByPlayer() && target != this && sWorld->getBoolConfig(CONFIG_ALLOW_TWO_SIDE_INTERACTION_GROUP) && IsInRaidWith(target))
+            if (cinfo->flags_extra & CREATURE_FLAG_EXTRA_TRIGGER)
+            {
+                if (target->isGameMaster())
                 {
-                    FactionTemplateEntry const* ft1 = getFactionTemplateEntry();
-                    FactionTemplateEntry const* ft2 = target->getFactionTemplateEntry();
-                    if (ft1 && ft2 && !ft1->IsFriendlyTo(*ft2))
-                    {
-                        if (index == UNIT_FIELD_SHAPESHIFT_FORM)
-                            // Allow targetting opposite faction in party when enabled in config
-                            fieldBuffer << (m_uint32Values[UNIT_FIELD_SHAPESHIFT_FORM] & ((UNIT_BYTE2_FLAG_SANCTUARY /*| UNIT_BYTE2_FLAG_AURAS | UNIT_BYTE2_FLAG_UNK5*/) << 8)); // this flag is at uint8 offset 1 !!
-                        else
-                            // pretend that all other HOSTILE players have own faction, to allow follow, heal, rezz (trade wont work)
-                            fieldBuffer << uint32(target->getFaction());
-                    }
+                    if (cinfo->Modelid1)
+                        displayId = cinfo->Modelid1; // Modelid1 is a visible model for gms
                     else
-                        fieldBuffer << l_Value;
+                        displayId = 17519; // world visible trigger's model
                 }
                 else
-                    fieldBuffer << l_Value;
+                {
+                    if (cinfo->Modelid2)
+                        displayId = cinfo->Modelid2; // Modelid2 is an invisible model for players
+                    else
+                        displayId = 11686; // world invisible trigger's model
+                }
             }
-            else
+        }
+
+        return displayId;
+    }
+    // hide lootable animation for unallowed players
+    else if (index == OBJECT_FIELD_DYNAMIC_FLAGS)
+    {
+        uint32 dynamicFlags = m_uint32Values[OBJECT_FIELD_DYNAMIC_FLAGS] & ~(UNIT_DYNFLAG_TAPPED | UNIT_DYNFLAG_TAPPED_BY_PLAYER);
+
+        if (creature)
+        {
+            if (creature->hasLootRecipient())
             {
-                // send in current format (float as float, uint32 as uint32)
-                fieldBuffer << m_uint32Values[index];
+                dynamicFlags |= UNIT_DYNFLAG_TAPPED;
+                if (creature->isTappedBy(target))
+                    dynamicFlags |= UNIT_DYNFLAG_TAPPED_BY_PLAYER;
             }
+
+            if (!target->isAllowedToLoot(creature))
+                dynamicFlags &= ~UNIT_DYNFLAG_LOOTABLE;
         }
+
+        // unit UNIT_DYNFLAG_TRACK_UNIT should only be sent to caster of SPELL_AURA_MOD_STALKED auras
+        if (dynamicFlags & UNIT_DYNFLAG_TRACK_UNIT)
+            if (!HasAuraTypeWithCaster(SPELL_AURA_MOD_STALKED, target->GetGUID()))
+                dynamicFlags &= ~UNIT_DYNFLAG_TRACK_UNIT;
+
+        return dynamicFlags;
     }
+    // FG: pretend that OTHER players in own group are friendly ("blue")
+    else if (index == UNIT_FIELD_SHAPESHIFT_FORM || index == UNIT_FIELD_FACTION_TEMPLATE)
+    {
+        uint32 l_Value = m_uint32Values[index];
+        if (index == UNIT_FIELD_FACTION_TEMPLATE && creature && creature->IsAIEnabled)
+            creature->AI()->OnSendFactionTemplate(l_Value, target);
 
-    *data << uint8(updateMask.GetBlockCount());
-    updateMask.AppendToPacket(data);
-    data->append(fieldBuffer);
+        if (IsControlledByPlayer() && target != this && sWorld->getBoolConfig(CONFIG_ALLOW_TWO_SIDE_INTERACTION_GROUP) && IsInRaidWith(target))
+        {
+            FactionTemplateEntry const* ft1 = getFactionTemplateEntry();
+            FactionTemplateEntry const* ft2 = target->getFactionTemplateEntry();
+            if (ft1 && ft2 && !ft1->IsFriendlyTo(*ft2))
+            {
+                if (index == UNIT_FIELD_SHAPESHIFT_FORM)
+                    // Allow targetting opposite faction in party when enabled in config
+                    return (m_uint32Values[UNIT_FIELD_SHAPESHIFT_FORM] & ((UNIT_BYTE2_FLAG_SANCTUARY /*| UNIT_BYTE2_FLAG_AURAS | UNIT_BYTE2_FLAG_UNK5*/) << 8)); // this flag is at uint8 offset 1 !!
+                else
+                    // pretend that all other HOSTILE players have own faction, to allow follow, heal, rezz (trade wont work)
+                    return uint32(target->getFaction());
+            }
+            else
+                return l_Value;
+        }
+        else
+            return l_Value;
+    }
+
+    // send in current format (float as float, uint32 as uint32)
+    return m_uint32Values[index];
 }
 
 float Unit::CalculateDamageDealtFactor(Unit* p_Unit, Creature* p_Creature)
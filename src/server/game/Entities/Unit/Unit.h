@@ -1555,6 +1555,8 @@ class Unit : public WorldObject
         bool CanDualWield() const { return m_canDualWield; }
         void SetCanDualWield(bool value) { m_canDualWield = value; }
         float GetCombatReach() const { return m_floatValues[UNIT_FIELD_COMBAT_REACH]; }
+        /// Always set through here, the spatial index of the map keeps a copy
+        void SetCombatReach(float p_Reach);
         float GetBoundaryRadius() const { return m_floatValues[UNIT_FIELD_BOUNDING_RADIUS]; }
         float GetMeleeReach() const { float reach = m_floatValues[UNIT_FIELD_COMBAT_REACH]; return reach > MIN_MELEE_REACH ? reach : MIN_MELEE_REACH; }
         bool IsWithinCombatRange(const Unit* obj, float dist2compare) const;
@@ -2799,6 +2801,7 @@ class Unit : public WorldObject
         explicit Unit (bool isWorldObject);
 
         void BuildValuesUpdate(uint8 updatetype, ByteBuffer* data, Player* target) const;
+        uint32 GetValuesUpdateFieldForTarget(uint16 index, Player* target) const override;
 
         UnitAI* i_AI, *i_disabledAI;
 
@@ -2843,6 +2846,13 @@ class Unit : public WorldObject
         AuraList m_scAuras;                        // casted singlecast auras
         AuraApplicationList m_interruptableAuras;             // auras which have interrupt mask applied on unit
         AuraStateAurasMap m_auraStateAuras;        // Used for improve performance of aura state checks on aura apply/remove
+        /// Applied auras which can proc with the proc flags they react to, in parallel arrays: a proc event only
+        /// looks at the auras sharing one of its flags instead of every applied aura.
+        /// Ordered by spell id like m_appliedAuras, so procs trigger in the same order.
+        std::vector<uint32> m_ProcAuraFlags;
+        std::vector<AuraApplication*> m_ProcAuraApplications;
+        uint32 m_ProcAuraWalks;                                         ///< Proc walks in progress, entries are only cleared meanwhile
+        bool m_ProcAuraDirty;                                           ///< Entries cleared or appended during the walks, fixed once they are over
         uint32 m_interruptMask;
         AuraIdList _SoulSwapDOTList;
         struct SoulSwapAurasData
@@ -2903,6 +2913,12 @@ class Unit : public WorldObject
         uint32 m_powers[MAX_POWERS];
 
     private:
+        /// Proc flags which can make the aura pass IsTriggeredAtSpellProcEvent or Aura::IsProcTriggeredOnEvent, 0 if none
+        static uint32 GetAuraProcFlags(SpellInfo const* p_SpellInfo);
+        void AddProcAura(AuraApplication* p_AurApp);
+        void RemoveProcAura(AuraApplication* p_AurApp);
+        void EndProcAuraWalk();
+
         bool IsTriggeredAtSpellProcEvent(Unit* victim, Aura* aura, SpellInfo const* procSpell, uint32 procFlag, uint32 procExtra, WeaponAttackType attType, bool isVictim, bool active, SpellProcEventEntry const*& spellProcEvent);
         bool RollProcResult(Unit* victim, Aura* aura, WeaponAttackType attType, bool isVictim, SpellProcEventEntry const* spellProcEvent);
         bool HandleAuraProcOnPowerAmount(Unit* victim, uint32 damage, AuraEffect* triggeredByAura, SpellInfo const *procSpell, uint32 procFlag, uint32 procEx, uint32 cooldown);
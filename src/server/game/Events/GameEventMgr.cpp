@@ -1319,7 +1319,7 @@ void GameEventMgr::ChangeEquipOrModel(int16 event_id, bool activate)
                         creature->SetDisplayId(itr->second.modelid);
                         creature->SetNativeDisplayId(itr->second.modelid);
                         creature->SetFloatValue(UNIT_FIELD_BOUNDING_RADIUS, minfo->bounding_radius);
-                        creature->SetFloatValue(UNIT_FIELD_COMBAT_REACH, minfo->combat_reach);
+                        creature->SetCombatReach(minfo->combat_reach);
                     }
                 }
             }
@@ -1334,7 +1334,7 @@ void GameEventMgr::ChangeEquipOrModel(int16 event_id, bool activate)
                         creature->SetDisplayId(itr->second.modelid_prev);
                         creature->SetNativeDisplayId(itr->second.modelid_prev);
                         creature->SetFloatValue(UNIT_FIELD_BOUNDING_RADIUS, minfo->bounding_radius);
-                        creature->SetFloatValue(UNIT_FIELD_COMBAT_REACH, minfo->combat_reach);
+                        creature->SetCombatReach(minfo->combat_reach);
                     }
                 }
             }
@@ -277,6 +277,7 @@ class ObjectAccessor
         static void SaveAllPlayers();
 
         //non-static functions
+        /// Objects with pending value changes and no known map, see Object::AddToObjectUpdate
         void AddUpdateObject(Object* obj)
         {
             TRINITY_GUARD(ACE_Thread_Mutex, i_objectLock);
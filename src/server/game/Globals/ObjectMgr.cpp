@@ -38,6 +38,7 @@
 #include "DB2Stores.h"
 #include "Configuration/Config.h"
 #include "VMapFactory.h"
+#include "WorldSnapshot.h"
 #ifndef CROSS
 #include "GarrisonMgr.hpp"
 #endif /* not CROSS */
@@ -407,7 +408,7 @@ void ObjectMgr::LoadCreatureTemplates()
 	uint32 oldMSTime = getMSTime();
 
 	//                                                 0           1          2           3          4       5
-	QueryResult result = WorldDatabase.Query("SELECT entry, KillCredit1, KillCredit2, modelid1, modelid2, modelid3, "
+	QueryResult result = sWorldSnapshot->Query("SELECT entry, KillCredit1, KillCredit2, modelid1, modelid2, modelid3, "
 		//                                           6        7      8           9       10           11            12       13      14     15       16       17         18        19        20
 		"modelid4, name, femaleName, subname, IconName, gossip_menu_id, minlevel, maxlevel, exp, exp_req, faction, npcflag, npcflag2, speed_walk, speed_run, "
 		//                                             21       22   23      24            25           26               27               28          29             30
@@ -422,7 +423,7 @@ void ObjectMgr::LoadCreatureTemplates()
 		"InhabitType, HoverHeight, Health_mod, Mana_mod, Mana_mod_extra, Armor_mod, RacialLeader, questItem1, questItem2, questItem3, questItem4, questItem5, "
 		//                                            78           79         80          81               82               83              84            85
 		"questItem6, movementId, VignetteID, TrackingQuestID,  RegenHealth, mechanic_immune_mask, flags_extra, ScriptName "
-		"FROM creature_template;");
+		"FROM creature_template;", { "creature_template" });
 
 	if (!result)
 	{
@@ -953,7 +954,7 @@ void ObjectMgr::LoadCreatureAddons()
 	uint32 l_OldMSTime = getMSTime();
 
 	///                                                0      1       2      3       4       5      6       7
-	QueryResult l_Result = WorldDatabase.Query("SELECT guid, path_id, mount, bytes1, bytes2, emote, auras, animkit FROM creature_addon");
+	QueryResult l_Result = sWorldSnapshot->Query("SELECT guid, path_id, mount, bytes1, bytes2, emote, auras, animkit FROM creature_addon", { "creature_addon" });
 	if (!l_Result)
 	{
 		sLog->outInfo(LOG_FILTER_SERVER_LOADING, ">> Loaded 0 creature addon definitions. DB table `creature_addon` is empty.");
@@ -1213,7 +1214,7 @@ void ObjectMgr::LoadCreatureModelInfo()
 {
 	uint32 oldMSTime = getMSTime();
 
-	QueryResult result = WorldDatabase.Query("SELECT modelid, bounding_radius, combat_reach, gender, modelid_other_gender FROM creature_model_info");
+	QueryResult result = sWorldSnapshot->Query("SELECT modelid, bounding_radius, combat_reach, gender, modelid_other_gender FROM creature_model_info", { "creature_model_info" });
 
 	if (!result)
 	{
@@ -1608,7 +1609,7 @@ void ObjectMgr::LoadCreatures()
 		l_Query += l_TempQueryEnding;
 	}
 
-	QueryResult result = WorldDatabase.Query(l_Query.c_str());
+	QueryResult result = sWorldSnapshot->Query(l_Query.c_str(), { "creature", "game_event_creature", "pool_creature" });
 
 	if (!result)
 	{
@@ -1964,7 +1965,7 @@ void ObjectMgr::LoadGameobjects()
 		l_Query += l_TempQueryEnding;
 	}
 
-	QueryResult result = WorldDatabase.Query(l_Query.c_str());
+	QueryResult result = sWorldSnapshot->Query(l_Query.c_str(), { "gameobject", "game_event_gameobject", "pool_gameobject" });
 
 	if (!result)
 	{
@@ -4081,7 +4082,7 @@ void ObjectMgr::LoadQuests()
 
 	mExclusiveQuestGroups.clear();
 
-	QueryResult result = WorldDatabase.Query("SELECT "
+	QueryResult result = sWorldSnapshot->Query("SELECT "
 		"Id, Method, Level, MinLevel, MaxLevel, PackageID, ZoneOrSort, Type, SuggestedPlayers, LimitTime, RequiredTeam, RequiredClasses, RequiredRaces, RequiredSkillId, RequiredSkillPoints, "
 		"RequiredMinRepFaction, RequiredMaxRepFaction, RequiredMinRepValue, RequiredMaxRepValue, "
 		"PrevQuestId, NextQuestId, ExclusiveGroup, NextQuestIdChain, RewardXPId, RewardMoney, RewardMoneyMaxLevel, RewardSpell, RewardSpellCast, RewardHonor, RewardHonorMultiplier, "
@@ -4097,7 +4098,7 @@ void ObjectMgr::LoadQuests()
 		"DetailsEmote1, DetailsEmote2, DetailsEmote3, DetailsEmote4, DetailsEmoteDelay1, DetailsEmoteDelay2, DetailsEmoteDelay3, DetailsEmoteDelay4, EmoteOnIncomplete, EmoteOnComplete, "
 		"OfferRewardEmote1, OfferRewardEmote2, OfferRewardEmote3, OfferRewardEmote4, OfferRewardEmoteDelay1, OfferRewardEmoteDelay2, OfferRewardEmoteDelay3, OfferRewardEmoteDelay4, "
 		"StartScript, CompleteScript, BuildVerified"
-		" FROM quest_template");
+		" FROM quest_template", { "quest_template" });
 	if (!result)
 	{
 		sLog->outError(LOG_FILTER_SERVER_LOADING, ">> Loaded 0 quests definitions. DB table `quest_template` is empty.");
@@ -7069,14 +7070,14 @@ void ObjectMgr::LoadGameObjectTemplate()
 	uint32 oldMSTime = getMSTime();
 
 	//                                                 0      1      2        3       4             5          6      7       8     9        10         11          12
-	QueryResult result = WorldDatabase.Query("SELECT entry, type, displayId, name, IconName, castBarCaption, unk1, faction, flags, size, questItem1, questItem2, questItem3, "
+	QueryResult result = sWorldSnapshot->Query("SELECT entry, type, displayId, name, IconName, castBarCaption, unk1, faction, flags, size, questItem1, questItem2, questItem3, "
 		//                                            13          14          15       16     17     18     19     20     21     22     23     24     25      26      27      28
 		"questItem4, questItem5, questItem6, data0, data1, data2, data3, data4, data5, data6, data7, data8, data9, data10, data11, data12, "
 		//                                          29      30      31      32      33      34      35      36      37      38      39      40      41      42      43      44
 		"data13, data14, data15, data16, data17, data18, data19, data20, data21, data22, data23, data24, data25, data26, data27, data28, "
 		//                                          45      46      47       48       49        50            51        52
 		"data29, data30, data31,  data32, unkInt32, WorldEffectID, AIName, ScriptName "
-		"FROM gameobject_template");
+		"FROM gameobject_template", { "gameobject_template" });
 
 	if (!result)
 	{
@@ -9094,7 +9095,7 @@ void ObjectMgr::LoadGossipMenu()
 
 	_gossipMenusStore.clear();
 
-	QueryResult result = WorldDatabase.Query("SELECT entry, text_id FROM gossip_menu");
+	QueryResult result = sWorldSnapshot->Query("SELECT entry, text_id FROM gossip_menu", { "gossip_menu" });
 
 	if (!result)
 	{
@@ -9134,12 +9135,12 @@ void ObjectMgr::LoadGossipMenuItems()
 
 	_gossipMenuItemsStore.clear();
 
-	QueryResult result = WorldDatabase.Query(
+	QueryResult result = sWorldSnapshot->Query(
 		//          0              1            2           3              4
 		"SELECT menu_id, id, option_icon, option_text, option_id, npc_option_npcflag, "
 		//       5              6           7          8         9
 		"action_menu_id, action_poi_id, box_coded, box_money, box_text "
-		"FROM gossip_menu_option ORDER BY menu_id, id");
+		"FROM gossip_menu_option ORDER BY menu_id, id", { "gossip_menu_option" });
 
 	if (!result)
 	{
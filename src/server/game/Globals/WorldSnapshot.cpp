@@ -0,0 +1,427 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Project-Hellscream https://hellscream.org
+// Copyright (C) 2018-2020 Project-Hellscream-6.2
+// Discord https://discord.gg/CWCF3C9
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include "WorldSnapshot.h"
+#include "Log.h"
+#include "Timer.h"
+
+/// Bump when the file layout or the ResultSet::AppendRow layout changes
+#define WORLD_SNAPSHOT_MAGIC    0x504E5357                              ///< "WSNP"
+#define WORLD_SNAPSHOT_VERSION  1
+
+namespace
+{
+    template<typename T> void Append(std::vector<char>& p_Buffer, T p_Value)
+    {
+        p_Buffer.insert(p_Buffer.end(), reinterpret_cast<char const*>(&p_Value), reinterpret_cast<char const*>(&p_Value) + sizeof(T));
+    }
+
+    void AppendString(std::vector<char>& p_Buffer, std::string const& p_String)
+    {
+        Append<uint32>(p_Buffer, p_String.size());
+        p_Buffer.insert(p_Buffer.end(), p_String.begin(), p_String.end());
+    }
+
+    /// Bounds checked reads over the file content
+    struct SnapshotReader
+    {
+        SnapshotReader(std::vector<char> const& p_Buffer) : Buffer(p_Buffer), Position(0) { }
+
+        template<typename T> bool Read(T& p_Value)
+        {
+            if (Position + sizeof(T) > Buffer.size())
+                return false;
+
+            memcpy(&p_Value, &Buffer[Position], sizeof(T));
+            Position += sizeof(T);
+            return true;
+        }
+
+        bool ReadBytes(char const*& p_Bytes, uint64 p_Size)
+        {
+            if (p_Size > Buffer.size() - Position)
+                return false;
+
+            p_Bytes = Buffer.data() + Position;
+            Position += p_Size;
+            return true;
+        }
+
+        bool ReadString(std::string& p_String)
+        {
+            uint32 l_Size;
+            char const* l_Bytes;
+            if (!Read(l_Size) || !ReadBytes(l_Bytes, l_Size))
+                return false;
+
+            p_String.assign(l_Bytes, l_Size);
+            return true;
+        }
+
+        std::vector<char> const& Buffer;
+        size_t Position;
+    };
+}
+
+void WorldSnapshot::Open(std::string const& p_FileName)
+{
+    uint32 l_OldMSTime = getMSTime();
+
+    std::lock_guard<std::mutex> l_Lock(m_Lock);
+
+    m_Open     = true;
+    m_Dirty    = false;
+    m_FileName = p_FileName;
+
+    FILE* l_File = fopen(p_FileName.c_str(), "rb");
+    if (!l_File)
+    {
+        sLog->outInfo(LOG_FILTER_SERVER_LOADING, ">> World snapshot %s not found, it will be built from the database", p_FileName.c_str());
+        return;
+    }
+
+    fseek(l_File, 0, SEEK_END);
+    long l_Size = ftell(l_File);
+    fseek(l_File, 0, SEEK_SET);
+
+    std::vector<char> l_Buffer(l_Size > 0 ? l_Size : 0);
+    bool l_Ok = l_Size > 0 && fread(l_Buffer.data(), 1, l_Buffer.size(), l_File) == l_Buffer.size();
+    fclose(l_File);
+
+    if (!l_Ok || !Read(l_Buffer))
+    {
+        m_Entries.clear();
+        sLog->outError(LOG_FILTER_SERVER_LOADING, "World snapshot %s is unreadable or from another version, it will be rebuilt from the database", p_FileName.c_str());
+        return;
+    }
+
+    /// Keys of every table of the snapshot in one go instead of one query per loader
+    std::set<std::string> l_Tables;
+    for (auto const& l_Entry : m_Entries)
+    {
+        for (auto const& l_Table : l_Entry.second.Tables)
+            l_Tables.insert(l_Table.first);
+    }
+
+    UpdateTableKeys(std::vector<std::string>(l_Tables.begin(), l_Tables.end()));
+
+    sLog->outInfo(LOG_FILTER_SERVER_LOADING, ">> Loaded world snapshot %s with %u queries (%u bytes) in %u ms", p_FileName.c_str(), uint32(m_Entries.size()), uint32(l_Size), GetMSTimeDiffToNow(l_OldMSTime));
+}
+
+void WorldSnapshot::Close()
+{
+    std::lock_guard<std::mutex> l_Lock(m_Lock);
+
+    if (!m_Open)
+        return;
+
+    m_Open = false;
+
+    /// Queries which were not run anymore are dropped from the file
+    for (auto const& l_Entry : m_Entries)
+    {
+        if (!l_Entry.second.Used)
+            m_Dirty = true;
+    }
+
+    if (m_Dirty && Write(m_FileName))
+        sLog->outInfo(LOG_FILTER_SERVER_LOADING, ">> World snapshot %s updated, %u queries from the snapshot and %u from the database", m_FileName.c_str(), m_Hits, m_Misses);
+    else
+        sLog->outInfo(LOG_FILTER_SERVER_LOADING, ">> World snapshot: %u queries from the snapshot and %u from the database", m_Hits, m_Misses);
+
+    m_Entries.clear();
+    m_TableKeys.clear();
+    m_UnknownTables.clear();
+}
+
+QueryResult WorldSnapshot::Query(std::string const& p_Sql, std::vector<std::string> const& p_Tables)
+{
+    {
+        std::lock_guard<std::mutex> l_Lock(m_Lock);
+
+        if (!m_Open)
+            return WorldDatabase.Query(p_Sql.c_str());
+
+        if (!UpdateTableKeys(p_Tables))
+        {
+            ++m_Misses;
+            return WorldDatabase.Query(p_Sql.c_str());
+        }
+
+        auto l_Itr = m_Entries.find(p_Sql);
+        if (l_Itr != m_Entries.end())
+        {
+            Entry& l_Entry = l_Itr->second;
+
+            bool l_Valid = l_Entry.Tables.size() == p_Tables.size();
+            for (uint32 l_I = 0; l_Valid && l_I < l_Entry.Tables.size(); ++l_I)
+                l_Valid = l_Entry.Tables[l_I].first == p_Tables[l_I] && l_Entry.Tables[l_I].second == m_TableKeys[p_Tables[l_I]];
+
+            if (l_Valid)
+            {
+                l_Entry.Used = true;
+                ++m_Hits;
+                return BuildResult(l_Entry);
+            }
+        }
+    }
+
+    /// The keys are taken before the query, a table changed in between is only fetched again on the next start
+    Entry l_Entry;
+    l_Entry.RowCount = 0;
+    l_Entry.Used     = true;
+
+    std::shared_ptr<std::vector<char>> l_Rows = std::make_shared<std::vector<char>>();
+
+    if (QueryResult l_Result = WorldDatabase.Query(p_Sql.c_str()))
+    {
+        for (uint32 l_I = 0; l_I < l_Result->GetFieldCount(); ++l_I)
+            l_Entry.Types.push_back(l_Result->GetFieldType(l_I));
+
+        do
+        {
+            l_Result->AppendRow(*l_Rows);
+            ++l_Entry.RowCount;
+        }
+        while (l_Result->NextRow());
+    }
+
+    l_Entry.Rows = l_Rows;
+
+    std::lock_guard<std::mutex> l_Lock(m_Lock);
+
+    for (std::string const& l_Table : p_Tables)
+        l_Entry.Tables.push_back(std::make_pair(l_Table, m_TableKeys[l_Table]));
+
+    ++m_Misses;
+    m_Dirty = true;
+
+    return BuildResult(m_Entries[p_Sql] = l_Entry);
+}
+
+QueryResult WorldSnapshot::BuildResult(Entry const& p_Entry)
+{
+    if (!p_Entry.RowCount)
+        return QueryResult(NULL);
+
+    ResultSet* l_Result = new ResultSet(p_Entry.Rows, p_Entry.Types, p_Entry.RowCount);
+    l_Result->NextRow();
+    return QueryResult(l_Result);
+}
+
+bool WorldSnapshot::UpdateTableKeys(std::vector<std::string> const& p_Tables)
+{
+    std::vector<std::string> l_Missing;
+    for (std::string const& l_Table : p_Tables)
+    {
+        if (m_TableKeys.find(l_Table) == m_TableKeys.end() && m_UnknownTables.find(l_Table) == m_UnknownTables.end())
+            l_Missing.push_back(l_Table);
+    }
+
+    if (!l_Missing.empty())
+    {
+        /// Live checksum of the tables created with CHECKSUM = 1, it's NULL for the others instead of a scan
+        std::string l_Tables;
+        for (std::string const& l_Table : l_Missing)
+        {
+            if (!l_Tables.empty())
+                l_Tables += ", ";
+
+            l_Tables += "`" + l_Table + "`";
+        }
+
+        if (QueryResult l_Result = WorldDatabase.Query(("CHECKSUM TABLE " + l_Tables + " QUICK").c_str()))
+        {
+            do
+            {
+                Field* l_Fields = l_Result->Fetch();
+
+                /// Returned as database.table
+                std::string l_Table = l_Fields[0].GetString();
+                size_t l_Dot = l_Table.rfind('.');
+                if (l_Dot != std::string::npos)
+                    l_Table = l_Table.substr(l_Dot + 1);
+
+                if (l_Fields[1].IsNull())
+                    continue;
+
+                m_TableKeys[l_Table] = l_Fields[1].GetUInt64();
+            }
+            while (l_Result->NextRow());
+        }
+
+        /// Other tables (InnoDB) are keyed by their last write and creation time.
+        /// MySQL 8 caches them for a day in information_schema unless the expiry is disabled, older servers ignore the hint.
+        l_Tables.clear();
+        for (std::string const& l_Table : l_Missing)
+        {
+            if (m_TableKeys.find(l_Table) != m_TableKeys.end())
+                continue;
+
+            if (!l_Tables.empty())
+                l_Tables += ", ";
+
+            l_Tables += "'" + l_Table + "'";
+        }
+
+        if (!l_Tables.empty())
+        {
+            std::string l_Sql = "SELECT /*+ SET_VAR(information_schema_stats_expiry = 0) */ TABLE_NAME, UNIX_TIMESTAMP(UPDATE_TIME), UNIX_TIMESTAMP(CREATE_TIME) "
+                "FROM information_schema.TABLES WHERE TABLE_SCHEMA = DATABASE() AND TABLE_NAME IN (" + l_Tables + ")";
+
+            if (QueryResult l_Result = WorldDatabase.Query(l_Sql.c_str()))
+            {
+                do
+                {
+                    Field* l_Fields = l_Result->Fetch();
+
+                    /// Not tracked by the engine, or not written since MySQL started
+                    if (l_Fields[1].IsNull() || l_Fields[2].IsNull())
+                        continue;
+
+                    m_TableKeys[l_Fields[0].GetString()] = (l_Fields[1].GetUInt64() << 32) | (l_Fields[2].GetUInt64() & 0xFFFFFFFF);
+                }
+                while (l_Result->NextRow());
+            }
+        }
+
+        for (std::string const& l_Table : l_Missing)
+        {
+            if (m_TableKeys.find(l_Table) == m_TableKeys.end() && m_UnknownTables.insert(l_Table).second)
+                sLog->outError(LOG_FILTER_SERVER_LOADING, "World snapshot: no checksum nor update time for table `%s`, its queries are read from the database", l_Table.c_str());
+        }
+    }
+
+    for (std::string const& l_Table : p_Tables)
+    {
+        if (m_UnknownTables.find(l_Table) != m_UnknownTables.end())
+            return false;
+    }
+
+    return true;
+}
+
+bool WorldSnapshot::Read(std::vector<char> const& p_Buffer)
+{
+    SnapshotReader l_Reader(p_Buffer);
+
+    uint32 l_Magic, l_Version, l_EntryCount;
+    if (!l_Reader.Read(l_Magic) || !l_Reader.Read(l_Version) || !l_Reader.Read(l_EntryCount))
+        return false;
+
+    if (l_Magic != WORLD_SNAPSHOT_MAGIC || l_Version != WORLD_SNAPSHOT_VERSION)
+        return false;
+
+    for (uint32 l_I = 0; l_I < l_EntryCount; ++l_I)
+    {
+        std::string l_Sql;
+        uint32 l_TableCount, l_FieldCount;
+        uint64 l_DataSize;
+        char const* l_Data;
+
+        Entry l_Entry;
+        l_Entry.Used = false;
+
+        if (!l_Reader.ReadString(l_Sql) || !l_Reader.Read(l_TableCount))
+            return false;
+
+        for (uint32 l_J = 0; l_J < l_TableCount; ++l_J)
+        {
+            std::pair<std::string, uint64> l_Table;
+            if (!l_Reader.ReadString(l_Table.first) || !l_Reader.Read(l_Table.second))
+                return false;
+
+            l_Entry.Tables.push_back(l_Table);
+        }
+
+        if (!l_Reader.Read(l_FieldCount))
+            return false;
+
+        for (uint32 l_J = 0; l_J < l_FieldCount; ++l_J)
+        {
+            uint8 l_Type;
+            if (!l_Reader.Read(l_Type))
+                return false;
+
+            l_Entry.Types.push_back(enum_field_types(l_Type));
+        }
+
+        if (!l_Reader.Read(l_Entry.RowCount) || !l_Reader.Read(l_DataSize) || !l_Reader.ReadBytes(l_Data, l_DataSize))
+            return false;
+
+        l_Entry.Rows = std::make_shared<std::vector<char>>(l_Data, l_Data + l_DataSize);
+        m_Entries[l_Sql] = l_Entry;
+    }
+
+    return l_Reader.Position == p_Buffer.size();
+}
+
+bool WorldSnapshot::Write(std::string const& p_FileName) const
+{
+    std::vector<char> l_Buffer;
+    Append<uint32>(l_Buffer, WORLD_SNAPSHOT_MAGIC);
+    Append<uint32>(l_Buffer, WORLD_SNAPSHOT_VERSION);
+    Append<uint32>(l_Buffer, 0);
+
+    uint32 l_EntryCount = 0;
+    for (auto const& l_Itr : m_Entries)
+    {
+        Entry const& l_Entry = l_Itr.second;
+        if (!l_Entry.Used)
+            continue;
+
+        AppendString(l_Buffer, l_Itr.first);
+
+        Append<uint32>(l_Buffer, l_Entry.Tables.size());
+        for (auto const& l_Table : l_Entry.Tables)
+        {
+            AppendString(l_Buffer, l_Table.first);
+            Append<uint64>(l_Buffer, l_Table.second);
+        }
+
+        Append<uint32>(l_Buffer, l_Entry.Types.size());
+        for (enum_field_types l_Type : l_Entry.Types)
+            Append<uint8>(l_Buffer, l_Type);
+
+        Append<uint64>(l_Buffer, l_Entry.RowCount);
+        Append<uint64>(l_Buffer, l_Entry.Rows->size());
+        l_Buffer.insert(l_Buffer.end(), l_Entry.Rows->begin(), l_Entry.Rows->end());
+
+        ++l_EntryCount;
+    }
+
+    memcpy(&l_Buffer[2 * sizeof(uint32)], &l_EntryCount, sizeof(l_EntryCount));
+
+    /// Written aside then renamed, a crash while writing leaves the previous snapshot intact
+    std::string l_TempFileName = p_FileName + ".tmp";
+
+    FILE* l_File = fopen(l_TempFileName.c_str(), "wb");
+    if (!l_File)
+    {
+        sLog->outError(LOG_FILTER_SERVER_LOADING, "World snapshot: can't open %s for writing", l_TempFileName.c_str());
+        return false;
+    }
+
+    bool l_Ok = fwrite(l_Buffer.data(), 1, l_Buffer.size(), l_File) == l_Buffer.size();
+    l_Ok = !fclose(l_File) && l_Ok;
+
+#ifdef _WIN32
+    /// rename doesn't replace an existing file there
+    if (l_Ok)
+        remove(p_FileName.c_str());
+#endif
+
+    if (!l_Ok || rename(l_TempFileName.c_str(), p_FileName.c_str()))
+    {
+        sLog->outError(LOG_FILTER_SERVER_LOADING, "World snapshot: can't write %s", p_FileName.c_str());
+        remove(l_TempFileName.c_str());
+        return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,69 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Project-Hellscream https://hellscream.org
+// Copyright (C) 2018-2020 Project-Hellscream-6.2
+// Discord https://discord.gg/CWCF3C9
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _WORLD_SNAPSHOT_H
+#define _WORLD_SNAPSHOT_H
+
+#include "Common.h"
+#include "DatabaseEnv.h"
+#include <ace/Singleton.h>
+#include <mutex>
+
+/// On-disk copy of the rows returned by the big world database queries of the startup.
+/// Every query is stored with a key of each table it reads, rows are served from the file while the keys
+/// still match and fetched again from MySQL otherwise. The key is the live checksum of the tables which keep
+/// one (CHECKSUM = 1), the last update and creation time for the others, neither of them scans the table.
+/// The loaders themselves are unchanged, their validation and links to the DBCs and scripts are still done on every start.
+/// Only used during SetInitialWorldSettings, reload commands always query the database.
+class WorldSnapshot
+{
+    friend class ACE_Singleton<WorldSnapshot, ACE_Null_Mutex>;
+
+    public:
+        /// Reads the whole file, a missing or outdated file only means every query goes to MySQL
+        void Open(std::string const& p_FileName);
+        /// Writes the file back if any query was refreshed, and forwards every further query to MySQL
+        void Close();
+
+        /// Same as WorldDatabase.Query, p_Tables are all the tables read by p_Sql
+        QueryResult Query(std::string const& p_Sql, std::vector<std::string> const& p_Tables);
+
+    private:
+        WorldSnapshot() : m_Open(false), m_Dirty(false), m_Hits(0), m_Misses(0) { }
+
+        struct Entry
+        {
+            std::vector<std::pair<std::string, uint64>> Tables;     ///< Name, key when the rows were fetched
+            std::vector<enum_field_types> Types;
+            uint64 RowCount;
+            std::shared_ptr<std::vector<char> const> Rows;          ///< ResultSet::AppendRow layout
+            bool Used;
+        };
+
+        bool Read(std::vector<char> const& p_Buffer);
+        bool Write(std::string const& p_FileName) const;
+
+        /// Fetches the keys of the tables not seen yet, returns false if one of them has none
+        bool UpdateTableKeys(std::vector<std::string> const& p_Tables);
+
+        static QueryResult BuildResult(Entry const& p_Entry);
+
+        bool m_Open;
+        bool m_Dirty;
+        std::string m_FileName;
+        std::map<std::string, Entry> m_Entries;                     ///< Key is the SQL query
+        std::map<std::string, uint64> m_TableKeys;
+        std::set<std::string> m_UnknownTables;                      ///< Neither a live checksum nor an update time
+        uint32 m_Hits;
+        uint32 m_Misses;
+        std::mutex m_Lock;
+};
+
+#define sWorldSnapshot ACE_Singleton<WorldSnapshot, ACE_Null_Mutex>::instance()
+
+#endif
@@ -129,6 +129,7 @@ namespace JadeCore
     {
         WorldObject* i_source;
         WorldPacket* i_message;
+        SharedWorldPacket i_sharedMessage;
         uint32 i_phaseMask;
         float i_distSq;
         uint32 team;
@@ -159,7 +160,16 @@ namespace JadeCore
                 return;
 
             if (WorldSession* session = player->GetSession())
-                session->SendPacket(i_message);
+                session->SendPacket(GetSharedMessage());
+        }
+
+        /// The message is copied once for the first recipient, then only referenced by the sockets
+        SharedWorldPacket const& GetSharedMessage()
+        {
+            if (!i_sharedMessage)
+                i_sharedMessage = MakeSharedPacket(*i_message);
+
+            return i_sharedMessage;
         }
     };
 
@@ -167,6 +177,7 @@ namespace JadeCore
     {
         Unit* i_source;
         WorldPacket* i_message;
+        SharedWorldPacket i_sharedMessage;
         uint32 i_phaseMask;
         float i_distSq;
         UnfriendlyMessageDistDeliverer(Unit* src, WorldPacket* msg, float dist)
@@ -185,7 +196,12 @@ namespace JadeCore
                 return;
 
             if (WorldSession* session = player->GetSession())
-                session->SendPacket(i_message);
+            {
+                if (!i_sharedMessage)
+                    i_sharedMessage = MakeSharedPacket(*i_message);
+
+                session->SendPacket(i_sharedMessage);
+            }
 
             if (i_message->GetOpcode() == SMSG_CLEAR_TARGET)
             {
@@ -16,6 +16,7 @@
 #include "SpellInfo.h"
 #include "Group.h"
 #include "ObjectAccessor.h"
+#include "WorldSnapshot.h"
 
 static Rates const qualityToRate[MAX_ITEM_QUALITY] =
 {
@@ -95,7 +96,7 @@ uint32 LootStore::LoadLootTable()
     Clear();
 
     //                                                  0     1            2               3         4         5             6           7
-    QueryResult result = WorldDatabase.PQuery("SELECT entry, item, ChanceOrQuestChance, lootmode, groupid, mincountOrRef, maxcount, itemBonuses FROM %s", GetName());
+    QueryResult result = sWorldSnapshot->Query(std::string("SELECT entry, item, ChanceOrQuestChance, lootmode, groupid, mincountOrRef, maxcount, itemBonuses FROM ") + GetName(), { GetName() });
 
     if (!result)
         return 0;
@@ -0,0 +1,198 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Project-Hellscream https://hellscream.org
+// Copyright (C) 2018-2020 Project-Hellscream-6.2
+// Discord https://discord.gg/CWCF3C9
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include "GridPrefetcher.h"
+#include "Map.h"
+#include "MapTree.h"
+#include "World.h"
+#include "Log.h"
+
+/// Prepared grids nobody came to take are kept at most this many, past that the oldest ones are dropped
+#define MAX_PREPARED_GRID_MAPS 128
+/// Prepared grids nobody came to take in this time are dropped, the player went elsewhere
+#define PREPARED_GRID_MAP_TIMEOUT (60 * IN_MILLISECONDS)
+
+void GridPrefetcher::Start()
+{
+    if (m_Active)
+        return;
+
+    m_Active = true;
+    m_Thread = std::thread(&GridPrefetcher::WorkerThread, this);
+}
+
+void GridPrefetcher::Stop()
+{
+    if (!m_Active)
+        return;
+
+    m_Active = false;
+    m_Queue.Cancel();
+
+    if (m_Thread.joinable())
+        m_Thread.join();
+
+    std::lock_guard<std::mutex> l_Lock(m_Lock);
+
+    for (auto& l_Prepared : m_Prepared)
+        delete l_Prepared.second.Terrain;
+
+    m_Prepared.clear();
+    m_Requested.clear();
+    m_Discarded.clear();
+}
+
+void GridPrefetcher::Request(uint32 p_MapId, uint32 p_GX, uint32 p_GY)
+{
+    if (!m_Active || p_GX >= MAX_NUMBER_OF_GRIDS || p_GY >= MAX_NUMBER_OF_GRIDS)
+        return;
+
+    uint32 l_Key = MakeKey(p_MapId, p_GX, p_GY);
+
+    {
+        std::lock_guard<std::mutex> l_Lock(m_Lock);
+        if (m_Prepared.find(l_Key) != m_Prepared.end() || !m_Requested.insert(l_Key).second)
+            return;
+    }
+
+    m_Queue.Push(l_Key);
+}
+
+GridMap* GridPrefetcher::TakeGridMap(uint32 p_MapId, uint32 p_GX, uint32 p_GY)
+{
+    if (!m_Active)
+        return nullptr;
+
+    uint32 l_Key = MakeKey(p_MapId, p_GX, p_GY);
+
+    std::lock_guard<std::mutex> l_Lock(m_Lock);
+
+    auto l_Itr = m_Prepared.find(l_Key);
+    if (l_Itr == m_Prepared.end())
+    {
+        if (m_Requested.find(l_Key) != m_Requested.end())
+            m_Discarded.insert(l_Key);
+
+        return nullptr;
+    }
+
+    GridMap* l_GridMap = l_Itr->second.Terrain;
+    m_Prepared.erase(l_Itr);
+    return l_GridMap;
+}
+
+void GridPrefetcher::DropGridMap(uint32 p_MapId, uint32 p_GX, uint32 p_GY)
+{
+    delete TakeGridMap(p_MapId, p_GX, p_GY);
+}
+
+void GridPrefetcher::EvictPrepared(uint32 p_Now)
+{
+    for (auto l_Itr = m_Prepared.begin(); l_Itr != m_Prepared.end();)
+    {
+        if (getMSTimeDiff(l_Itr->second.PreparedTime, p_Now) < PREPARED_GRID_MAP_TIMEOUT)
+        {
+            ++l_Itr;
+            continue;
+        }
+
+        delete l_Itr->second.Terrain;
+        l_Itr = m_Prepared.erase(l_Itr);
+    }
+
+    while (m_Prepared.size() >= MAX_PREPARED_GRID_MAPS)
+    {
+        auto l_Oldest = m_Prepared.begin();
+        for (auto l_Itr = m_Prepared.begin(); l_Itr != m_Prepared.end(); ++l_Itr)
+        {
+            if (getMSTimeDiff(l_Itr->second.PreparedTime, p_Now) > getMSTimeDiff(l_Oldest->second.PreparedTime, p_Now))
+                l_Oldest = l_Itr;
+        }
+
+        delete l_Oldest->second.Terrain;
+        m_Prepared.erase(l_Oldest);
+    }
+}
+
+void GridPrefetcher::WorkerThread()
+{
+    while (m_Active)
+    {
+        uint32 l_Key = 0;
+        m_Queue.WaitAndPop(l_Key);
+
+        if (!m_Active)
+            return;
+
+        Prefetch(l_Key);
+
+        std::lock_guard<std::mutex> l_Lock(m_Lock);
+        m_Requested.erase(l_Key);
+        m_Discarded.erase(l_Key);
+    }
+}
+
+/// Reads a whole file and drops its content, the next open of the map thread hits the page cache
+static void WarmFile(std::string const& p_FileName)
+{
+    FILE* l_File = fopen(p_FileName.c_str(), "rb");
+    if (!l_File)
+        return;
+
+    char l_Buffer[64 * 1024];
+    while (fread(l_Buffer, 1, sizeof(l_Buffer), l_File) == sizeof(l_Buffer))
+        ;
+
+    fclose(l_File);
+}
+
+void GridPrefetcher::Prefetch(uint32 p_Key)
+{
+    uint32 l_MapId = p_Key >> 16;
+    uint32 l_GX    = (p_Key >> 8) & 0xFF;
+    uint32 l_GY    = p_Key & 0xFF;
+
+    std::string const& l_DataPath = sWorld->GetDataPath();
+
+    char l_FileName[64];
+    snprintf(l_FileName, sizeof(l_FileName), "maps/%04u_%02u_%02u.map", l_MapId, l_GX, l_GY);
+
+    std::string l_MapFile = l_DataPath + l_FileName;
+
+    GridMap* l_GridMap = new GridMap();
+    if (!l_GridMap->loadData(&l_MapFile[0]))
+    {
+        /// Let the map thread try again and report the error itself
+        delete l_GridMap;
+    }
+    else
+    {
+        std::lock_guard<std::mutex> l_Lock(m_Lock);
+
+        /// The map loaded the grid while it was read
+        if (m_Discarded.find(p_Key) != m_Discarded.end())
+            delete l_GridMap;
+        else
+        {
+            uint32 l_Now = getMSTime();
+            EvictPrepared(l_Now);
+
+            PreparedGridMap l_Prepared;
+            l_Prepared.Terrain      = l_GridMap;
+            l_Prepared.PreparedTime = l_Now;
+
+            if (!m_Prepared.insert(std::make_pair(p_Key, l_Prepared)).second)
+                delete l_GridMap;
+        }
+    }
+
+    WarmFile(l_DataPath + "vmaps/" + VMAP::StaticMapTree::getTileFileName(l_MapId, l_GX, l_GY));
+
+    snprintf(l_FileName, sizeof(l_FileName), "mmaps/%04u%02u%02u.mmtile", l_MapId, l_GX, l_GY);
+    WarmFile(l_DataPath + l_FileName);
+}
@@ -0,0 +1,76 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Project-Hellscream https://hellscream.org
+// Copyright (C) 2018-2020 Project-Hellscream-6.2
+// Discord https://discord.gg/CWCF3C9
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _GRID_PREFETCHER_H
+#define _GRID_PREFETCHER_H
+
+#include "Common.h"
+#include "ProducerConsumerQueue.h"
+#include <ace/Singleton.h>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+
+class GridMap;
+
+/// Reads the terrain of grids about to be entered on a background thread.
+/// The .map file is parsed into a GridMap handed over to the map on load, the .vmtile and .mmtile
+/// files are read once so the blocking loads of the map thread are served from the page cache.
+class GridPrefetcher
+{
+    friend class ACE_Singleton<GridPrefetcher, ACE_Null_Mutex>;
+
+    public:
+        void Start();
+        void Stop();
+
+        bool IsActive() const { return m_Active; }
+
+        /// Map thread, queues the grid unless it is already queued or prepared. gx/gy are GridMaps indexes
+        void Request(uint32 p_MapId, uint32 p_GX, uint32 p_GY);
+
+        /// Map thread, returns the prepared terrain of the grid if any, the caller owns it.
+        /// A read still running for the grid is discarded, the map loads the grid itself
+        GridMap* TakeGridMap(uint32 p_MapId, uint32 p_GX, uint32 p_GY);
+
+        /// Map thread, the grid terrain is loaded without the prefetcher, forget what was prepared for it
+        void DropGridMap(uint32 p_MapId, uint32 p_GX, uint32 p_GY);
+
+    private:
+        GridPrefetcher() : m_Active(false) { }
+        ~GridPrefetcher() { Stop(); }
+
+        static uint32 MakeKey(uint32 p_MapId, uint32 p_GX, uint32 p_GY) { return p_MapId << 16 | p_GX << 8 | p_GY; }
+
+        struct PreparedGridMap
+        {
+            GridMap* Terrain;
+            uint32 PreparedTime;
+        };
+
+        void WorkerThread();
+        void Prefetch(uint32 p_Key);
+
+        /// Deletes the prepared grids nobody came to take in time, and the oldest ones past the limit. m_Lock must be held
+        void EvictPrepared(uint32 p_Now);
+
+        std::atomic<bool> m_Active;
+        std::thread m_Thread;
+        ProducerConsumerQueue<uint32> m_Queue;
+
+        std::mutex m_Lock;
+        std::unordered_set<uint32> m_Requested;                 ///< Queued or being read
+        std::unordered_set<uint32> m_Discarded;                 ///< Being read but loaded by the map meanwhile
+        std::unordered_map<uint32, PreparedGridMap> m_Prepared; ///< Waiting for the map to load the grid
+};
+
+#define sGridPrefetcher ACE_Singleton<GridPrefetcher, ACE_Null_Mutex>::instance()
+
+#endif
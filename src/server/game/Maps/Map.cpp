@@ -28,9 +28,21 @@
 #include "OutdoorPvPMgr.h"
 #include "DisableMgr.h"
 #include "Logger.h"
+#include "GridPrefetcher.h"
+#include "WaypointMovementGenerator.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 u_map_magic MapMagic        = { {'M','A','P','S'} };
 u_map_magic MapVersionMagic = { {'v','1','.','8'} };
+u_map_magic MapMappedVersionMagic = { {'m','1','.','8'} };
 u_map_magic MapAreaMagic    = { {'A','R','E','A'} };
 u_map_magic MapHeightMagic  = { {'M','H','G','T'} };
 u_map_magic MapLiquidMagic  = { {'M','L','I','Q'} };
@@ -54,6 +66,8 @@ Map::~Map()
 
     UnloadAll();
 
+    MoveObjectUpdates(true);
+
     while (!i_worldObjects.empty())
     {
         WorldObject* obj = *i_worldObjects.begin();
@@ -97,7 +111,7 @@ bool Map::ExistMap(uint32 mapid, int gx, int gy)
         map_fileheader header;
         if (fread(&header, sizeof(header), 1, pf) == 1)
         {
-            if (header.mapMagic.asUInt != MapMagic.asUInt || header.versionMagic.asUInt != MapVersionMagic.asUInt)
+            if (header.mapMagic.asUInt != MapMagic.asUInt || (header.versionMagic.asUInt != MapVersionMagic.asUInt && header.versionMagic.asUInt != MapMappedVersionMagic.asUInt))
                 sLog->outError(LOG_FILTER_MAPS, "Map file '%s' is from an incompatible clientversion. Please recreate using the mapextractor.", tmp);
             else
                 ret = true;
@@ -168,6 +182,8 @@ void Map::LoadMap(int gx, int gy, bool reload)
         // load grid map for base map
         if (!m_parentMap->GridMaps[gx][gy])
             m_parentMap->EnsureGridCreated(GridCoord(63-gx, 63-gy));
+        else
+            sGridPrefetcher->DropGridMap(GetId(), gx, gy);
 
         ((MapInstanced*)(m_parentMap))->AddGridMapReference(GridCoord(gx, gy));
         GridMaps[gx][gy] = m_parentMap->GridMaps[gx][gy];
@@ -175,7 +191,10 @@ void Map::LoadMap(int gx, int gy, bool reload)
     }
 
     if (GridMaps[gx][gy] && !reload)
+    {
+        sGridPrefetcher->DropGridMap(GetId(), gx, gy);
         return;
+    }
 
     //map already load, delete it before reloading (Is it necessary? Do we really need the ability the reload maps during runtime?)
     if (GridMaps[gx][gy])
@@ -192,6 +211,14 @@ void Map::LoadMap(int gx, int gy, bool reload)
     tmp = new char[len];
     snprintf(tmp, len, (char *)(sWorld->GetDataPath()+"maps/%04u_%02u_%02u.map").c_str(), GetId(), gx, gy);
     sLog->outInfo(LOG_FILTER_MAPS, "Loading map %s", tmp);
+    // terrain read ahead by the prefetcher only needs to be linked in
+    if (GridMap* l_Prepared = sGridPrefetcher->TakeGridMap(GetId(), gx, gy))
+    {
+        GridMaps[gx][gy] = l_Prepared;
+        delete [] tmp;
+        return;
+    }
+
     // loading data
     GridMaps[gx][gy] = new GridMap();
     if (!GridMaps[gx][gy]->loadData(tmp))
@@ -232,9 +259,9 @@ void Map::DeleteStateMachine()
 Map::Map(uint32 id, time_t expiry, uint32 InstanceId, uint8 SpawnMode, Map* _parent):
 _creatureToMoveLock(false), _gameObjectsToMoveLock(false), i_mapEntry(sMapStore.LookupEntry(id)),
 i_spawnMode(SpawnMode), i_InstanceId(InstanceId), m_unloadTimer(0), m_VisibleDistance(DEFAULT_VISIBILITY_DISTANCE),
-m_VisibilityNotifyPeriod(DEFAULT_VISIBILITY_NOTIFY_PERIOD),
+m_VisibilityNotifyPeriod(DEFAULT_VISIBILITY_NOTIFY_PERIOD), m_LastUpdateDuration(0), m_LastUpdateLoad(0),
 m_activeNonPlayersIter(m_activeNonPlayers.end()), _transportsGameObjectUpdateIter(_transportsGameObject.end()), _transportsUpdateIter(_transports.end()),
-i_gridExpiry(expiry), i_scriptLock(false)
+i_gridExpiry(expiry), m_GridPrefetchTimer(0), i_scriptLock(false)
 {
     m_parentMap = (_parent ? _parent : this);
     for (unsigned int idx=0; idx < MAX_NUMBER_OF_GRIDS; ++idx)
@@ -385,7 +412,7 @@ template<>
 void Map::DeleteFromWorld(Player* player)
 {
     sObjectAccessor->RemoveObject(player);
-    sObjectAccessor->RemoveUpdateObject(player); //TODO: I do not know why we need this, it should be removed in ~Object anyway
+    player->RemoveFromObjectUpdate(); //TODO: I do not know why we need this, it should be removed in ~Object anyway
     delete player;
 }
 
@@ -645,6 +672,9 @@ void Map::Update(const uint32 t_diff)
             session->Update(t_diff, updater);
         }
     }
+    if (sGridPrefetcher->IsActive())
+        PrefetchGridsAhead(t_diff);
+
     /// update active cells around players and active objects
     resetMarkedCells();
 
@@ -749,11 +779,148 @@ void Map::Update(const uint32 t_diff)
 
     sScriptMgr->OnMapUpdate(this, t_diff);
 
+    SendObjectUpdates();
+
+    m_LastUpdateDuration = GetMSTimeDiffToNow(l_Time);
+    m_LastUpdateLoad = m_mapRefManager.getSize() + uint32(m_activeNonPlayers.size());
+
 #ifdef CROSS
     SetUpdating(false);
 #endif
 }
 
+void Map::MoveObjectUpdates(bool p_All)
+{
+    std::vector<Object*> l_Objects;
+
+    {
+        std::lock_guard<std::mutex> l_Guard(m_ObjectsToUpdateLock);
+        l_Objects.assign(i_objectsToUpdate.begin(), i_objectsToUpdate.end());
+    }
+
+    for (Object* l_Object : l_Objects)
+    {
+        if (p_All || l_Object->GetObjectUpdateMap() != this)
+            l_Object->MoveObjectUpdate(this);
+    }
+}
+
+void Map::SendObjectUpdates()
+{
+    UpdateDataMapType l_UpdatePlayers;
+
+    while (true)
+    {
+        Object* l_Object = nullptr;
+
+        {
+            std::lock_guard<std::mutex> l_Guard(m_ObjectsToUpdateLock);
+            if (i_objectsToUpdate.empty())
+                break;
+
+            l_Object = *i_objectsToUpdate.begin();
+            i_objectsToUpdate.erase(i_objectsToUpdate.begin());
+        }
+
+        ASSERT(l_Object && l_Object->IsInWorld());
+        l_Object->BuildUpdate(l_UpdatePlayers);
+    }
+
+    WorldPacket l_Packet;                                   // here we allocate a std::vector with a size of 0x10000
+    for (UpdateDataMapType::iterator l_Iter = l_UpdatePlayers.begin(); l_Iter != l_UpdatePlayers.end(); ++l_Iter)
+    {
+        if (l_Iter->second.BuildPacket(&l_Packet))
+            l_Iter->first->GetSession()->SendPacket(&l_Packet);
+        l_Packet.clear();                                   // clean the string
+    }
+}
+
+/// Seconds of movement ahead of a player whose terrain is read in advance
+#define GRID_PREFETCH_LOOKAHEAD 10
+/// Taxi nodes ahead of a flying player whose terrain is read in advance
+#define GRID_PREFETCH_TAXI_NODES 40
+
+void Map::PrefetchGridsAhead(uint32 t_diff)
+{
+    /// Instances use the terrain of their parent, it's loaded with the base map
+    if (i_InstanceId != 0 || Instanceable())
+        return;
+
+    m_GridPrefetchTimer += t_diff;
+    if (m_GridPrefetchTimer < IN_MILLISECONDS)
+        return;
+
+    uint32 l_Interval = m_GridPrefetchTimer;
+    m_GridPrefetchTimer = 0;
+
+    std::unordered_map<uint64, Position> l_Positions;
+
+    for (MapRefManager::iterator l_Itr = m_mapRefManager.begin(); l_Itr != m_mapRefManager.end(); ++l_Itr)
+    {
+        Player* l_Player = l_Itr->getSource();
+        if (!l_Player || !l_Player->IsInWorld())
+            continue;
+
+        Position l_Position;
+        l_Player->GetPosition(&l_Position);
+        l_Positions[l_Player->GetGUID()] = l_Position;
+
+        /// Flight paths are known in advance, follow the next nodes on this map
+        if (l_Player->GetMotionMaster()->GetCurrentMovementGeneratorType() == FLIGHT_MOTION_TYPE)
+        {
+            FlightPathMovementGenerator* l_Flight = static_cast<FlightPathMovementGenerator*>(l_Player->GetMotionMaster()->top());
+            TaxiPathNodeList const& l_Path = l_Flight->GetPath();
+
+            uint32 l_End = std::min(uint32(l_Path.size()), l_Flight->GetCurrentNode() + GRID_PREFETCH_TAXI_NODES);
+            for (uint32 l_Node = l_Flight->GetCurrentNode(); l_Node < l_End; ++l_Node)
+            {
+                if (l_Path[l_Node]->MapID == GetId())
+                    RequestGridPrefetch(l_Path[l_Node]->x, l_Path[l_Node]->y);
+            }
+
+            continue;
+        }
+
+        /// Otherwise extrapolate the movement seen since the last prediction
+        auto l_Previous = m_GridPrefetchPositions.find(l_Player->GetGUID());
+        if (l_Previous == m_GridPrefetchPositions.end())
+            continue;
+
+        float l_Factor = float(GRID_PREFETCH_LOOKAHEAD * IN_MILLISECONDS) / float(l_Interval);
+        float l_DeltaX = (l_Position.m_positionX - l_Previous->second.m_positionX) * l_Factor;
+        float l_DeltaY = (l_Position.m_positionY - l_Previous->second.m_positionY) * l_Factor;
+
+        float l_Distance = std::sqrt(l_DeltaX * l_DeltaX + l_DeltaY * l_DeltaY);
+        if (l_Distance < SIZE_OF_GRID_CELL)
+            continue;
+
+        /// Half a grid steps can't jump over a grid
+        uint32 l_Steps = uint32(l_Distance / (SIZE_OF_GRIDS / 2.0f)) + 1;
+        for (uint32 l_Step = 1; l_Step <= l_Steps; ++l_Step)
+        {
+            float l_Ratio = float(l_Step) / float(l_Steps);
+            RequestGridPrefetch(l_Position.m_positionX + l_DeltaX * l_Ratio, l_Position.m_positionY + l_DeltaY * l_Ratio);
+        }
+    }
+
+    m_GridPrefetchPositions.swap(l_Positions);
+}
+
+void Map::RequestGridPrefetch(float p_X, float p_Y)
+{
+    if (!JadeCore::IsValidMapCoord(p_X, p_Y))
+        return;
+
+    GridCoord l_Coord = JadeCore::ComputeGridCoord(p_X, p_Y);
+    uint32 l_GX = (MAX_NUMBER_OF_GRIDS - 1) - l_Coord.x_coord;
+    uint32 l_GY = (MAX_NUMBER_OF_GRIDS - 1) - l_Coord.y_coord;
+
+    if (GridMaps[l_GX][l_GY])
+        return;
+
+    sGridPrefetcher->Request(GetId(), l_GX, l_GY);
+}
+
 void Map::RemovePlayerFromMap(Player* player, bool remove)
 {
     player->RemoveFromWorld();
@@ -766,6 +933,9 @@ void Map::RemovePlayerFromMap(Player* player, bool remove)
     else
         ASSERT(remove); //maybe deleted in logoutplayer when player is not in a map
 
+    /// Pending updates of items whose owner is not on the map anymore would stay listed here
+    MoveObjectUpdates(false);
+
     if (remove)
     {
         DeleteFromWorld(player);
@@ -1421,6 +1591,8 @@ GridMap::GridMap()
     _liquidEntry = nullptr;
     _liquidFlags = nullptr;
     _liquidMap = nullptr;
+    m_MappedData = nullptr;
+    m_MappedSize = 0;
 }
 
 GridMap::~GridMap()
@@ -1445,6 +1617,17 @@ bool GridMap::loadData(char *filename)
         return false;
     }
 
+    if (header.mapMagic.asUInt == MapMagic.asUInt && header.versionMagic.asUInt == MapMappedVersionMagic.asUInt)
+    {
+        fclose(in);
+
+        if (loadMappedData(filename))
+            return true;
+
+        unloadData();
+        return false;
+    }
+
     if (header.mapMagic.asUInt == MapMagic.asUInt && header.versionMagic.asUInt == MapVersionMagic.asUInt)
     {
         // loadup area data
@@ -1478,14 +1661,29 @@ bool GridMap::loadData(char *filename)
 
 void GridMap::unloadData()
 {
-    delete[] _areaMap;
-    delete[] m_V9;
-    delete[] m_V8;
-    delete[] _maxHeight;
-    delete[] _minHeight;
-    delete[] _liquidEntry;
-    delete[] _liquidFlags;
-    delete[] _liquidMap;
+    if (m_MappedData)
+    {
+        /// The arrays point into the view, nothing was allocated
+#ifdef _WIN32
+        UnmapViewOfFile(m_MappedData);
+#else
+        munmap(const_cast<uint8*>(m_MappedData), m_MappedSize);
+#endif
+        m_MappedData = nullptr;
+        m_MappedSize = 0;
+    }
+    else
+    {
+        delete[] _areaMap;
+        delete[] m_V9;
+        delete[] m_V8;
+        delete[] _maxHeight;
+        delete[] _minHeight;
+        delete[] _liquidEntry;
+        delete[] _liquidFlags;
+        delete[] _liquidMap;
+    }
+
     _areaMap = nullptr;
     m_V9 = nullptr;
     m_V8 = nullptr;
@@ -1497,6 +1695,191 @@ void GridMap::unloadData()
     _gridGetHeight = &GridMap::getHeightFromFlat;
 }
 
+bool GridMap::loadMappedData(char const* p_FileName)
+{
+    /// Read only shared mapping, the pages are backed by the file so every map and every process
+    /// loading this tile share the same physical memory and the kernel evicts them when needed
+#ifdef _WIN32
+    HANDLE l_File = CreateFileA(p_FileName, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (l_File == INVALID_HANDLE_VALUE)
+        return false;
+
+    LARGE_INTEGER l_FileSize;
+    if (!GetFileSizeEx(l_File, &l_FileSize) || l_FileSize.QuadPart < LONGLONG(sizeof(map_fileheader)))
+    {
+        CloseHandle(l_File);
+        return false;
+    }
+
+    HANDLE l_Mapping = CreateFileMappingA(l_File, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(l_File);
+    if (!l_Mapping)
+        return false;
+
+    void* l_View = MapViewOfFile(l_Mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(l_Mapping);
+    if (!l_View)
+        return false;
+
+    m_MappedSize = size_t(l_FileSize.QuadPart);
+#else
+    int l_File = open(p_FileName, O_RDONLY);
+    if (l_File < 0)
+        return false;
+
+    struct stat l_Stat;
+    if (fstat(l_File, &l_Stat) != 0 || l_Stat.st_size < off_t(sizeof(map_fileheader)))
+    {
+        close(l_File);
+        return false;
+    }
+
+    void* l_View = mmap(nullptr, size_t(l_Stat.st_size), PROT_READ, MAP_SHARED, l_File, 0);
+    close(l_File);
+    if (l_View == MAP_FAILED)
+        return false;
+
+    m_MappedSize = size_t(l_Stat.st_size);
+#endif
+
+    m_MappedData = static_cast<uint8 const*>(l_View);
+
+    map_fileheader const* l_Header = reinterpret_cast<map_fileheader const*>(m_MappedData);
+
+    if (l_Header->areaMapOffset && !loadMappedAreaData(l_Header->areaMapOffset))
+    {
+        sLog->outError(LOG_FILTER_MAPS, "Error loading map area data from mapped file '%s'", p_FileName);
+        return false;
+    }
+
+    if (l_Header->heightMapOffset && !loadMappedHeightData(l_Header->heightMapOffset))
+    {
+        sLog->outError(LOG_FILTER_MAPS, "Error loading map height data from mapped file '%s'", p_FileName);
+        return false;
+    }
+
+    if (l_Header->liquidMapOffset && !loadMappedLiquidData(l_Header->liquidMapOffset))
+    {
+        sLog->outError(LOG_FILTER_MAPS, "Error loading map liquids data from mapped file '%s'", p_FileName);
+        return false;
+    }
+
+    return true;
+}
+
+/// Points to count values of type at offset in the mapped view, nullptr if misaligned or past the end of the file
+#define MAPPED_ARRAY(type, offset, count) \
+    ((offset) % MAP_MAPPED_ALIGNMENT == 0 && size_t(offset) + sizeof(type) * (count) <= m_MappedSize ? \
+    const_cast<type*>(reinterpret_cast<type const*>(m_MappedData + (offset))) : nullptr)
+
+bool GridMap::loadMappedAreaData(uint32 p_Offset)
+{
+    map_areaHeader const* l_Header = MAPPED_ARRAY(map_areaHeader, p_Offset, 1);
+    if (!l_Header || l_Header->fourcc != MapAreaMagic.asUInt)
+        return false;
+
+    _gridArea = l_Header->gridArea;
+
+    if (!(l_Header->flags & MAP_AREA_NO_AREA))
+    {
+        _areaMap = MAPPED_ARRAY(uint16, MAP_MAPPED_ALIGN(p_Offset + sizeof(map_areaHeader)), 16 * 16);
+        if (!_areaMap)
+            return false;
+    }
+
+    return true;
+}
+
+bool GridMap::loadMappedHeightData(uint32 p_Offset)
+{
+    map_heightHeader const* l_Header = MAPPED_ARRAY(map_heightHeader, p_Offset, 1);
+    if (!l_Header || l_Header->fourcc != MapHeightMagic.asUInt)
+        return false;
+
+    _gridHeight = l_Header->gridHeight;
+
+    uint32 l_Offset = MAP_MAPPED_ALIGN(p_Offset + sizeof(map_heightHeader));
+
+    if (!(l_Header->flags & MAP_HEIGHT_NO_HEIGHT))
+    {
+        uint32 l_ValueSize = sizeof(float);
+        if (l_Header->flags & MAP_HEIGHT_AS_INT16)
+        {
+            l_ValueSize = sizeof(uint16);
+            _gridIntHeightMultiplier = (l_Header->gridMaxHeight - l_Header->gridHeight) / 65535;
+            _gridGetHeight = &GridMap::getHeightFromUint16;
+        }
+        else if (l_Header->flags & MAP_HEIGHT_AS_INT8)
+        {
+            l_ValueSize = sizeof(uint8);
+            _gridIntHeightMultiplier = (l_Header->gridMaxHeight - l_Header->gridHeight) / 255;
+            _gridGetHeight = &GridMap::getHeightFromUint8;
+        }
+        else
+            _gridGetHeight = &GridMap::getHeightFromFloat;
+
+        m_uint8_V9 = MAPPED_ARRAY(uint8, l_Offset, 129 * 129 * l_ValueSize);
+        l_Offset = MAP_MAPPED_ALIGN(l_Offset + 129 * 129 * l_ValueSize);
+        m_uint8_V8 = MAPPED_ARRAY(uint8, l_Offset, 128 * 128 * l_ValueSize);
+        l_Offset = MAP_MAPPED_ALIGN(l_Offset + 128 * 128 * l_ValueSize);
+
+        if (!m_uint8_V9 || !m_uint8_V8)
+            return false;
+    }
+    else
+        _gridGetHeight = &GridMap::getHeightFromFlat;
+
+    if (l_Header->flags & MAP_HEIGHT_HAS_FLIGHT_BOUNDS)
+    {
+        _maxHeight = MAPPED_ARRAY(int16, l_Offset, 3 * 3);
+        l_Offset = MAP_MAPPED_ALIGN(l_Offset + sizeof(int16) * 3 * 3);
+        _minHeight = MAPPED_ARRAY(int16, l_Offset, 3 * 3);
+
+        if (!_maxHeight || !_minHeight)
+            return false;
+    }
+
+    return true;
+}
+
+bool GridMap::loadMappedLiquidData(uint32 p_Offset)
+{
+    map_liquidHeader const* l_Header = MAPPED_ARRAY(map_liquidHeader, p_Offset, 1);
+    if (!l_Header || l_Header->fourcc != MapLiquidMagic.asUInt)
+        return false;
+
+    _liquidType   = l_Header->liquidType;
+    _liquidOffX   = l_Header->offsetX;
+    _liquidOffY   = l_Header->offsetY;
+    _liquidWidth  = l_Header->width;
+    _liquidHeight = l_Header->height;
+    _liquidLevel  = l_Header->liquidLevel;
+
+    uint32 l_Offset = MAP_MAPPED_ALIGN(p_Offset + sizeof(map_liquidHeader));
+
+    if (!(l_Header->flags & MAP_LIQUID_NO_TYPE))
+    {
+        _liquidEntry = MAPPED_ARRAY(uint16, l_Offset, 16 * 16);
+        l_Offset = MAP_MAPPED_ALIGN(l_Offset + sizeof(uint16) * 16 * 16);
+        _liquidFlags = MAPPED_ARRAY(uint8, l_Offset, 16 * 16);
+        l_Offset = MAP_MAPPED_ALIGN(l_Offset + sizeof(uint8) * 16 * 16);
+
+        if (!_liquidEntry || !_liquidFlags)
+            return false;
+    }
+
+    if (!(l_Header->flags & MAP_LIQUID_NO_HEIGHT))
+    {
+        _liquidMap = MAPPED_ARRAY(float, l_Offset, uint32(_liquidWidth) * uint32(_liquidHeight));
+        if (!_liquidMap)
+            return false;
+    }
+
+    return true;
+}
+
+#undef MAPPED_ARRAY
+
 bool GridMap::loadAreaData(FILE* in, uint32 offset, uint32 /*size*/)
 {
     map_areaHeader header;
@@ -2522,6 +2905,9 @@ void Map::DelayedUpdate(const uint32 t_diff)
 {
     RemoveAllObjectsInRemoveList();
 
+    /// Changes done after Map::Update (world thread, remove list) are sent within the same tick
+    SendObjectUpdates();
+
     // Don't unload grids if it's battleground, since we may have manually added GOs, creatures, those doesn't load from DB at grid re-load !
     // This isn't really bother us, since as soon as we have instanced BG-s, the whole map unloads as the BG gets ended
     if (!IsBattlegroundOrArena())
@@ -2637,8 +3023,13 @@ uint32 Map::GetPlayersCountExceptGMs() const
 
 void Map::SendToPlayers(WorldPacket const* data) const
 {
+    if (m_mapRefManager.isEmpty())
+        return;
+
+    SharedWorldPacket l_Packet = MakeSharedPacket(*data);
+
     for (MapRefManager::const_iterator itr = m_mapRefManager.begin(); itr != m_mapRefManager.end(); ++itr)
-        itr->getSource()->GetSession()->SendPacket(data);
+        itr->getSource()->GetSession()->SendPacket(l_Packet);
 }
 
 bool Map::ActiveObjectsNearGrid(NGridType const& ngrid) const
@@ -20,6 +20,7 @@
 #include "MapRefManager.h"
 #include "DynamicTree.h"
 #include "GameObjectModel.h"
+#include "UnitSpatialIndex.h"
 #include "Common.h"
 
 #include <bitset>
@@ -75,6 +76,11 @@ struct map_fileheader
     uint32 holesSize;
 };
 
+/// Files using the MapMappedVersionMagic version keep the same headers, but every section and every array
+/// of a section start on this boundary so the file can be mapped read only and used in place
+#define MAP_MAPPED_ALIGNMENT    8
+#define MAP_MAPPED_ALIGN(x)     (((x) + MAP_MAPPED_ALIGNMENT - 1) & ~uint32(MAP_MAPPED_ALIGNMENT - 1))
+
 #define MAP_AREA_NO_AREA      0x0001
 
 struct map_areaHeader
@@ -184,6 +190,14 @@ class GridMap
     uint8 _liquidWidth;
     uint8 _liquidHeight;
 
+    /// Read only view of a memory mapped file, the arrays above point into it instead of being allocated
+    uint8 const* m_MappedData;
+    size_t m_MappedSize;
+
+    bool loadMappedData(char const* p_FileName);
+    bool loadMappedAreaData(uint32 p_Offset);
+    bool loadMappedHeightData(uint32 p_Offset);
+    bool loadMappedLiquidData(uint32 p_Offset);
 
     bool loadAreaData(FILE* in, uint32 offset, uint32 size);
     bool loadHeihgtData(FILE* in, uint32 offset, uint32 size);
@@ -296,6 +310,10 @@ class Map : public GridRefManager<NGridType>
 
         template<class T, class CONTAINER> void Visit(const Cell& cell, TypeContainerVisitor<T, CONTAINER> &visitor);
 
+        /// Positions of the units in world, for the range searches of spells and AI
+        UnitSpatialIndex& GetUnitSpatialIndex() { return m_UnitSpatialIndex; }
+        UnitSpatialIndex const& GetUnitSpatialIndex() const { return m_UnitSpatialIndex; }
+
         bool IsRemovalGrid(float x, float y) const
         {
             GridCoord p = JadeCore::ComputeGridCoord(x, y);
@@ -432,6 +450,20 @@ class Map : public GridRefManager<NGridType>
 
         bool HavePlayers() const { return !m_mapRefManager.isEmpty(); }
         uint32 GetPlayersCountExceptGMs() const;
+
+        /// Duration (ms) of the last Update of this map alone, scheduled instances excluded
+        uint32 GetLastUpdateDuration() const { return m_LastUpdateDuration; }
+        /// Players and active objects seen by the last Update
+        uint32 GetLastUpdateLoad() const { return m_LastUpdateLoad; }
+
+        /// Maps expected to take longest are dispatched first so they don't end the tick alone
+        static bool HasHigherUpdateCost(Map const* p_Left, Map const* p_Right)
+        {
+            if (p_Left->m_LastUpdateDuration != p_Right->m_LastUpdateDuration)
+                return p_Left->m_LastUpdateDuration > p_Right->m_LastUpdateDuration;
+
+            return p_Left->m_LastUpdateLoad > p_Right->m_LastUpdateLoad;
+        }
         bool ActiveObjectsNearGrid(NGridType const& ngrid) const;
 
         void AddWorldObject(WorldObject* obj) { i_worldObjects.insert(obj); }
@@ -444,6 +476,25 @@ class Map : public GridRefManager<NGridType>
 
         void SendToPlayers(WorldPacket const* data) const;
 
+        void AddUpdateObject(Object* p_Object)
+        {
+            std::lock_guard<std::mutex> l_Guard(m_ObjectsToUpdateLock);
+            i_objectsToUpdate.insert(p_Object);
+        }
+
+        void RemoveUpdateObject(Object* p_Object)
+        {
+            std::lock_guard<std::mutex> l_Guard(m_ObjectsToUpdateLock);
+            i_objectsToUpdate.erase(p_Object);
+        }
+
+        /// Build and send SMSG_UPDATE_OBJECT for every object of the map with pending value changes
+        void SendObjectUpdates();
+
+        /// Move the pending updates which don't belong to the map anymore, like items of a player who left it
+        /// @p_All true if the map is destroyed, every pending update is moved
+        void MoveObjectUpdates(bool p_All);
+
         typedef MapRefManager PlayerList;
         PlayerList const& GetPlayers() const { return m_mapRefManager; }
 
@@ -577,6 +628,10 @@ class Map : public GridRefManager<NGridType>
         void setNGrid(NGridType* grid, uint32 x, uint32 y);
         void ScriptsProcess();
 
+        /// Queue the terrain of the grids players are heading to, see GridPrefetcher
+        void PrefetchGridsAhead(uint32 t_diff);
+        void RequestGridPrefetch(float p_X, float p_Y);
+
     protected:
 
         void SetUnloadReferenceLock(const GridCoord &p, bool on)
@@ -599,6 +654,9 @@ class Map : public GridRefManager<NGridType>
 
         int32 m_VisibilityNotifyPeriod;
 
+        uint32 m_LastUpdateDuration;
+        uint32 m_LastUpdateLoad;
+
         typedef std::set<WorldObject*> ActiveNonPlayers;
         ActiveNonPlayers m_activeNonPlayers;
         ActiveNonPlayers::iterator m_activeNonPlayersIter;
@@ -639,11 +697,19 @@ class Map : public GridRefManager<NGridType>
         GridMap* GridMaps[MAX_NUMBER_OF_GRIDS][MAX_NUMBER_OF_GRIDS];
         std::bitset<TOTAL_NUMBER_OF_CELLS_PER_MAP*TOTAL_NUMBER_OF_CELLS_PER_MAP> marked_cells;
 
+        UnitSpatialIndex m_UnitSpatialIndex;
+
+        uint32 m_GridPrefetchTimer;
+        std::unordered_map<uint64, Position> m_GridPrefetchPositions;     ///< Player positions at the previous prediction
+
         bool i_scriptLock;
         std::set<WorldObject*> i_objectsToRemove;
         std::map<WorldObject*, bool> i_objectsToSwitch;
         std::set<WorldObject*> i_worldObjects;
 
+        std::unordered_set<Object*> i_objectsToUpdate;
+        std::mutex m_ObjectsToUpdateLock;
+
         typedef std::multimap<time_t, ScriptAction> ScriptScheduleMap;
         ScriptScheduleMap m_scriptSchedule;
 
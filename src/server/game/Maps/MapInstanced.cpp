@@ -42,6 +42,7 @@ void MapInstanced::Update(const uint32 t)
 
     // update the instanced maps
     InstancedMaps::iterator i = m_InstancedMaps.begin();
+    std::vector<Map*> l_ScheduledMaps;
 
     while (i != m_InstancedMaps.end())
     {
@@ -56,12 +57,16 @@ void MapInstanced::Update(const uint32 t)
         {
             // update only here, because it may schedule some bad things before delete
             if (sMapMgr->GetMapUpdater()->activated())
-                sMapMgr->GetMapUpdater()->schedule_update(*i->second, t);
+                l_ScheduledMaps.push_back(i->second);
             else
                 i->second->Update(t);
             ++i;
         }
     }
+
+    std::sort(l_ScheduledMaps.begin(), l_ScheduledMaps.end(), Map::HasHigherUpdateCost);
+    for (Map* l_Map : l_ScheduledMaps)
+        sMapMgr->GetMapUpdater()->schedule_update(*l_Map, t);
 }
 
 void MapInstanced::DelayedUpdate(const uint32 diff)
@@ -24,6 +24,7 @@
 #include "WorldPacket.h"
 #include "Group.h"
 #include "Common.h"
+#include "GridPrefetcher.h"
 
 extern GridState* si_GridStates[];                          // debugging code, should be deleted some day
 
@@ -52,6 +53,9 @@ void MapManager::Initialize()
     // Start mtmaps if needed.
     if (num_threads > 0)
         m_updater.activate(num_threads);
+
+    if (sWorld->getBoolConfig(CONFIG_GRID_PREFETCH))
+        sGridPrefetcher->Start();
 }
 
 void MapManager::InitializeVisibilityDistanceInfo()
@@ -268,7 +272,7 @@ void MapManager::Update(uint32 diff)
 
     m_MapsDelay.clear();
 
-    /// - Start Achievement criteria update processing thread
+    /// - Start Achievement criteria update processing thread, before the maps which add new tasks while they run
     sAchievementMgr->PrepareCriteriaUpdateTaskThread();
 
     for (auto l_PlayerTask : sAchievementMgr->GetPlayersCriteriaTask())
@@ -284,24 +288,63 @@ void MapManager::Update(uint32 diff)
         }
     }
 
-    /// - Start map updater threads
+    /// - Start map updater threads, longest expected maps first (LPT), they would otherwise end the tick alone.
+    /// Instanced parents go before everything, their update is cheap but schedules the instances
+    std::vector<Map*> l_ScheduledMaps;
+    l_ScheduledMaps.reserve(i_maps.size());
+
     MapMapType::iterator iter = i_maps.begin();
     for (; iter != i_maps.end(); ++iter)
+        l_ScheduledMaps.push_back(iter->second);
+
+    std::sort(l_ScheduledMaps.begin(), l_ScheduledMaps.end(), [](Map const* p_Left, Map const* p_Right) -> bool
+    {
+        if (p_Left->Instanceable() != p_Right->Instanceable())
+            return p_Left->Instanceable();
+
+        return Map::HasHigherUpdateCost(p_Left, p_Right);
+    });
+
+    for (Map* l_Map : l_ScheduledMaps)
     {
         if (m_updater.activated())
-            m_updater.schedule_update(*iter->second, uint32(i_timer.GetCurrent()));
+            m_updater.schedule_update(*l_Map, uint32(i_timer.GetCurrent()));
         else
-            iter->second->Update(uint32(i_timer.GetCurrent()));
+            l_Map->Update(uint32(i_timer.GetCurrent()));
     }
 
     if (m_updater.activated())
         m_updater.wait();
 
+    /// - Report the slow maps, the durations are read once every worker is done
+    uint32 l_MinLoggedDiff = sWorld->getIntConfig(CONFIG_MIN_LOG_UPDATE);
+    auto l_ReportMap = [this, l_MinLoggedDiff](Map const* p_Map)
+    {
+        if (p_Map->GetLastUpdateDuration() <= l_MinLoggedDiff)
+            return;
+
+        RegisterMapDelay(p_Map->GetId(), p_Map->GetLastUpdateDuration());
+        sWorld->RecordTimeDiff(p_Map->GetLastUpdateDuration(), "Map %u (instance %u, %u players/active objects)", p_Map->GetId(), p_Map->GetInstanceId(), p_Map->GetLastUpdateLoad());
+    };
+
+    for (Map* l_Map : l_ScheduledMaps)
+    {
+        l_ReportMap(l_Map);
+
+        if (l_Map->Instanceable())
+        {
+            MapInstanced::InstancedMaps& l_Instances = ((MapInstanced*)l_Map)->GetInstancedMaps();
+            for (MapInstanced::InstancedMaps::const_iterator l_Itr = l_Instances.begin(); l_Itr != l_Instances.end(); ++l_Itr)
+                l_ReportMap(l_Itr->second);
+        }
+    }
+
     sAchievementMgr->ClearPlayersCriteriaTask();
 
     for (iter = i_maps.begin(); iter != i_maps.end(); ++iter)
         iter->second->DelayedUpdate(uint32(i_timer.GetCurrent()));
 
+    /// Objects which had no map when they changed, like items of players being teleported
     sObjectAccessor->Update(uint32(i_timer.GetCurrent()));
 
     std::queue<std::function<bool()>> l_Operations;
@@ -368,6 +411,8 @@ bool MapManager::IsValidMAP(uint32 mapid, bool startUp)
 
 void MapManager::UnloadAll()
 {
+    sGridPrefetcher->Stop();
+
     for (MapMapType::iterator iter = i_maps.begin(); iter != i_maps.end();)
     {
         iter->second->UnloadAll();
@@ -34,30 +34,58 @@ void MapUpdaterTask::UpdateFinished()
 //////////////////////////////////////////////////////////////////////////
 //////////////////////////////////////////////////////////////////////////
 
-class MapUpdateRequest : MapUpdaterTask
+/// Worker thread state, used to push nested tasks on the deque of the thread creating them
+static thread_local MapUpdater* t_CurrentUpdater = nullptr;
+static thread_local uint32 t_WorkerIndex = 0;
+
+class MapUpdateRequest : public MapUpdaterTask
 {
     private:
-        Map& m_map;
+        Map* m_map;
         uint32 m_diff;
 
     public:
         MapUpdateRequest(Map& m, MapUpdater& u, uint32 d)
-            : MapUpdaterTask(&u), m_map(m), m_diff(d)
+            : MapUpdaterTask(&u), m_map(&m), m_diff(d)
+        {
+        }
+
+        void Reset(Map& m, uint32 d)
         {
+            m_map = &m;
+            m_diff = d;
         }
 
         void call() override
         {
-            m_map.Update (m_diff);
+            m_map->Update (m_diff);
             UpdateFinished();
         }
+
+        void Release() override
+        {
+            std::lock_guard<std::mutex> l_Lock(m_updater->m_PoolLock);
+            m_updater->m_FreeMapRequests.push_back(this);
+        }
 };
 
+MapUpdater::~MapUpdater()
+{
+    for (MapUpdateRequest* l_Request : m_FreeMapRequests)
+        delete l_Request;
+
+    for (WorkerQueue* l_Queue : m_Queues)
+        delete l_Queue;
+}
+
 void MapUpdater::activate(size_t num_threads)
 {
+    for (size_t i = 0; i < num_threads; ++i)
+        m_Queues.push_back(new WorkerQueue());
+
     for (size_t i = 0; i < num_threads; ++i)
     {
-        _workerThreads.push_back(std::thread(&MapUpdater::WorkerThread, this));
+        _workerThreads.push_back(std::thread(&MapUpdater::WorkerThread, this, uint32(i)));
     }
 }
 
@@ -67,19 +95,31 @@ void MapUpdater::deactivate()
 
     wait();
 
-    _queue.Cancel();
+    {
+        std::lock_guard<std::mutex> l_Lock(m_SleepLock);
+        m_SleepCondition.notify_all();
+    }
 
     for (auto& thread : _workerThreads)
     {
         thread.join();
     }
+
+    /// Nothing is pending anymore, the queues only hold tasks pushed after the last wait()
+    for (WorkerQueue* l_Queue : m_Queues)
+    {
+        for (MapUpdaterTask* l_Task : l_Queue->Tasks)
+            l_Task->Release();
+
+        l_Queue->Tasks.clear();
+    }
 }
 
 void MapUpdater::wait()
 {
     std::unique_lock<std::mutex> lock(_lock);
 
-    while (pending_requests > 0)
+    while (m_PendingRequests.load() > 0)
         _condition.wait(lock);
 
     lock.unlock();
@@ -87,20 +127,28 @@ void MapUpdater::wait()
 
 void MapUpdater::schedule_update(Map& map, uint32 diff)
 {
-    std::lock_guard<std::mutex> lock(_lock);
+    MapUpdateRequest* l_Request = nullptr;
 
-    ++pending_requests;
+    {
+        std::lock_guard<std::mutex> l_Lock(m_PoolLock);
+        if (!m_FreeMapRequests.empty())
+        {
+            l_Request = m_FreeMapRequests.back();
+            m_FreeMapRequests.pop_back();
+        }
+    }
+
+    if (l_Request)
+        l_Request->Reset(map, diff);
+    else
+        l_Request = new MapUpdateRequest(map, *this, diff);
 
-    _queue.Push((MapUpdaterTask*)new MapUpdateRequest(map, *this, diff));
+    Push(l_Request);
 }
 
 void MapUpdater::schedule_specific(MapUpdaterTask* p_Request)
 {
-    std::lock_guard<std::mutex> lock(_lock);
-
-    ++pending_requests;
-
-    _queue.Push(p_Request);
+    Push(p_Request);
 }
 
 bool MapUpdater::activated()
@@ -108,28 +156,97 @@ bool MapUpdater::activated()
     return _workerThreads.size() > 0;
 }
 
-void MapUpdater::update_finished()
+void MapUpdater::Push(MapUpdaterTask* p_Task)
 {
-    std::lock_guard<std::mutex> lock(_lock);
+    /// Counted before being visible, a worker popping it can't make the counters go below zero
+    ++m_PendingRequests;
+    ++m_QueuedTasks;
 
-    --pending_requests;
+    /// Workers keep their nested tasks (instances of a MapInstanced) local, other threads spread them
+    uint32 l_QueueIndex = t_CurrentUpdater == this ? t_WorkerIndex : (m_NextQueue++ % m_Queues.size());
 
-    _condition.notify_all();
+    {
+        std::lock_guard<std::mutex> l_Lock(m_Queues[l_QueueIndex]->Lock);
+        m_Queues[l_QueueIndex]->Tasks.push_back(p_Task);
+    }
+
+    if (m_SleepingWorkers.load() > 0)
+    {
+        std::lock_guard<std::mutex> l_Lock(m_SleepLock);
+        m_SleepCondition.notify_one();
+    }
 }
 
-void MapUpdater::WorkerThread()
+MapUpdaterTask* MapUpdater::Pop(uint32 p_WorkerIndex)
 {
-    while (1)
+    /// Own deque first, in scheduling order since maps are dispatched longest first
     {
-        MapUpdaterTask* request = nullptr;
+        WorkerQueue* l_Queue = m_Queues[p_WorkerIndex];
+        std::lock_guard<std::mutex> l_Lock(l_Queue->Lock);
+        if (!l_Queue->Tasks.empty())
+        {
+            MapUpdaterTask* l_Task = l_Queue->Tasks.front();
+            l_Queue->Tasks.pop_front();
+            return l_Task;
+        }
+    }
 
-        _queue.WaitAndPop(request);
+    /// Then steal the oldest task of another worker
+    for (size_t l_I = 1; l_I < m_Queues.size(); ++l_I)
+    {
+        WorkerQueue* l_Queue = m_Queues[(p_WorkerIndex + l_I) % m_Queues.size()];
+        std::unique_lock<std::mutex> l_Lock(l_Queue->Lock, std::try_to_lock);
+        if (!l_Lock.owns_lock() || l_Queue->Tasks.empty())
+            continue;
+
+        MapUpdaterTask* l_Task = l_Queue->Tasks.front();
+        l_Queue->Tasks.pop_front();
+        return l_Task;
+    }
 
+    return nullptr;
+}
+
+void MapUpdater::update_finished()
+{
+    if (--m_PendingRequests != 0)
+        return;
+
+    std::lock_guard<std::mutex> lock(_lock);
+    _condition.notify_all();
+}
+
+void MapUpdater::WorkerThread(uint32 p_WorkerIndex)
+{
+    t_CurrentUpdater = this;
+    t_WorkerIndex = p_WorkerIndex;
+
+    while (1)
+    {
         if (_cancelationToken)
             return;
 
+        MapUpdaterTask* request = m_QueuedTasks.load() > 0 ? Pop(p_WorkerIndex) : nullptr;
+        if (!request)
+        {
+            /// A queued task may sit behind a deque locked by a thief, just retry
+            if (m_QueuedTasks.load() > 0)
+            {
+                std::this_thread::yield();
+                continue;
+            }
+
+            std::unique_lock<std::mutex> l_Lock(m_SleepLock);
+            ++m_SleepingWorkers;
+            m_SleepCondition.wait(l_Lock, [this]() -> bool { return m_QueuedTasks.load() > 0 || _cancelationToken; });
+            --m_SleepingWorkers;
+            continue;
+        }
+
+        --m_QueuedTasks;
+
         request->call();
 
-        delete request;
+        request->Release();
     }
 }
@@ -11,8 +11,12 @@
 
 #include "Define.h"
 #include "Common.h"
+#include <atomic>
 #include <condition_variable>
-#include "ProducerConsumerQueue.h"
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 class MapUpdater;
 
@@ -21,27 +25,34 @@ class MapUpdaterTask
     public:
         /// Constructor
         MapUpdaterTask(MapUpdater* p_Updater);
+        virtual ~MapUpdaterTask() { }
 
         virtual void call() = 0;
 
+        /// Called by the worker once the task has run, pooled tasks go back to their pool
+        virtual void Release() { delete this; }
+
         /// Notify that the task is done
         void UpdateFinished();
 
-    private:
+    protected:
         MapUpdater* m_updater;
 
 };
 
 class Map;
+class MapUpdateRequest;
 
+/// Work stealing scheduler, every worker owns a deque and takes from the others when its own is empty
 class MapUpdater
 {
     public:
 
-        MapUpdater() : _cancelationToken(false), pending_requests(0) {}
-        ~MapUpdater() { };
+        MapUpdater() : _cancelationToken(false), m_PendingRequests(0), m_QueuedTasks(0), m_SleepingWorkers(0), m_NextQueue(0) {}
+        ~MapUpdater();
 
         friend class MapUpdaterTask;
+        friend class MapUpdateRequest;
 
         void schedule_update(Map& map, uint32 diff);
         void schedule_specific(MapUpdaterTask* p_Request);
@@ -56,18 +67,40 @@ class MapUpdater
 
     private:
 
-        ProducerConsumerQueue<MapUpdaterTask*> _queue;
+        struct WorkerQueue
+        {
+            std::mutex Lock;
+            std::deque<MapUpdaterTask*> Tasks;
+        };
 
         std::vector<std::thread> _workerThreads;
+        std::vector<WorkerQueue*> m_Queues;
         std::atomic<bool> _cancelationToken;
 
+        /// Completion latch, wait() only gets notified when it reaches 0
+        std::atomic<size_t> m_PendingRequests;
         std::mutex _lock;
         std::condition_variable _condition;
-        size_t pending_requests;
+
+        /// Idle workers sleep until a task is pushed
+        std::atomic<int32> m_QueuedTasks;
+        std::atomic<uint32> m_SleepingWorkers;
+        std::mutex m_SleepLock;
+        std::condition_variable m_SleepCondition;
+
+        /// Queue receiving the next task pushed from a thread that isn't a worker
+        std::atomic<uint32> m_NextQueue;
+
+        /// Recycled update requests, they are scheduled every tick for every map
+        std::mutex m_PoolLock;
+        std::vector<MapUpdateRequest*> m_FreeMapRequests;
+
+        void Push(MapUpdaterTask* p_Task);
+        MapUpdaterTask* Pop(uint32 p_WorkerIndex);
 
         void update_finished();
 
-        void WorkerThread();
+        void WorkerThread(uint32 p_WorkerIndex);
 };
 
 #endif //_MAP_UPDATER_H_INCLUDED
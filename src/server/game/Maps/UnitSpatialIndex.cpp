@@ -0,0 +1,122 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Project-Hellscream https://hellscream.org
+// Copyright (C) 2018-2020 Project-Hellscream-6.2
+// Discord https://discord.gg/CWCF3C9
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include "UnitSpatialIndex.h"
+#include "Unit.h"
+
+UnitSpatialIndex::UnitSpatialIndex() : m_MaxReach(0.0f)
+{
+    for (uint32 l_I = 0; l_I < MAX_NUMBER_OF_GRIDS * MAX_NUMBER_OF_GRIDS; ++l_I)
+        m_Grids[l_I] = nullptr;
+
+#ifdef TRINITY_DEBUG
+    m_Writing = false;
+#endif
+}
+
+UnitSpatialIndex::~UnitSpatialIndex()
+{
+    for (uint32 l_I = 0; l_I < MAX_NUMBER_OF_GRIDS * MAX_NUMBER_OF_GRIDS; ++l_I)
+        delete[] m_Grids[l_I];
+}
+
+SpatialCell* UnitSpatialIndex::GetCell(float p_X, float p_Y)
+{
+    uint32 l_CellX = ComputeCell(p_X, 0.0f);
+    uint32 l_CellY = ComputeCell(p_Y, 0.0f);
+
+    if (SpatialCell* l_Cell = FindCell(l_CellX, l_CellY))
+        return l_Cell;
+
+    m_Grids[(l_CellX / MAX_NUMBER_OF_CELLS) * MAX_NUMBER_OF_GRIDS + l_CellY / MAX_NUMBER_OF_CELLS] = new SpatialCell[MAX_NUMBER_OF_CELLS * MAX_NUMBER_OF_CELLS];
+    return FindCell(l_CellX, l_CellY);
+}
+
+void UnitSpatialIndex::Insert(Unit* p_Unit)
+{
+    if (p_Unit->m_SpatialCell)
+        return;
+
+#ifdef TRINITY_DEBUG
+    WriteCheck l_Check(*this);
+#endif
+
+    SpatialCell* l_Cell = GetCell(p_Unit->GetPositionX(), p_Unit->GetPositionY());
+    float l_Reach = p_Unit->GetCombatReach();
+
+    p_Unit->m_SpatialCell = l_Cell;
+    p_Unit->m_SpatialSlot = l_Cell->Units.size();
+
+    l_Cell->X.push_back(p_Unit->GetPositionX());
+    l_Cell->Y.push_back(p_Unit->GetPositionY());
+    l_Cell->Reach.push_back(l_Reach);
+    l_Cell->Units.push_back(p_Unit);
+
+    m_MaxReach = std::max(m_MaxReach, l_Reach);
+}
+
+void UnitSpatialIndex::Remove(Unit* p_Unit)
+{
+    SpatialCell* l_Cell = p_Unit->m_SpatialCell;
+    if (!l_Cell)
+        return;
+
+#ifdef TRINITY_DEBUG
+    WriteCheck l_Check(*this);
+#endif
+
+    uint32 l_Slot = p_Unit->m_SpatialSlot;
+    uint32 l_Last = l_Cell->Units.size() - 1;
+
+    /// The last unit of the cell takes the freed slot
+    if (l_Slot != l_Last)
+    {
+        l_Cell->X[l_Slot]     = l_Cell->X[l_Last];
+        l_Cell->Y[l_Slot]     = l_Cell->Y[l_Last];
+        l_Cell->Reach[l_Slot] = l_Cell->Reach[l_Last];
+        l_Cell->Units[l_Slot] = l_Cell->Units[l_Last];
+        l_Cell->Units[l_Slot]->m_SpatialSlot = l_Slot;
+    }
+
+    l_Cell->X.pop_back();
+    l_Cell->Y.pop_back();
+    l_Cell->Reach.pop_back();
+    l_Cell->Units.pop_back();
+
+    p_Unit->m_SpatialCell = nullptr;
+    p_Unit->m_SpatialSlot = 0;
+}
+
+void UnitSpatialIndex::Relocate(Unit* p_Unit)
+{
+    SpatialCell* l_Cell = GetCell(p_Unit->GetPositionX(), p_Unit->GetPositionY());
+    if (l_Cell != p_Unit->m_SpatialCell)
+    {
+        Remove(p_Unit);
+        Insert(p_Unit);
+        return;
+    }
+
+#ifdef TRINITY_DEBUG
+    WriteCheck l_Check(*this);
+#endif
+
+    l_Cell->X[p_Unit->m_SpatialSlot] = p_Unit->GetPositionX();
+    l_Cell->Y[p_Unit->m_SpatialSlot] = p_Unit->GetPositionY();
+}
+
+void UnitSpatialIndex::UpdateReach(Unit* p_Unit)
+{
+    SpatialCell* l_Cell = p_Unit->m_SpatialCell;
+    if (!l_Cell)
+        return;
+
+    /// Simplest way to also raise m_MaxReach
+    Remove(p_Unit);
+    Insert(p_Unit);
+}
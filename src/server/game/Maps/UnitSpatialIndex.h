@@ -0,0 +1,161 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Project-Hellscream https://hellscream.org
+// Copyright (C) 2018-2020 Project-Hellscream-6.2
+// Discord https://discord.gg/CWCF3C9
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _UNIT_SPATIAL_INDEX_H
+#define _UNIT_SPATIAL_INDEX_H
+
+#include "Common.h"
+#include "GridDefines.h"
+#include "Errors.h"
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+# include <xmmintrin.h>
+# define UNIT_SPATIAL_INDEX_SSE
+#endif
+
+class Unit;
+
+/// Units of one cell, stored as parallel arrays so the distance test of a search only reads floats
+struct SpatialCell
+{
+    std::vector<float> X;
+    std::vector<float> Y;
+    std::vector<float> Reach;                                       ///< Combat reach, the object size of the range checks
+    std::vector<Unit*> Units;
+};
+
+/// Copy of the position of every unit in world of a map, bucketed by grid cell.
+/// Kept in sync by Unit::AddToWorld/RemoveFromWorld, WorldObject::Relocate and Unit::SetCombatReach, range searches
+/// use it as a 2D prefilter and run their usual checks only on the units close enough, without walking the grid
+/// reference lists. A unit is in the cell of its current coordinates, not in the one of its grid reference which
+/// is only moved on the next relocation pass.
+/// Not thread safe: like the grids, the index is only read and written by the thread updating its map, the cells
+/// are plain vectors that a write may reallocate under a concurrent search.
+class UnitSpatialIndex
+{
+    public:
+        UnitSpatialIndex();
+        ~UnitSpatialIndex();
+
+        void Insert(Unit* p_Unit);
+        void Remove(Unit* p_Unit);
+        void Relocate(Unit* p_Unit);
+        void UpdateReach(Unit* p_Unit);
+
+        /// Calls p_Function for every unit whose 2D distance to (p_X, p_Y) is at most p_Radius plus its combat reach,
+        /// in no particular order. p_Function must not add, remove or move units of this map.
+        template<class Function> void Visit(float p_X, float p_Y, float p_Radius, Function p_Function) const;
+
+    private:
+        SpatialCell* GetCell(float p_X, float p_Y);
+        SpatialCell* FindCell(uint32 p_CellX, uint32 p_CellY) const;
+
+        static uint32 ComputeCell(float p_Position, float p_Offset);
+        template<class Function> static void VisitCell(SpatialCell const& p_Cell, float p_X, float p_Y, float p_Radius, Function& p_Function);
+
+        /// Cells of a grid are allocated together the first time a unit enters the grid
+        SpatialCell* m_Grids[MAX_NUMBER_OF_GRIDS * MAX_NUMBER_OF_GRIDS];
+        float m_MaxReach;                                           ///< Largest reach ever indexed, widens the searched cells
+
+#ifdef TRINITY_DEBUG
+        /// Catches a write racing another write or a search, the index has no lock
+        struct WriteCheck
+        {
+            explicit WriteCheck(UnitSpatialIndex& p_Index) : m_Index(p_Index) { ASSERT(m_Index.m_Writing.exchange(true) == false); }
+            ~WriteCheck() { m_Index.m_Writing = false; }
+
+            UnitSpatialIndex& m_Index;
+        };
+
+        std::atomic<bool> m_Writing;
+#endif
+};
+
+inline uint32 UnitSpatialIndex::ComputeCell(float p_Position, float p_Offset)
+{
+    /// Same rounding as JadeCore::ComputeCellCoord, clamped on both sides
+    double l_Offset = (double(p_Position + p_Offset) - CENTER_GRID_CELL_OFFSET) / SIZE_OF_GRID_CELL;
+    int32 l_Cell = int32(l_Offset + CENTER_GRID_CELL_ID + 0.5f);
+    return uint32(std::min<int32>(std::max<int32>(l_Cell, 0), TOTAL_NUMBER_OF_CELLS_PER_MAP - 1));
+}
+
+inline SpatialCell* UnitSpatialIndex::FindCell(uint32 p_CellX, uint32 p_CellY) const
+{
+    SpatialCell* l_Grid = m_Grids[(p_CellX / MAX_NUMBER_OF_CELLS) * MAX_NUMBER_OF_GRIDS + p_CellY / MAX_NUMBER_OF_CELLS];
+    if (!l_Grid)
+        return nullptr;
+
+    return &l_Grid[(p_CellX % MAX_NUMBER_OF_CELLS) * MAX_NUMBER_OF_CELLS + p_CellY % MAX_NUMBER_OF_CELLS];
+}
+
+template<class Function>
+inline void UnitSpatialIndex::VisitCell(SpatialCell const& p_Cell, float p_X, float p_Y, float p_Radius, Function& p_Function)
+{
+    uint32 l_Count = p_Cell.Units.size();
+    uint32 l_I = 0;
+
+#ifdef UNIT_SPATIAL_INDEX_SSE
+    __m128 l_X      = _mm_set1_ps(p_X);
+    __m128 l_Y      = _mm_set1_ps(p_Y);
+    __m128 l_Radius = _mm_set1_ps(p_Radius);
+
+    for (; l_I + 4 <= l_Count; l_I += 4)
+    {
+        __m128 l_DX    = _mm_sub_ps(_mm_loadu_ps(&p_Cell.X[l_I]), l_X);
+        __m128 l_DY    = _mm_sub_ps(_mm_loadu_ps(&p_Cell.Y[l_I]), l_Y);
+        __m128 l_Range = _mm_add_ps(_mm_loadu_ps(&p_Cell.Reach[l_I]), l_Radius);
+        __m128 l_Dist  = _mm_add_ps(_mm_mul_ps(l_DX, l_DX), _mm_mul_ps(l_DY, l_DY));
+
+        int l_Mask = _mm_movemask_ps(_mm_cmple_ps(l_Dist, _mm_mul_ps(l_Range, l_Range)));
+        for (uint32 l_J = 0; l_Mask; ++l_J, l_Mask >>= 1)
+        {
+            if (l_Mask & 1)
+                p_Function(p_Cell.Units[l_I + l_J]);
+        }
+    }
+#endif
+
+    for (; l_I < l_Count; ++l_I)
+    {
+        float l_DX    = p_Cell.X[l_I] - p_X;
+        float l_DY    = p_Cell.Y[l_I] - p_Y;
+        float l_Range = p_Cell.Reach[l_I] + p_Radius;
+
+        if (l_DX * l_DX + l_DY * l_DY <= l_Range * l_Range)
+            p_Function(p_Cell.Units[l_I]);
+    }
+}
+
+template<class Function>
+inline void UnitSpatialIndex::Visit(float p_X, float p_Y, float p_Radius, Function p_Function) const
+{
+    /// Same limit as Cell::Visit
+    p_Radius = std::min<float>(std::max<float>(p_Radius, 0.0f), SIZE_OF_GRIDS);
+
+#ifdef TRINITY_DEBUG
+    ASSERT(!m_Writing);
+#endif
+
+    float l_Extent = p_Radius + m_MaxReach;
+
+    uint32 l_LowX  = ComputeCell(p_X, -l_Extent);
+    uint32 l_HighX = ComputeCell(p_X, l_Extent);
+    uint32 l_LowY  = ComputeCell(p_Y, -l_Extent);
+    uint32 l_HighY = ComputeCell(p_Y, l_Extent);
+
+    for (uint32 l_CellX = l_LowX; l_CellX <= l_HighX; ++l_CellX)
+    {
+        for (uint32 l_CellY = l_LowY; l_CellY <= l_HighY; ++l_CellY)
+        {
+            if (SpatialCell const* l_Cell = FindCell(l_CellX, l_CellY))
+                VisitCell(*l_Cell, p_X, p_Y, p_Radius, p_Function);
+        }
+    }
+}
+
+#endif
@@ -11,6 +11,9 @@
 
 #include "InterfaceBase.hpp"
 
+/// Opcode value registering a packet hook for every opcode
+#define PACKET_HOOK_ALL_OPCODES MAX_OPCODE
+
 /// Server script interface
 class ServerScript : public ScriptObjectImpl<false>
 {
@@ -19,6 +22,13 @@ class ServerScript : public ScriptObjectImpl<false>
         /// @p_Name : Script Name
         ServerScript(const char * p_Name);
 
+        /// OnPacketReceive is only called for the opcodes registered here, to be called from the constructor
+        /// @p_Opcode : Client opcode, PACKET_HOOK_ALL_OPCODES for every opcode
+        void RegisterPacketReceiveHook(uint32 p_Opcode);
+        /// OnPacketSend is only called for the opcodes registered here, to be called from the constructor
+        /// @p_Opcode : Server opcode, PACKET_HOOK_ALL_OPCODES for every opcode
+        void RegisterPacketSendHook(uint32 p_Opcode);
+
     public:
         /// Called when reactive socket I/O is started (WorldSocketMgr).
         virtual void OnNetworkStart()
@@ -46,20 +56,21 @@ class ServerScript : public ScriptObjectImpl<false>
             UNUSED(p_WasNew);
         }
 
-        /// Called when a packet is sent to a client. The packet object is a copy of the original packet, so reading and modifying it is safe.
+        /// Called when a packet registered with RegisterPacketSendHook is sent to a client. The packet is the original one, read it with read(pos).
         /// @p_Socket : Socket who send the packet
         /// @p_Packet : Sent packet
-        virtual void OnPacketSend(WorldSocket * p_Socket, WorldPacket & p_Packet)
+        virtual void OnPacketSend(WorldSocket * p_Socket, WorldPacket const& p_Packet)
         {
             UNUSED(p_Socket);
             UNUSED(p_Packet);
         }
 
-        /// Called when a (valid) packet is received by a client. The packet object is a copy of the original packet, so reading and modifying it is safe.
+        /// Called when a (valid) packet registered with RegisterPacketReceiveHook is received by a client, before its handler.
+        /// The packet is the original one, read it with read(pos).
         /// @p_Socket  : Socket who received the packet
         /// @p_Packet  : Received packet
         /// @p_Session : Session who received the packet /!\ CAN BE NULLPTR
-        virtual void OnPacketReceive(WorldSocket* p_Socket, WorldPacket& p_Packet, WorldSession* p_Session)
+        virtual void OnPacketReceive(WorldSocket* p_Socket, WorldPacket const& p_Packet, WorldSession* p_Session)
         {
             UNUSED(p_Socket);
             UNUSED(p_Packet);
@@ -283,6 +283,8 @@ void ScriptMgr::Unload()
 {
     /// Clear scripts for every script type.
     ScriptRegistry<SpellScriptLoader>::Clear();
+    m_PacketReceiveHooks.Clear();
+    m_PacketSendHooks.Clear();
     ScriptRegistry<ServerScript>::Clear();
     ScriptRegistry<WorldScript>::Clear();
     ScriptRegistry<FormulaScript>::Clear();
@@ -1405,24 +1407,90 @@ void ScriptMgr::OnSocketClose(WorldSocket* p_Socket, bool p_WasNew)
     FOREACH_SCRIPT(ServerScript)->OnSocketClose(p_Socket, p_WasNew);
 }
 
-/// Called when a packet is sent to a client. The packet object is a copy of the original packet, so reading and modifying it is safe.
+/// Called when a (valid) packet is received by a client, only the scripts registered for its opcode are called.
+/// @p_Socket  : Socket who received the packet
+/// @p_Packet  : Received packet
+/// @p_Session : Session who receive the packet /!\ CAN BE NULLPTR
+void ScriptMgr::OnPacketReceive(WorldSocket* p_Socket, WorldPacket const& p_Packet, WorldSession* p_Session)
+{
+    ASSERT(p_Socket);
+
+    uint32 l_Opcode = p_Packet.GetOpcode();
+    if (!m_PacketReceiveHooks.HasHooks(l_Opcode))
+        return;
+
+    for (ServerScript* l_Script : m_PacketReceiveHooks.AllOpcodesScripts)
+        l_Script->OnPacketReceive(p_Socket, p_Packet, p_Session);
+
+    auto l_Itr = m_PacketReceiveHooks.Scripts.find(l_Opcode);
+    if (l_Itr == m_PacketReceiveHooks.Scripts.end())
+        return;
+
+    for (ServerScript* l_Script : l_Itr->second)
+        l_Script->OnPacketReceive(p_Socket, p_Packet, p_Session);
+}
+
+/// Called when a packet is sent to a client, only the scripts registered for its opcode are called.
 /// @p_Socket : Socket who send the packet
 /// @p_Packet : Sent packet
-void ScriptMgr::OnPacketReceive(WorldSocket* p_Socket, WorldPacket p_Packet, WorldSession* p_Session)
+void ScriptMgr::OnPacketSend(WorldSocket* p_Socket, WorldPacket const& p_Packet)
 {
     ASSERT(p_Socket);
 
-    FOREACH_SCRIPT(ServerScript)->OnPacketReceive(p_Socket, p_Packet, p_Session);
+    uint32 l_Opcode = p_Packet.GetOpcode();
+    if (!m_PacketSendHooks.HasHooks(l_Opcode))
+        return;
+
+    for (ServerScript* l_Script : m_PacketSendHooks.AllOpcodesScripts)
+        l_Script->OnPacketSend(p_Socket, p_Packet);
+
+    auto l_Itr = m_PacketSendHooks.Scripts.find(l_Opcode);
+    if (l_Itr == m_PacketSendHooks.Scripts.end())
+        return;
+
+    for (ServerScript* l_Script : l_Itr->second)
+        l_Script->OnPacketSend(p_Socket, p_Packet);
 }
 
-/// Called when a (valid) packet is received by a client. The packet object is a copy of the original packet, so reading and modifying it is safe.
-/// @p_Socket : Socket who received the packet
-/// @p_Packet : Received packet
-void ScriptMgr::OnPacketSend(WorldSocket* p_Socket, WorldPacket p_Packet)
+/// Registers a server script for OnPacketReceive of an opcode
+/// @p_Script : Listening script
+/// @p_Opcode : Opcode, PACKET_HOOK_ALL_OPCODES for every opcode
+void ScriptMgr::RegisterPacketReceiveHook(ServerScript* p_Script, uint32 p_Opcode)
 {
-    ASSERT(p_Socket);
+    m_PacketReceiveHooks.Register(p_Script, p_Opcode);
+}
+
+/// Registers a server script for OnPacketSend of an opcode
+/// @p_Script : Listening script
+/// @p_Opcode : Opcode, PACKET_HOOK_ALL_OPCODES for every opcode
+void ScriptMgr::RegisterPacketSendHook(ServerScript* p_Script, uint32 p_Opcode)
+{
+    m_PacketSendHooks.Register(p_Script, p_Opcode);
+}
+
+void ScriptMgr::PacketHookRegistry::Register(ServerScript* p_Script, uint32 p_Opcode)
+{
+    if (p_Opcode == PACKET_HOOK_ALL_OPCODES)
+    {
+        AllOpcodesScripts.push_back(p_Script);
+        return;
+    }
+
+    if (p_Opcode >= NUM_OPCODE_HANDLERS)
+    {
+        sLog->outError(LOG_FILTER_TSCR, "Script '%s' registered a packet hook for invalid opcode %u.", p_Script->GetName().c_str(), p_Opcode);
+        return;
+    }
 
-    FOREACH_SCRIPT(ServerScript)->OnPacketSend(p_Socket, p_Packet);
+    Opcodes.set(p_Opcode);
+    Scripts[p_Opcode].push_back(p_Script);
+}
+
+void ScriptMgr::PacketHookRegistry::Clear()
+{
+    Opcodes.reset();
+    Scripts.clear();
+    AllOpcodesScripts.clear();
 }
 
 /// Called when an invalid (unknown opcode) packet is received by a client. The packet is a reference to the original packet; not a copy.
@@ -2547,6 +2615,20 @@ ServerScript::ServerScript(const char* p_Name)
     ScriptRegistry<ServerScript>::AddScript(this);
 }
 
+/// OnPacketReceive is only called for the opcodes registered here
+/// @p_Opcode : Client opcode, PACKET_HOOK_ALL_OPCODES for every opcode
+void ServerScript::RegisterPacketReceiveHook(uint32 p_Opcode)
+{
+    sScriptMgr->RegisterPacketReceiveHook(this, p_Opcode);
+}
+
+/// OnPacketSend is only called for the opcodes registered here
+/// @p_Opcode : Server opcode, PACKET_HOOK_ALL_OPCODES for every opcode
+void ServerScript::RegisterPacketSendHook(uint32 p_Opcode)
+{
+    sScriptMgr->RegisterPacketSendHook(this, p_Opcode);
+}
+
 /// Constructor
 /// @p_Name : Script Name
 WorldScript::WorldScript(const char* p_Name)
@@ -13,6 +13,7 @@
 #include "DBCStores.h"
 #include "Interfaces/Interfaces.hpp"
 #include "MutexedMap.hpp"
+#include <bitset>
 
 /// Placed here due to ScriptRegistry::AddScript dependency.
 #define sScriptMgr ACE_Singleton<ScriptMgr, ACE_Null_Mutex>::instance()
@@ -438,16 +439,22 @@ class ScriptMgr
         /// @p_WasNew : Was new ?
         void OnSocketClose(WorldSocket* p_Socket, bool p_WasNew);
 
-        /// Called when a packet is sent to a client. The packet object is a copy of the original packet, so reading and modifying it is safe.
-        /// @p_Socket  : Socket who send the packet
-        /// @p_Packet  : Sent packet
+        /// Called when a (valid) packet is received by a client, only the scripts registered for its opcode are called.
+        /// @p_Socket  : Socket who received the packet
+        /// @p_Packet  : Received packet
         /// @p_Session : Session who receive the packet /!\ CAN BE NULLPTR
-        void OnPacketReceive(WorldSocket* p_Socket, WorldPacket p_Packet, WorldSession* p_Session = nullptr);
-
-        /// Called when a (valid) packet is received by a client. The packet object is a copy of the original packet, so reading and modifying it is safe.
-        /// @p_Socket : Socket who received the packet
-        /// @p_Packet : Received packet
-        void OnPacketSend(WorldSocket* p_Socket, WorldPacket p_Packet);
+        void OnPacketReceive(WorldSocket* p_Socket, WorldPacket const& p_Packet, WorldSession* p_Session = nullptr);
+
+        /// Called when a packet is sent to a client, only the scripts registered for its opcode are called.
+        /// @p_Socket : Socket who send the packet
+        /// @p_Packet : Sent packet
+        void OnPacketSend(WorldSocket* p_Socket, WorldPacket const& p_Packet);
+
+        /// Registers a server script for OnPacketReceive / OnPacketSend of an opcode
+        /// @p_Script : Listening script
+        /// @p_Opcode : Opcode, PACKET_HOOK_ALL_OPCODES for every opcode
+        void RegisterPacketReceiveHook(ServerScript* p_Script, uint32 p_Opcode);
+        void RegisterPacketSendHook(ServerScript* p_Script, uint32 p_Opcode);
         /// Called when an invalid (unknown opcode) packet is received by a client. The packet is a reference to the original packet; not a copy.
         /// This allows you to actually handle unknown packets (for whatever purpose).
         /// @p_Socket : Socket who received the packet
@@ -1023,6 +1030,26 @@ class ScriptMgr
         void OnEncounterEnd(EncounterDatas const* p_EncounterDatas);
 
     private:
+        /// Server scripts listening to the packets of an opcode. Filled while loading the scripts, only read
+        /// afterwards, the network threads included
+        struct PacketHookRegistry
+        {
+            std::bitset<NUM_OPCODE_HANDLERS> Opcodes;
+            std::unordered_map<uint32, std::vector<ServerScript*>> Scripts;
+            std::vector<ServerScript*> AllOpcodesScripts;
+
+            void Register(ServerScript* p_Script, uint32 p_Opcode);
+            void Clear();
+
+            bool HasHooks(uint32 p_Opcode) const
+            {
+                return !AllOpcodesScripts.empty() || (p_Opcode < NUM_OPCODE_HANDLERS && Opcodes.test(p_Opcode));
+            }
+        };
+
+        PacketHookRegistry m_PacketReceiveHooks;
+        PacketHookRegistry m_PacketSendHooks;
+
         /// Registered script count
         uint32 m_ScriptCount;
         /// Atomic op counter for active scripts amount
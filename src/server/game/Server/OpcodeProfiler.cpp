@@ -0,0 +1,189 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Project-Hellscream https://hellscream.org
+// Copyright (C) 2018-2020 Project-Hellscream-6.2
+// Discord https://discord.gg/CWCF3C9
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include "OpcodeProfiler.h"
+#include "Log.h"
+#include "Util.h"
+
+void OpcodeProfiler::SetEnabled(bool p_Enabled)
+{
+    /// Allocated once and never freed, threads which saw the profiler enabled may still be writing
+    if (p_Enabled && !m_Handlers)
+    {
+        m_Handlers.reset(new HandlerStats[NUM_OPCODE_HANDLERS]());
+        m_Sends.reset(new SendStats[NUM_OPCODE_HANDLERS]());
+    }
+
+    /// Publishes the tables to the threads which see the profiler enabled
+    m_Enabled.store(p_Enabled, std::memory_order_release);
+}
+
+void OpcodeProfiler::Reset()
+{
+    if (!m_Handlers)
+        return;
+
+    for (uint32 l_I = 0; l_I < NUM_OPCODE_HANDLERS; ++l_I)
+    {
+        HandlerStats& l_Handler = m_Handlers[l_I];
+        l_Handler.Count     = 0;
+        l_Handler.TotalTime = 0;
+        l_Handler.Bytes     = 0;
+        l_Handler.MaxTime   = 0;
+
+        for (uint32 l_Bucket = 0; l_Bucket < OPCODE_PROFILER_TIME_BUCKETS; ++l_Bucket)
+            l_Handler.TimeBuckets[l_Bucket] = 0;
+
+        SendStats& l_Send = m_Sends[l_I];
+        l_Send.Count    = 0;
+        l_Send.Bytes    = 0;
+        l_Send.MaxBytes = 0;
+    }
+}
+
+void OpcodeProfiler::UpdateMax(std::atomic<uint32>& p_Max, uint32 p_Value)
+{
+    uint32 l_Max = p_Max.load(std::memory_order_relaxed);
+    while (p_Value > l_Max && !p_Max.compare_exchange_weak(l_Max, p_Value, std::memory_order_relaxed))
+        ;
+}
+
+void OpcodeProfiler::RecordHandler(uint32 p_Opcode, size_t p_Size, uint64 p_Time)
+{
+    if (p_Opcode >= NUM_OPCODE_HANDLERS || !IsEnabled())
+        return;
+
+    HandlerStats& l_Stats = m_Handlers[p_Opcode];
+    l_Stats.Count.fetch_add(1, std::memory_order_relaxed);
+    l_Stats.TotalTime.fetch_add(p_Time, std::memory_order_relaxed);
+    l_Stats.Bytes.fetch_add(p_Size, std::memory_order_relaxed);
+
+    uint32 l_Time = uint32(std::min<uint64>(p_Time, 0xFFFFFFFF));
+    UpdateMax(l_Stats.MaxTime, l_Time);
+
+    /// Bucket N holds the times below 2^N microseconds
+    uint32 l_Bucket = 0;
+    while (l_Time && l_Bucket < OPCODE_PROFILER_TIME_BUCKETS - 1)
+    {
+        l_Time >>= 1;
+        ++l_Bucket;
+    }
+
+    l_Stats.TimeBuckets[l_Bucket].fetch_add(1, std::memory_order_relaxed);
+}
+
+void OpcodeProfiler::RecordSend(uint32 p_Opcode, size_t p_Size)
+{
+    if (p_Opcode >= NUM_OPCODE_HANDLERS || !IsEnabled())
+        return;
+
+    SendStats& l_Stats = m_Sends[p_Opcode];
+    l_Stats.Count.fetch_add(1, std::memory_order_relaxed);
+    l_Stats.Bytes.fetch_add(p_Size, std::memory_order_relaxed);
+    UpdateMax(l_Stats.MaxBytes, uint32(p_Size));
+}
+
+uint32 OpcodeProfiler::GetPercentile99(HandlerStats const& p_Stats)
+{
+    uint64 l_Total = 0;
+    for (uint32 l_Bucket = 0; l_Bucket < OPCODE_PROFILER_TIME_BUCKETS; ++l_Bucket)
+        l_Total += p_Stats.TimeBuckets[l_Bucket].load(std::memory_order_relaxed);
+
+    if (!l_Total)
+        return 0;
+
+    uint64 l_Threshold = l_Total - l_Total / 100;
+    uint64 l_Count = 0;
+
+    for (uint32 l_Bucket = 0; l_Bucket < OPCODE_PROFILER_TIME_BUCKETS - 1; ++l_Bucket)
+    {
+        l_Count += p_Stats.TimeBuckets[l_Bucket].load(std::memory_order_relaxed);
+        if (l_Count >= l_Threshold)
+            return std::min<uint32>(1 << l_Bucket, p_Stats.MaxTime.load(std::memory_order_relaxed));
+    }
+
+    return p_Stats.MaxTime.load(std::memory_order_relaxed);
+}
+
+void OpcodeProfiler::BuildReport(std::vector<std::string>& p_Lines, uint32 p_Limit) const
+{
+    if (!m_Handlers)
+    {
+        p_Lines.push_back("Opcode profiler was never enabled.");
+        return;
+    }
+
+    std::vector<std::pair<uint64, uint32>> l_Handlers;
+    std::vector<std::pair<uint64, uint32>> l_Sends;
+
+    for (uint32 l_I = 0; l_I < NUM_OPCODE_HANDLERS; ++l_I)
+    {
+        if (uint64 l_Time = m_Handlers[l_I].TotalTime.load(std::memory_order_relaxed))
+            l_Handlers.push_back(std::make_pair(l_Time, l_I));
+
+        if (uint64 l_Bytes = m_Sends[l_I].Bytes.load(std::memory_order_relaxed))
+            l_Sends.push_back(std::make_pair(l_Bytes, l_I));
+    }
+
+    std::sort(l_Handlers.begin(), l_Handlers.end(), std::greater<std::pair<uint64, uint32>>());
+    std::sort(l_Sends.begin(), l_Sends.end(), std::greater<std::pair<uint64, uint32>>());
+
+    if (p_Limit)
+    {
+        l_Handlers.resize(std::min<size_t>(l_Handlers.size(), p_Limit));
+        l_Sends.resize(std::min<size_t>(l_Sends.size(), p_Limit));
+    }
+
+    char l_Line[256];
+
+    p_Lines.push_back("Client opcodes by total handler time (times in us):");
+    for (auto const& l_Entry : l_Handlers)
+    {
+        HandlerStats const& l_Stats = m_Handlers[l_Entry.second];
+        uint64 l_Count = std::max<uint64>(l_Stats.Count.load(std::memory_order_relaxed), 1);
+
+        snprintf(l_Line, sizeof(l_Line), "%s count " UI64FMTD " total " UI64FMTD " avg " UI64FMTD " p99 %u max %u bytes " UI64FMTD,
+            GetOpcodeNameForLogging(uint16(l_Entry.second), WOW_CLIENT_TO_SERVER).c_str(), l_Count, l_Entry.first, l_Entry.first / l_Count,
+            GetPercentile99(l_Stats), l_Stats.MaxTime.load(std::memory_order_relaxed), l_Stats.Bytes.load(std::memory_order_relaxed));
+        p_Lines.push_back(l_Line);
+    }
+
+    p_Lines.push_back("Server opcodes by sent bytes:");
+    for (auto const& l_Entry : l_Sends)
+    {
+        SendStats const& l_Stats = m_Sends[l_Entry.second];
+        uint64 l_Count = std::max<uint64>(l_Stats.Count.load(std::memory_order_relaxed), 1);
+
+        snprintf(l_Line, sizeof(l_Line), "%s count " UI64FMTD " bytes " UI64FMTD " avg " UI64FMTD " max %u",
+            GetOpcodeNameForLogging(uint16(l_Entry.second), WOW_SERVER_TO_CLIENT).c_str(), l_Count, l_Entry.first, l_Entry.first / l_Count,
+            l_Stats.MaxBytes.load(std::memory_order_relaxed));
+        p_Lines.push_back(l_Line);
+    }
+}
+
+void OpcodeProfiler::DumpToFile() const
+{
+    if (m_DumpFile.empty())
+        return;
+
+    FILE* l_File = fopen(m_DumpFile.c_str(), "a");
+    if (!l_File)
+    {
+        sLog->outError(LOG_FILTER_GENERAL, "OpcodeProfiler: can't open dump file %s", m_DumpFile.c_str());
+        return;
+    }
+
+    std::vector<std::string> l_Lines;
+    BuildReport(l_Lines, 0);
+
+    fprintf(l_File, "==== %s ====\n", TimeToTimestampStr(time(nullptr)).c_str());
+    for (std::string const& l_Line : l_Lines)
+        fprintf(l_File, "%s\n", l_Line.c_str());
+
+    fclose(l_File);
+}
@@ -0,0 +1,79 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Project-Hellscream https://hellscream.org
+// Copyright (C) 2018-2020 Project-Hellscream-6.2
+// Discord https://discord.gg/CWCF3C9
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _OPCODE_PROFILER_H
+#define _OPCODE_PROFILER_H
+
+#include "Common.h"
+#include "Opcodes.h"
+#include <ace/Singleton.h>
+#include <atomic>
+#include <chrono>
+#include <memory>
+
+/// Handler times are counted in power of two buckets of microseconds, the last one holds everything above
+#define OPCODE_PROFILER_TIME_BUCKETS 24
+
+/// Aggregates the handling time of client opcodes and the size of server opcodes.
+/// Handlers run on the world and map threads and packets are sent from every thread, counters are atomic
+/// and the tables are only allocated the first time the profiler is enabled.
+class OpcodeProfiler
+{
+    friend class ACE_Singleton<OpcodeProfiler, ACE_Null_Mutex>;
+
+    public:
+        struct HandlerStats
+        {
+            std::atomic<uint64> Count;
+            std::atomic<uint64> TotalTime;                              ///< Microseconds
+            std::atomic<uint64> Bytes;
+            std::atomic<uint32> MaxTime;                                ///< Microseconds
+            std::atomic<uint32> TimeBuckets[OPCODE_PROFILER_TIME_BUCKETS];
+        };
+
+        struct SendStats
+        {
+            std::atomic<uint64> Count;
+            std::atomic<uint64> Bytes;
+            std::atomic<uint32> MaxBytes;
+        };
+
+        /// Acquire, pairs with the release store of SetEnabled so the tables are seen allocated
+        bool IsEnabled() const { return m_Enabled.load(std::memory_order_acquire); }
+        void SetEnabled(bool p_Enabled);
+        void Reset();
+
+        void SetDumpFile(std::string const& p_FileName) { m_DumpFile = p_FileName; }
+
+        /// Client opcode handled in p_Time microseconds
+        void RecordHandler(uint32 p_Opcode, size_t p_Size, uint64 p_Time);
+        /// Server opcode queued to a socket
+        void RecordSend(uint32 p_Opcode, size_t p_Size);
+
+        /// Most expensive handlers by total time and largest server opcodes by bytes, p_Limit lines each, 0 for all
+        void BuildReport(std::vector<std::string>& p_Lines, uint32 p_Limit) const;
+        /// Appends the full report to the dump file
+        void DumpToFile() const;
+
+    private:
+        OpcodeProfiler() : m_Enabled(false) { }
+
+        /// Upper bound of the bucket under which 99% of the handled packets are
+        static uint32 GetPercentile99(HandlerStats const& p_Stats);
+
+        static void UpdateMax(std::atomic<uint32>& p_Max, uint32 p_Value);
+
+        std::atomic<bool> m_Enabled;
+        std::unique_ptr<HandlerStats[]> m_Handlers;
+        std::unique_ptr<SendStats[]> m_Sends;
+        std::string m_DumpFile;
+};
+
+#define sOpcodeProfiler ACE_Singleton<OpcodeProfiler, ACE_Null_Mutex>::instance()
+
+#endif
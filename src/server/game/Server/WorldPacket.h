@@ -13,6 +13,8 @@
 #include "Opcodes.h"
 #include "ByteBuffer.h"
 
+#include <memory>
+
 struct z_stream_s;
 
 extern std::mutex gPacketProfilerMutex;
@@ -54,4 +56,15 @@ class WorldPacket : public ByteBuffer
         void Compress(void* dst, uint32 *dst_size, const void* src, int src_size);
         z_stream_s* _compressionStream;
 };
+
+/// Packet built once and sent to several sessions, the sockets keep a reference until it is written
+typedef std::shared_ptr<WorldPacket const> SharedWorldPacket;
+
+/// Completes the packet and copies it once in a buffer shared by all its recipients
+inline SharedWorldPacket MakeSharedPacket(WorldPacket const& p_Packet)
+{
+    const_cast<WorldPacket&>(p_Packet).FlushBits();
+    return std::make_shared<WorldPacket const>(p_Packet);
+}
+
 #endif
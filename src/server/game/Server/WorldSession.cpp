@@ -45,6 +45,7 @@
 #include "AccountMgr.h"
 #include "PetBattle.h"
 #include "Chat.h"
+#include "OpcodeProfiler.h"
 
 bool MapSessionFilter::Process(WorldPacket* packet)
 {
@@ -308,29 +309,66 @@ uint32 WorldSession::GetGuidLow() const
 
 /// Send a packet to the client
 void WorldSession::SendPacket(WorldPacket const* packet, bool forced /*= false*/, bool ir_packet /*=false*/)
+{
+    if (!CanSendPacket(packet, forced, ir_packet))
+        return;
+
+#ifdef CROSS
+    if (!m_isinIRBG && packet->GetOpcode() != SMSG_BATTLEFIELD_LIST && 
+        packet->GetOpcode() != SMSG_BATTLEFIELD_STATUS_NONE &&
+        packet->GetOpcode() != SMSG_BATTLEFIELD_STATUS_FAILED &&
+        packet->GetOpcode() != SMSG_BATTLEFIELD_STATUS_QUEUED && 
+        packet->GetOpcode() != SMSG_BATTLEFIELD_STATUS_ACTIVE && 
+        packet->GetOpcode() != SMSG_NEW_WORLD && 
+        packet->GetOpcode() != SMSG_TRANSFER_PENDING &&
+        packet->GetOpcode() != SMSG_BATTLEFIELD_STATUS_NEED_CONFIRMATION)
+         return;
+
+    m_ir_socket->SendTunneledPacket(m_Player->GetRealGUID(), packet);
+#else
+    if (m_Socket->SendPacket(*packet) == -1)
+        m_Socket->CloseSocket();
+#endif
+}
+
+/// Send a packet shared with other sessions to the client
+void WorldSession::SendPacket(SharedWorldPacket const& p_Packet, bool p_Forced /*= false*/)
+{
+#ifdef CROSS
+    SendPacket(p_Packet.get(), p_Forced);
+#else
+    if (!CanSendPacket(p_Packet.get(), p_Forced, false))
+        return;
+
+    if (m_Socket->SendPacket(p_Packet) == -1)
+        m_Socket->CloseSocket();
+#endif
+}
+
+bool WorldSession::CanSendPacket(WorldPacket const* packet, bool forced, bool ir_packet)
 {
 #ifndef CROSS
     if (!m_Socket)
-        return;
+        return false;
 
     if (!ir_packet && GetInterRealmBG() && !CanBeSentDuringInterRealm(packet->GetOpcode()))
-        return;
+        return false;
 
     const_cast<WorldPacket*>(packet)->OnSend();
 
     if (packet->GetOpcode() == NULL_OPCODE && !forced)
     {
         sLog->outError(LOG_FILTER_OPCODES, "Prevented sending of NULL_OPCODE to %s", GetPlayerName(false).c_str());
-        return;
+        return false;
     }
     else if (packet->GetOpcode() == UNKNOWN_OPCODE && !forced)
     {
         sLog->outError(LOG_FILTER_OPCODES, "Prevented sending of UNKNOWN_OPCODE to %s", GetPlayerName(false).c_str());
-        return;
+        return false;
     }
 #else /* CROSS */
     if (!m_ir_socket || !m_Player || m_ir_closing)
-        return;
+        return false;
 #endif
 
     if (!forced)
@@ -339,26 +377,11 @@ void WorldSession::SendPacket(WorldPacket const* packet, bool forced /*= false*/
         if (!handler || handler->status == STATUS_UNHANDLED)
         {
             sLog->outError(LOG_FILTER_OPCODES, "Prevented sending disabled opcode %s to %s", GetOpcodeNameForLogging(packet->GetOpcode(), WOW_SERVER_TO_CLIENT).c_str(), GetPlayerName(false).c_str());
-            return;
+            return false;
         }
     }
 
-#ifdef CROSS
-    if (!m_isinIRBG && packet->GetOpcode() != SMSG_BATTLEFIELD_LIST && 
-        packet->GetOpcode() != SMSG_BATTLEFIELD_STATUS_NONE &&
-        packet->GetOpcode() != SMSG_BATTLEFIELD_STATUS_FAILED &&
-        packet->GetOpcode() != SMSG_BATTLEFIELD_STATUS_QUEUED && 
-        packet->GetOpcode() != SMSG_BATTLEFIELD_STATUS_ACTIVE && 
-        packet->GetOpcode() != SMSG_NEW_WORLD && 
-        packet->GetOpcode() != SMSG_TRANSFER_PENDING &&
-        packet->GetOpcode() != SMSG_BATTLEFIELD_STATUS_NEED_CONFIRMATION)
-         return;
-
-    m_ir_socket->SendTunneledPacket(m_Player->GetRealGUID(), packet);
-#else
-    if (m_Socket->SendPacket(*packet) == -1)
-        m_Socket->CloseSocket();
-#endif
+    return true;
 }
 
 /// Add an incoming packet to the queue
@@ -539,6 +562,12 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
         const OpcodeHandler* opHandle = g_OpcodeTable[WOW_CLIENT_TO_SERVER][packet->GetOpcode()];
         uint32 pktTime = getMSTime();
 
+        /// The high resolution clock is only read while the opcode profiler is enabled
+        bool l_Profile = sOpcodeProfiler->IsEnabled();
+        std::chrono::steady_clock::time_point l_ProfileStart;
+        if (l_Profile)
+            l_ProfileStart = std::chrono::steady_clock::now();
+
         try
         {
             switch (opHandle->status)
@@ -564,7 +593,7 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
                     }
                     else if (m_Player->IsInWorld())
                     {
-                        sScriptMgr->OnPacketReceive(m_Socket, WorldPacket(*packet), this);
+                        sScriptMgr->OnPacketReceive(m_Socket, *packet, this);
                         (this->*opHandle->handler)(*packet);
                         if (sLog->ShouldLog(LOG_FILTER_NETWORKIO, LOG_LEVEL_TRACE) && packet->rpos() < packet->wpos())
                             LogUnprocessedTail(packet);
@@ -644,7 +673,7 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
                     else
                     {
                         // not expected _player or must checked in packet hanlder
-                        sScriptMgr->OnPacketReceive(m_Socket, WorldPacket(*packet), this);
+                        sScriptMgr->OnPacketReceive(m_Socket, *packet, this);
                         (this->*opHandle->handler)(*packet);
                         if (sLog->ShouldLog(LOG_FILTER_NETWORKIO, LOG_LEVEL_TRACE) && packet->rpos() < packet->wpos())
                             LogUnprocessedTail(packet);
@@ -657,7 +686,7 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
                         LogUnexpectedOpcode(packet, "STATUS_TRANSFER", "the player is still in world");
                     else
                     {
-                        sScriptMgr->OnPacketReceive(m_Socket, WorldPacket(*packet), this);
+                        sScriptMgr->OnPacketReceive(m_Socket, *packet, this);
                         (this->*opHandle->handler)(*packet);
                         if (sLog->ShouldLog(LOG_FILTER_NETWORKIO, LOG_LEVEL_TRACE) && packet->rpos() < packet->wpos())
                             LogUnprocessedTail(packet);
@@ -676,7 +705,7 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
                     if (packet->GetOpcode() == CMSG_ENUM_CHARACTERS)
                         m_playerRecentlyLogout = false;
 
-                    sScriptMgr->OnPacketReceive(m_Socket, WorldPacket(*packet), this);
+                    sScriptMgr->OnPacketReceive(m_Socket, *packet, this);
                     (this->*opHandle->handler)(*packet);
                     if (sLog->ShouldLog(LOG_FILTER_NETWORKIO, LOG_LEVEL_TRACE) && packet->rpos() < packet->wpos())
                         LogUnprocessedTail(packet);
@@ -715,6 +744,10 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
                 data.totalTime += getMSTime() - pktTime;
             }
 
+            if (l_Profile)
+                sOpcodeProfiler->RecordHandler(packet->GetOpcode(), packet->size(),
+                    std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - l_ProfileStart).count());
+
             delete packet;
         }
 
@@ -1205,11 +1238,16 @@ void WorldSession::SendAccountDataTimes(uint64 p_Guid)
 
 void WorldSession::LoadTutorialsData()
 {
-    memset(m_Tutorials, 0, sizeof(uint32) * MAX_ACCOUNT_TUTORIAL_VALUES);
-
     PreparedStatement* stmt = SessionRealmDatabase.GetPreparedStatement(CHAR_SEL_TUTORIALS);
     stmt->setUInt32(0, GetAccountId());
-    if (PreparedQueryResult result = SessionRealmDatabase.Query(stmt))
+    LoadTutorialsData(SessionRealmDatabase.Query(stmt));
+}
+
+void WorldSession::LoadTutorialsData(PreparedQueryResult result)
+{
+    memset(m_Tutorials, 0, sizeof(uint32) * MAX_ACCOUNT_TUTORIAL_VALUES);
+
+    if (result)
         for (uint8 i = 0; i < MAX_ACCOUNT_TUTORIAL_VALUES; ++i)
             m_Tutorials[i] = (*result)[i].GetUInt32();
 
@@ -1690,6 +1728,29 @@ void WorldSession::ProcessQueryCallbacks()
     }
 
     l_Times.push_back(getMSTime() - l_StartTime);
+
+    //- LoadPremades
+    if (m_PremadesCallback.ready())
+    {
+        SQLQueryHolder* l_Param;
+        m_PremadesCallback.get(l_Param);
+        HandlePremadesCallback(l_Param);
+        m_PremadesCallback.cancel();
+    }
+
+    //- LoadLoyaltyData
+    if (m_LoyaltyLoginDBCallback.ready() && m_LoyaltyWebDBCallback.ready())
+    {
+        SQLQueryHolder* l_Param;
+        SQLQueryHolder* l_Param2;
+        m_LoyaltyLoginDBCallback.get(l_Param);
+        m_LoyaltyWebDBCallback.get(l_Param2);
+        HandleLoyaltyDataCallback(l_Param, l_Param2);
+        m_LoyaltyLoginDBCallback.cancel();
+        m_LoyaltyWebDBCallback.cancel();
+    }
+
+    l_Times.push_back(getMSTime() - l_StartTime);
 #endif
 
     //! HandlePlayerLoginOpcode
@@ -1795,17 +1856,35 @@ void WorldSession::UnsetCustomFlags(uint32 p_Flags)
 #ifndef CROSS 
 void WorldSession::LoadPremades()
 {
+    SQLQueryHolder* l_Holder = new SQLQueryHolder();
+    l_Holder->SetSize(MAX_PREMADES_QUERY);
+
     PreparedStatement* l_Statement = CharacterDatabase.GetPreparedStatement(CHAR_SEL_PREMADES);
     l_Statement->setUInt32(0, GetAccountId());
+    l_Holder->SetPreparedQuery(PREMADES_QUERY_DELIVERIES, l_Statement);
+
+    l_Statement = CharacterDatabase.GetPreparedStatement(CHAR_SEL_SUM_CHARS);
+    l_Statement->setUInt32(0, GetAccountId());
+    l_Holder->SetPreparedQuery(PREMADES_QUERY_CHARACTERS_COUNT, l_Statement);
+
+    m_PremadesCallback = CharacterDatabase.DelayQueryHolder(l_Holder);
+}
+
+void WorldSession::HandlePremadesCallback(SQLQueryHolder* p_Holder)
+{
+    PreparedQueryResult l_Result = p_Holder->GetPreparedResult(PREMADES_QUERY_DELIVERIES);
+    PreparedQueryResult l_CharactersCountResult = p_Holder->GetPreparedResult(PREMADES_QUERY_CHARACTERS_COUNT);
+    delete p_Holder;
 
-    PreparedQueryResult l_Result = CharacterDatabase.Query(l_Statement);
     if (!l_Result)
         return;
 
-    uint32 l_CharactersCount = AccountMgr::GetCharactersCount(GetAccountId());
+    uint32 l_CharactersCount = l_CharactersCountResult ? uint32((*l_CharactersCountResult)[0].GetUInt64()) : 0;
     if (l_CharactersCount >= sWorld->getIntConfig(CONFIG_CHARACTERS_PER_REALM))
         return;
 
+    PreparedStatement* l_Statement = nullptr;
+
     do
     {
         Field* l_Fields = l_Result->Fetch();
@@ -2037,10 +2116,48 @@ void WorldSession::LoadLoyaltyData()
     if (!sWorld->getBoolConfig(CONFIG_WEB_DATABASE_ENABLE))
         return;
 
+    SQLQueryHolder* l_LoginHolder = new SQLQueryHolder();
+    l_LoginHolder->SetSize(MAX_LOYALTY_LOGINDB_QUERY);
+
     PreparedStatement* l_Statement = LoginDatabase.GetPreparedStatement(LOGIN_SEL_ACTIVITY);
     l_Statement->setUInt32(0, GetAccountId());
+    l_LoginHolder->SetPreparedQuery(LOYALTY_LOGINDB_ACTIVITY, l_Statement);
+
+    l_Statement = LoginDatabase.GetPreparedStatement(LOGIN_SEL_LAST_BANNED_DATE);
+    l_Statement->setUInt32(0, GetAccountId());
+    l_LoginHolder->SetPreparedQuery(LOYALTY_LOGINDB_LAST_BAN, l_Statement);
+
+    l_Statement = LoginDatabase.GetPreparedStatement(LOGIN_SEL_ACC_LOYALTY);
+    l_Statement->setUInt32(0, GetAccountId());
+    l_LoginHolder->SetPreparedQuery(LOYALTY_LOGINDB_LOYALTY, l_Statement);
+
+    /// Only used if the events weren't reset since, that's known with LOYALTY_LOGINDB_LOYALTY
+    l_Statement = LoginDatabase.GetPreparedStatement(LOGIN_SEL_ACC_LOYALTY_EVENT);
+    l_Statement->setUInt32(0, GetAccountId());
+    l_LoginHolder->SetPreparedQuery(LOYALTY_LOGINDB_EVENTS, l_Statement);
+
+    SQLQueryHolder* l_WebHolder = new SQLQueryHolder();
+    l_WebHolder->SetSize(MAX_LOYALTY_WEBDB_QUERY);
+
+    l_Statement = WebDatabase.GetPreparedStatement(WEB_SEL_ACC_VALIDATE);
+    l_Statement->setUInt32(0, GetAccountId());
+    l_WebHolder->SetPreparedQuery(LOYALTY_WEBDB_VALIDATE, l_Statement);
+
+    l_Statement = WebDatabase.GetPreparedStatement(WEB_SEL_POINTS_PURCHASE);
+    l_Statement->setUInt32(0, GetAccountId());
+    l_WebHolder->SetPreparedQuery(LOYALTY_WEBDB_POINTS_PURCHASE, l_Statement);
 
-    PreparedQueryResult l_Activity = LoginDatabase.Query(l_Statement);
+    m_LoyaltyLoginDBCallback = LoginDatabase.DelayQueryHolder(l_LoginHolder);
+    m_LoyaltyWebDBCallback   = WebDatabase.DelayQueryHolder(l_WebHolder);
+#endif
+}
+
+#ifndef CROSS
+void WorldSession::HandleLoyaltyDataCallback(SQLQueryHolder* p_LoginHolder, SQLQueryHolder* p_WebHolder)
+{
+    PreparedStatement* l_Statement = nullptr;
+
+    PreparedQueryResult l_Activity = p_LoginHolder->GetPreparedResult(LOYALTY_LOGINDB_ACTIVITY);
     if (l_Activity)
     {
         do
@@ -2053,30 +2170,20 @@ void WorldSession::LoadLoyaltyData()
         } while (l_Activity->NextRow());
     }
 
-    l_Statement = LoginDatabase.GetPreparedStatement(LOGIN_SEL_LAST_BANNED_DATE);
-    l_Statement->setUInt32(0, GetAccountId());
-
-    PreparedQueryResult l_LastBanDate = LoginDatabase.Query(l_Statement);
+    PreparedQueryResult l_LastBanDate = p_LoginHolder->GetPreparedResult(LOYALTY_LOGINDB_LAST_BAN);
     if (l_LastBanDate)
         m_LastBan = l_LastBanDate->Fetch()[0].GetUInt32();
 
-    l_Statement = WebDatabase.GetPreparedStatement(WEB_SEL_ACC_VALIDATE);
-    l_Statement->setUInt32(0, GetAccountId());
-
-    PreparedQueryResult l_AccountValidate = WebDatabase.Query(l_Statement);
+    PreparedQueryResult l_AccountValidate = p_WebHolder->GetPreparedResult(LOYALTY_WEBDB_VALIDATE);
     if (l_AccountValidate)
         m_EmailValidated = l_AccountValidate->Fetch()[0].GetBool();
 
-    l_Statement = WebDatabase.GetPreparedStatement(WEB_SEL_POINTS_PURCHASE);
-    l_Statement->setUInt32(0, GetAccountId());
-
-    if (PreparedQueryResult l_PointsPurchase = WebDatabase.Query(l_Statement))
+    if (PreparedQueryResult l_PointsPurchase = p_WebHolder->GetPreparedResult(LOYALTY_WEBDB_POINTS_PURCHASE))
         m_AlreadyPurchasePoints = true;
 
-    l_Statement = LoginDatabase.GetPreparedStatement(LOGIN_SEL_ACC_LOYALTY);
-    l_Statement->setUInt32(0, GetAccountId());
+    PreparedQueryResult l_Events = p_LoginHolder->GetPreparedResult(LOYALTY_LOGINDB_EVENTS);
 
-    if (PreparedQueryResult l_AccountLoyalty = LoginDatabase.Query(l_Statement))
+    if (PreparedQueryResult l_AccountLoyalty = p_LoginHolder->GetPreparedResult(LOYALTY_LOGINDB_LOYALTY))
     {
         Field* l_Fields = l_AccountLoyalty->Fetch();
 
@@ -2108,11 +2215,7 @@ void WorldSession::LoadLoyaltyData()
         /// Load event history of the day
         else
         {
-
-            l_Statement = LoginDatabase.GetPreparedStatement(LOGIN_SEL_ACC_LOYALTY_EVENT);
-            l_Statement->setUInt32(0, GetAccountId());
-
-            if (PreparedQueryResult l_Events = LoginDatabase.Query(l_Statement))
+            if (l_Events)
             {
                 do
                 {
@@ -2140,8 +2243,11 @@ void WorldSession::LoadLoyaltyData()
         l_Statement->setUInt32(2, m_LastEventReset);
         LoginDatabase.Execute(l_Statement);
     }
-#endif
+
+    delete p_LoginHolder;
+    delete p_WebHolder;
 }
+#endif
 
 void WorldSession::AddLoyaltyPoints(uint32 p_Count, std::string p_Reason)
 {
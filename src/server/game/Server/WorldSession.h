@@ -136,6 +136,31 @@ class LoginDBQueryHolder : public SQLQueryHolder
         bool Initialize();
 };
 
+/// Queries of WorldSession::LoadPremades
+enum PremadesQueryIndex
+{
+    PREMADES_QUERY_DELIVERIES,
+    PREMADES_QUERY_CHARACTERS_COUNT,
+    MAX_PREMADES_QUERY
+};
+
+/// Queries of WorldSession::LoadLoyaltyData
+enum LoyaltyLoginDBQueryIndex
+{
+    LOYALTY_LOGINDB_ACTIVITY,
+    LOYALTY_LOGINDB_LAST_BAN,
+    LOYALTY_LOGINDB_LOYALTY,
+    LOYALTY_LOGINDB_EVENTS,
+    MAX_LOYALTY_LOGINDB_QUERY
+};
+
+enum LoyaltyWebDBQueryIndex
+{
+    LOYALTY_WEBDB_VALIDATE,
+    LOYALTY_WEBDB_POINTS_PURCHASE,
+    MAX_LOYALTY_WEBDB_QUERY
+};
+
 
 enum PartyCommand
 {
@@ -443,6 +468,8 @@ class WorldSession
         static void WriteMovementInfo(WorldPacket& data, MovementInfo* mi);
 
         void SendPacket(WorldPacket const* packet, bool forced = false, bool ir_packet = false);
+        /// Send a packet shared with other sessions, the socket keeps a reference instead of copying it
+        void SendPacket(SharedWorldPacket const& p_Packet, bool p_Forced = false);
         void SendNotification(const char *format, ...) ATTR_PRINTF(2, 3);
         void SendNotification(uint32 string_id, ...);
         void SendPetNameInvalid(uint32 error, const std::string& name, DeclinedName *declinedName);
@@ -537,6 +564,7 @@ class WorldSession
         void LoadAccountData(PreparedQueryResult result, uint32 mask);
 
         void LoadTutorialsData();
+        void LoadTutorialsData(PreparedQueryResult result);
         void SendTutorialsData();
         void SaveTutorialsData(SQLTransaction& trans);
         uint32 GetTutorialInt(uint8 index) const { return m_Tutorials[index]; }
@@ -661,8 +689,11 @@ class WorldSession
         void UnsetCustomFlags(uint32 p_Flags);
         bool HasCustomFlags(uint32 p_Flags) const { return m_CustomFlags & p_Flags; }
 
+        /// Both only queue their queries, the results are handled by the world thread in ProcessQueryCallbacks
         void LoadPremades();
         void LoadLoyaltyData();
+        void HandlePremadesCallback(SQLQueryHolder* p_Holder);
+        void HandleLoyaltyDataCallback(SQLQueryHolder* p_LoginHolder, SQLQueryHolder* p_WebHolder);
 
         /// Send a game error
         /// @p_Error : Game error
@@ -1491,6 +1522,9 @@ class WorldSession
         void InitializeQueryCallbackParameters();
         void ProcessQueryCallbacks();
 
+        /// Checks shared by both SendPacket versions
+        bool CanSendPacket(WorldPacket const* packet, bool forced, bool ir_packet);
+
         QueryCallback<QueryResult, bool, true> m_VoteTimeCallback;
 
         PreparedQueryResultFuture m_CharEnumCallback;
@@ -1519,6 +1553,9 @@ class WorldSession
         QueryCallback<PreparedQueryResult, CharacterCreateInfo*, true> _charCreateCallback;
         QueryResultHolderFuture m_CharacterLoginCallback;
         QueryResultHolderFuture m_CharacterLoginDBCallback;
+        QueryResultHolderFuture m_PremadesCallback;
+        QueryResultHolderFuture m_LoyaltyLoginDBCallback;
+        QueryResultHolderFuture m_LoyaltyWebDBCallback;
 
         //////////////////////////////////////////////////////////////////////////
         /// New transaction query callback system
@@ -33,6 +33,7 @@
 #include "WorldSession.h"
 #include "WorldSocketMgr.h"
 #include "Log.h"
+#include "OpcodeProfiler.h"
 #include "PacketLog.h"
 #include "ScriptMgr.h"
 #include "AccountMgr.h"
@@ -41,6 +42,15 @@
 uint32_t gReceivedBytes = 0;
 uint32_t gSentBytes = 0;
 
+/// Upper bound of the packets waiting for a session, the socket is closed past it
+static size_t const MaxQueuedBytes = 8 * 1024 * 1024;
+
+/// Headers and payloads gathered in one write
+static int const MaxGatheredBuffers = 64;
+
+/// Upper bound of the data buffered while the account query of CMSG_AUTH_SESSION runs
+static size_t const MaxPendingAuthInput = 64 * 1024;
+
 #if defined(__GNUC__)
 #pragma pack(1)
 #else
@@ -49,9 +59,10 @@ uint32_t gSentBytes = 0;
 
 struct ServerPktHeader
 {
+    /// _authCrypt is null when the packet was queued before the encryption started
     ServerPktHeader(uint32 size, uint32 cmd, AuthCrypt* _authCrypt) : size(size)
     {
-        if (_authCrypt->IsInitialized())
+        if (_authCrypt && _authCrypt->IsInitialized())
         {
             uint32 data = (size << 13) | cmd & 0x1FFF;
             memcpy(&header[0], &data, 4);
@@ -95,24 +106,18 @@ struct WorldClientPktHeader
 WorldSocket::WorldSocket(void) : WorldHandler(),
 m_LastPingTime(ACE_Time_Value::zero), m_OverSpeedPings(0), m_Session(0),
 m_RecvWPct(0), m_RecvPct(), m_Header(sizeof(AuthClientPktHeader)),
-m_WorldHeader(sizeof(WorldClientPktHeader)), m_OutBuffer(0),
-m_OutBufferSize(65536), m_OutActive(false),
+m_WorldHeader(sizeof(WorldClientPktHeader)), m_QueuedBytes(0),
+m_OutBufferSize(65536), m_Opened(false), m_OutActive(false),
 
-m_Seed(static_cast<uint32> (rand32()))
+m_Seed(static_cast<uint32> (rand32())), m_SessionPending(false)
 {
     reference_counting_policy().value(ACE_Event_Handler::Reference_Counting_Policy::ENABLED);
-
-    msg_queue()->high_water_mark(8 * 1024 * 1024);
-    msg_queue()->low_water_mark(8 * 1024 * 1024);
 }
 
 WorldSocket::~WorldSocket (void)
 {
     delete m_RecvWPct;
 
-    if (m_OutBuffer)
-        m_OutBuffer->release();
-
     closing_ = true;
 
     peer().close();
@@ -138,6 +143,7 @@ void WorldSocket::CloseSocket (void)
     {
         ACE_GUARD (LockType, Guard, m_SessionLock);
 
+        AddPendingSession();
         m_Session = NULL;
     }
 }
@@ -149,22 +155,77 @@ const std::string& WorldSocket::GetRemoteAddress (void) const
 
 int WorldSocket::SendPacket(WorldPacket const& pct)
 {
-    ACE_GUARD_RETURN (LockType, Guard, m_OutBufferLock, -1);
+    if (closing_)
+        return -1;
+
+    const_cast<WorldPacket&>(pct).FlushBits();
 
+    if (!OnSendPacket(pct))
+        return 0;
+
+    OutgoingPacket l_Packet;
+    if (!ReserveOutgoingPacket(pct, l_Packet))
+        return -1;
+
+    // unicast packets are copied once, in a buffer of their exact size owned by the queued entry
+    if (!pct.empty())
+        l_Packet.Payload.assign(pct.contents(), pct.contents() + pct.size());
+
+    m_PacketQueue.Enqueue(std::move(l_Packet));
+
+    return 0;
+}
+
+int WorldSocket::SendPacket(SharedWorldPacket const& p_Packet)
+{
     if (closing_)
         return -1;
 
+    WorldPacket const& pct = *p_Packet;
+
+    if (!OnSendPacket(pct))
+        return 0;
+
+    OutgoingPacket l_Packet;
+    if (!ReserveOutgoingPacket(pct, l_Packet))
+        return -1;
+
+    l_Packet.Packet = p_Packet;
+
+    m_PacketQueue.Enqueue(std::move(l_Packet));
+
+    return 0;
+}
+
+bool WorldSocket::ReserveOutgoingPacket(WorldPacket const& pct, OutgoingPacket& p_Packet)
+{
+    p_Packet.Encrypt = m_Crypt.IsInitialized();
+    p_Packet.Size    = p_Packet.Encrypt ? pct.size() : pct.size() + 2;
+    p_Packet.Opcode  = pct.GetOpcode();
+    p_Packet.Written = 0;
+    p_Packet.Length  = pct.size() + sizeof(p_Packet.Header);
+
+    size_t l_Length = p_Packet.Length;
+    if (m_QueuedBytes.fetch_add(l_Length) + l_Length > MaxQueuedBytes)
+    {
+        m_QueuedBytes -= l_Length;
+        sLog->outError(LOG_FILTER_NETWORKIO, "WorldSocket::SendPacket send queue of %s is full", GetRemoteAddress().c_str());
+        return false;
+    }
+
+    return true;
+}
+
+bool WorldSocket::OnSendPacket(WorldPacket const& pct)
+{
     // Dump outgoing packet
     if (sPacketLog->CanLogPacket())
         sPacketLog->LogPacket(pct, SERVER_TO_CLIENT);
 
     if (pct.GetOpcode() == 0)
-        return 0;
+        return false;
 
-    WorldPacket const* pkt = &pct;
-    const_cast<WorldPacket*>(pkt)->FlushBits();
-
-    gSentBytes += pkt->size() + 3;
+    gSentBytes += pct.size() + 3;
 
     if (sWorld->getBoolConfig(CONFIG_LOG_PACKETS))
     {
@@ -179,45 +240,16 @@ int WorldSocket::SendPacket(WorldPacket const& pct)
                 break;
 
             default:
-                printf("Send packet %s\n", GetOpcodeNameForLogging(pkt->GetOpcode(), WOW_SERVER_TO_CLIENT).c_str());
+                printf("Send packet %s\n", GetOpcodeNameForLogging(pct.GetOpcode(), WOW_SERVER_TO_CLIENT).c_str());
         }
     }
 
-    sScriptMgr->OnPacketSend(this, *pkt);
-
-    ServerPktHeader header(!m_Crypt.IsInitialized() ? pkt->size() + 2 : pct.size(), pkt->GetOpcode(), &m_Crypt);
-
-    if (m_OutBuffer->space() >= pkt->size() + header.getHeaderLength() && msg_queue()->is_empty())
-    {
-        // Put the packet on the buffer.
-        if (m_OutBuffer->copy((char*)header.header, header.getHeaderLength()) == -1)
-            ACE_ASSERT(false);
-
-        if (!pkt->empty())
-        if (m_OutBuffer->copy((char*)pkt->contents(), pkt->size()) == -1)
-            ACE_ASSERT(false);
-    }
-    else
-    {
-        // Enqueue the packet.
-        ACE_Message_Block* mb;
+    sScriptMgr->OnPacketSend(this, pct);
 
-        ACE_NEW_RETURN(mb, ACE_Message_Block(pkt->size() + header.getHeaderLength()), -1);
+    if (sOpcodeProfiler->IsEnabled())
+        sOpcodeProfiler->RecordSend(pct.GetOpcode(), pct.size());
 
-        mb->copy((char*)header.header, header.getHeaderLength());
-
-        if (!pkt->empty())
-            mb->copy((const char*)pkt->contents(), pkt->size());
-
-        if (msg_queue()->enqueue_tail(mb, (ACE_Time_Value*)&ACE_Time_Value::zero) == -1)
-        {
-            sLog->outError(LOG_FILTER_NETWORKIO, "WorldSocket::SendPacket enqueue_tail failed");
-            mb->release();
-            return -1;
-        }
-    }
-
-    return 0;
+    return true;
 }
 
 long WorldSocket::AddReference (void)
@@ -235,9 +267,11 @@ int WorldSocket::open (void *a)
     ACE_UNUSED_ARG (a);
 
     // Prevent double call to this func.
-    if (m_OutBuffer)
+    if (m_Opened)
         return -1;
 
+    m_Opened = true;
+
     // This will also prevent the socket from being Updated
     // while we are initializing it.
     m_OutActive = true;
@@ -246,9 +280,6 @@ int WorldSocket::open (void *a)
     if (sWorldSocketMgr->OnSocketOpen(this) == -1)
         return -1;
 
-    // Allocate the buffer.
-    ACE_NEW_RETURN (m_OutBuffer, ACE_Message_Block (m_OutBufferSize), -1);
-
     // Store peer address.
     ACE_INET_Addr remote_addr;
 
@@ -335,104 +366,98 @@ int WorldSocket::handle_output (ACE_HANDLE)
     if (closing_)
         return -1;
 
-    size_t send_len = m_OutBuffer->length();
-
-    if (send_len == 0)
-        return handle_output_queue(Guard);
-
-#ifdef MSG_NOSIGNAL
-    ssize_t n = peer().send (m_OutBuffer->rd_ptr(), send_len, MSG_NOSIGNAL);
-#else
-    ssize_t n = peer().send (m_OutBuffer->rd_ptr(), send_len);
-#endif // MSG_NOSIGNAL
-
-    if (n == 0)
-        return -1;
-    else if (n == -1)
-    {
-        if (errno == EWOULDBLOCK || errno == EAGAIN)
-            return schedule_wakeup_output (Guard);
+    FetchQueuedPackets();
 
-        return -1;
-    }
-    else if (n < (ssize_t)send_len) //now n > 0
-    {
-        m_OutBuffer->rd_ptr (static_cast<size_t> (n));
+    if (m_SendQueue.empty())
+        return cancel_wakeup_output(Guard);
 
-        // move the data to the base of the buffer
-        m_OutBuffer->crunch();
+    iovec l_Buffers[MaxGatheredBuffers];
+    int l_BufferCount = 0;
+    size_t send_len = 0;
 
-        return schedule_wakeup_output (Guard);
-    }
-    else //now n == send_len
+    for (OutgoingPacket const& l_Packet : m_SendQueue)
     {
-        m_OutBuffer->reset();
+        if (l_BufferCount + 2 > MaxGatheredBuffers || send_len >= m_OutBufferSize)
+            break;
 
-        return handle_output_queue (Guard);
-    }
-
-    ACE_NOTREACHED (return 0);
-}
-
-int WorldSocket::handle_output_queue (GuardType& g)
-{
-    if (msg_queue()->is_empty())
-        return cancel_wakeup_output(g);
+        size_t l_Offset = l_Packet.Written;
+        if (l_Offset < sizeof(l_Packet.Header))
+        {
+            l_Buffers[l_BufferCount].iov_base = (char*)(l_Packet.Header + l_Offset);
+            l_Buffers[l_BufferCount].iov_len  = sizeof(l_Packet.Header) - l_Offset;
+            send_len += l_Buffers[l_BufferCount++].iov_len;
+            l_Offset = 0;
+        }
+        else
+            l_Offset -= sizeof(l_Packet.Header);
 
-    ACE_Message_Block* mblk;
+        size_t l_PayloadSize = l_Packet.Length - sizeof(l_Packet.Header);
+        if (l_PayloadSize > l_Offset)
+        {
+            uint8 const* l_Payload = l_Packet.Packet ? l_Packet.Packet->contents() : l_Packet.Payload.data();
 
-    if (msg_queue()->dequeue_head(mblk, (ACE_Time_Value*)&ACE_Time_Value::zero) == -1)
-    {
-        sLog->outError(LOG_FILTER_NETWORKIO, "WorldSocket::handle_output_queue dequeue_head");
-        return -1;
+            l_Buffers[l_BufferCount].iov_base = (char*)(l_Payload + l_Offset);
+            l_Buffers[l_BufferCount].iov_len  = l_PayloadSize - l_Offset;
+            send_len += l_Buffers[l_BufferCount++].iov_len;
+        }
     }
 
-    const size_t send_len = mblk->length();
-
 #ifdef MSG_NOSIGNAL
-    ssize_t n = peer().send (mblk->rd_ptr(), send_len, MSG_NOSIGNAL);
+    msghdr l_Message;
+    memset(&l_Message, 0, sizeof(l_Message));
+    l_Message.msg_iov    = l_Buffers;
+    l_Message.msg_iovlen = l_BufferCount;
+
+    ssize_t n = ::sendmsg(get_handle(), &l_Message, MSG_NOSIGNAL);
 #else
-    ssize_t n = peer().send (mblk->rd_ptr(), send_len);
+    ssize_t n = peer().sendv (l_Buffers, l_BufferCount);
 #endif // MSG_NOSIGNAL
 
     if (n == 0)
-    {
-        mblk->release();
-
         return -1;
-    }
     else if (n == -1)
     {
         if (errno == EWOULDBLOCK || errno == EAGAIN)
-        {
-            msg_queue()->enqueue_head(mblk, (ACE_Time_Value*) &ACE_Time_Value::zero);
-            return schedule_wakeup_output (g);
-        }
+            return schedule_wakeup_output (Guard);
 
-        mblk->release();
         return -1;
     }
-    else if (n < (ssize_t)send_len) //now n > 0
-    {
-        mblk->rd_ptr(static_cast<size_t> (n));
 
-        if (msg_queue()->enqueue_head(mblk, (ACE_Time_Value*) &ACE_Time_Value::zero) == -1)
+    m_QueuedBytes -= static_cast<size_t> (n);
+
+    // release the packets written entirely, the last one may be partially written
+    size_t l_Remaining = static_cast<size_t> (n);
+    while (l_Remaining)
+    {
+        OutgoingPacket& l_Packet = m_SendQueue.front();
+        size_t l_Left = l_Packet.Length - l_Packet.Written;
+        if (l_Remaining < l_Left)
         {
-            sLog->outError(LOG_FILTER_NETWORKIO, "WorldSocket::handle_output_queue enqueue_head");
-            mblk->release();
-            return -1;
+            l_Packet.Written += l_Remaining;
+            break;
         }
 
-        return schedule_wakeup_output (g);
+        l_Remaining -= l_Left;
+        m_SendQueue.pop_front();
     }
-    else //now n == send_len
+
+    if (n < (ssize_t)send_len)
+        return schedule_wakeup_output (Guard);
+
+    return (m_SendQueue.empty() && m_PacketQueue.Empty()) ? cancel_wakeup_output(Guard) : ACE_Event_Handler::WRITE_MASK;
+}
+
+void WorldSocket::FetchQueuedPackets()
+{
+    OutgoingPacket l_Packet;
+    while (m_PacketQueue.Dequeue(l_Packet))
     {
-        mblk->release();
+        // headers must be encrypted in sending order
+        ServerPktHeader l_Header(l_Packet.Size, l_Packet.Opcode, l_Packet.Encrypt ? &m_Crypt : nullptr);
+        memcpy(l_Packet.Header, l_Header.header, l_Header.getHeaderLength());
 
-        return msg_queue()->is_empty() ? cancel_wakeup_output(g) : ACE_Event_Handler::WRITE_MASK;
+        m_SendQueue.push_back(std::move(l_Packet));
     }
-
-    ACE_NOTREACHED(return -1);
 }
 
 int WorldSocket::handle_close (ACE_HANDLE h, ACE_Reactor_Mask)
@@ -451,6 +476,7 @@ int WorldSocket::handle_close (ACE_HANDLE h, ACE_Reactor_Mask)
     {
         ACE_GUARD_RETURN (LockType, Guard, m_SessionLock, -1);
 
+        AddPendingSession();
         m_Session = NULL;
     }
 
@@ -463,12 +489,51 @@ int WorldSocket::Update (void)
     if (closing_)
         return -1;
 
+    if (m_PendingAuth && m_AuthQuery.ready())
+    {
+        PreparedQueryResult result;
+        m_AuthQuery.get(result);
+        m_AuthQuery.cancel();
+
+        if (HandleAuthSessionCallback(result) == -1)
+            return -1;
+
+        // the crypt is initialized now, read what the client sent meanwhile
+        std::string input;
+        input.swap(m_PendingInput);
+
+        ACE_Message_Block message_block(input.data(), input.size());
+        message_block.wr_ptr(input.size());
+
+        if (handle_input_buffer(message_block) == -1 && errno != EWOULDBLOCK && errno != EAGAIN)
+            return -1;
+    }
+
+    if (m_SessionPending && m_AccountDataQuery.ready() && m_TutorialsQuery.ready())
+    {
+        ACE_GUARD_RETURN(LockType, Guard, m_SessionLock, -1);
+
+        if (m_SessionPending)
+        {
+            PreparedQueryResult result;
+            m_AccountDataQuery.get(result);
+            m_AccountDataQuery.cancel();
+            m_Session->LoadAccountData(result, GLOBAL_CACHE_MASK);
+
+            m_TutorialsQuery.get(result);
+            m_TutorialsQuery.cancel();
+            m_Session->LoadTutorialsData(result);
+
+            AddPendingSession();
+        }
+    }
+
     if (m_OutActive)
         return 0;
 
     {
         ACE_GUARD_RETURN(LockType, Guard, m_OutBufferLock, 0);
-        if (m_OutBuffer->length() == 0 && msg_queue()->is_empty())
+        if (m_SendQueue.empty() && m_PacketQueue.Empty())
             return 0;
     }
 
@@ -630,8 +695,31 @@ int WorldSocket::handle_input_missing_data (void)
 
     message_block.wr_ptr(n);
 
+    if (handle_input_buffer(message_block) == -1)
+        return -1;
+
+    return size_t(n) == recv_size ? 1 : 2;
+}
+
+int WorldSocket::handle_input_buffer (ACE_Message_Block& message_block)
+{
     while (message_block.length() > 0)
     {
+        // the next packets may be encrypted with a key we don't know yet, keep them for later
+        if (m_PendingAuth)
+        {
+            if (m_PendingInput.size() + message_block.length() > MaxPendingAuthInput)
+            {
+                sLog->outError(LOG_FILTER_NETWORKIO, "WorldSocket::handle_input_buffer: %s sent too much data during authentication", GetRemoteAddress().c_str());
+                errno = EINVAL;
+                return -1;
+            }
+
+            m_PendingInput.append(message_block.rd_ptr(), message_block.length());
+            message_block.rd_ptr(message_block.length());
+            break;
+        }
+
         if (m_Crypt.IsInitialized())
         {
             if (m_WorldHeader.space() > 0)
@@ -718,7 +806,7 @@ int WorldSocket::handle_input_missing_data (void)
         }
     }
 
-    return size_t(n) == recv_size ? 1 : 2;
+    return 0;
 }
 
 int WorldSocket::cancel_wakeup_output (GuardType& g)
@@ -795,26 +883,26 @@ int WorldSocket::ProcessIncoming(WorldPacket* new_pct)
                     return -1;
                 }
 
-                sScriptMgr->OnPacketReceive(this, WorldPacket(*new_pct));
+                sScriptMgr->OnPacketReceive(this, *new_pct);
                 return HandleAuthSession(*new_pct);
             }
             case CMSG_KEEP_ALIVE:
             {
                 sLog->outDebug(LOG_FILTER_NETWORKIO, "%s", GetOpcodeNameForLogging(opcode, WOW_CLIENT_TO_SERVER).c_str());
-                sScriptMgr->OnPacketReceive(this, WorldPacket(*new_pct));
+                sScriptMgr->OnPacketReceive(this, *new_pct);
                 return 0;
             }
             case CMSG_LOG_DISCONNECT:
             {
                 new_pct->rfinish(); // contains uint32 disconnectReason;
-                sScriptMgr->OnPacketReceive(this, WorldPacket(*new_pct));
+                sScriptMgr->OnPacketReceive(this, *new_pct);
                 return 0;
             }
             // not an opcode, client sends string "WORLD OF WARCRAFT CONNECTION - CLIENT TO SERVER" without opcode
             // first 4 bytes become the opcode (2 dropped)
             case CMSG_HANDSHAKE:
             {
-                sScriptMgr->OnPacketReceive(this, WorldPacket(*new_pct));
+                sScriptMgr->OnPacketReceive(this, *new_pct);
                 std::string str;
                 *new_pct >> str;
                 if (str != "D OF WARCRAFT CONNECTION - CLIENT TO SERVER")
@@ -823,7 +911,7 @@ int WorldSocket::ProcessIncoming(WorldPacket* new_pct)
             }
             case CMSG_ENABLE_NAGLE:
             {
-                sScriptMgr->OnPacketReceive(this, WorldPacket(*new_pct));
+                sScriptMgr->OnPacketReceive(this, *new_pct);
                 return m_Session ? m_Session->HandleEnableNagleAlgorithm() : -1;
             }
             default:
@@ -1109,13 +1197,7 @@ int WorldSocket::HandleAuthSession(WorldPacket& p_RecvPacket)
 
     //////////////////////////////////////////////////////////////////////////
 
-    uint32          l_AccountID             = 0;
-    uint32          l_VoteRemainingTime     = 0;
-    uint16          l_AccountGMLevel        = 0;
-    uint8           l_AccountPremiumType    = 0;
-    bool            l_AccountIsPremium      = false;
-    LocaleConstant  l_AccountLocale;
-    BigNumber       l_SessionKey;
+    uint32 l_AccountID = 0;
 
     if (sWorld->IsClosed())
     {
@@ -1137,20 +1219,48 @@ int WorldSocket::HandleAuthSession(WorldPacket& p_RecvPacket)
         return -1;
     }
 
-    //                                                    0       1          2       3    4  5      6          7       8         9      10    11       12                           13             14         15
-    QueryResult l_Result = LoginDatabase.PQuery ("SELECT id, sessionkey, last_ip, locked, v, s, expansion, mutetime, locale, recruiter, os, username, UNIX_TIMESTAMP(joindate), service_flags, custom_flags, token_key FROM account  WHERE id = %u", l_AccountID);
+    m_PendingAuth.reset(new PendingAuthSession());
+    m_PendingAuth->AccountName          = l_AccountIDStr;
+    m_PendingAuth->ClientSeed           = l_ClientSeed;
+    m_PendingAuth->ClientBuild          = l_ClientBuild;
+    m_PendingAuth->AddonsCompressedData = l_AddonsCompressedData;
+    memcpy(m_PendingAuth->ClientAuthChallenge, l_ClientAuthChallenge, sizeof(l_ClientAuthChallenge));
+
+    /// Account row, gm level, bans, vote and premium in one go, the socket is parked until Update() sees the result
+    PreparedStatement* l_Stmt = LoginDatabase.GetPreparedStatement(LOGIN_SEL_ACCOUNT_INFO_BY_ID);
+    l_Stmt->setInt32(0, int32(g_RealmID));
+    l_Stmt->setString(1, GetRemoteAddress());
+    l_Stmt->setUInt32(2, l_AccountID);
+
+    m_AuthQuery = LoginDatabase.AsyncQuery(l_Stmt);
+
+    return 0;
+}
+
+int WorldSocket::HandleAuthSessionCallback(PreparedQueryResult p_Result)
+{
+    std::unique_ptr<PendingAuthSession> l_AuthSession(std::move(m_PendingAuth));
+
+    std::string     l_AccountIDStr          = l_AuthSession->AccountName;
+    uint32          l_AccountID             = 0;
+    uint32          l_VoteRemainingTime     = 0;
+    uint16          l_AccountGMLevel        = 0;
+    uint8           l_AccountPremiumType    = 0;
+    bool            l_AccountIsPremium      = false;
+    LocaleConstant  l_AccountLocale;
+    BigNumber       l_SessionKey;
 
     /// Stop if the account is not found
-    if (!l_Result)
+    if (!p_Result)
     {
         SendAuthResponse(AUTH_UNKNOWN_ACCOUNT, false, 0);
         sLog->outError(LOG_FILTER_NETWORKIO, "WorldSocket::HandleAuthSession: Sent Auth Response (unknown account).");
         return -1;
     }
 
-    Field * l_Fields = l_Result->Fetch();
+    Field * l_Fields = p_Result->Fetch();
 
-    l_AccountName = l_Fields[11].GetString();
+    std::string l_AccountName = l_Fields[11].GetString();
     std::string l_EscapedAccountName = l_AccountName;
     LoginDatabase.EscapeString(l_EscapedAccountName);
 
@@ -1203,22 +1313,14 @@ int WorldSocket::HandleAuthSession(WorldPacket& p_RecvPacket)
     std::string l_AccountOS = l_Fields[10].GetString();
     std::string l_TokenKey  = l_Fields[15].GetString();
 
-    /// Checks gmlevel per Realm                0        1
-    l_Result = LoginDatabase.PQuery ("SELECT RealmID, gmlevel FROM account_access WHERE id = '%d' AND (RealmID = '%d' OR RealmID = '-1')", l_AccountID, g_RealmID);
-
-    if (!l_Result || (sWorld->getBoolConfig(CONFIG_MUST_HAVE_AUTHENTICATOR_ACCESS) && l_TokenKey.empty()))
+    /// Checks gmlevel per Realm
+    if (l_Fields[16].IsNull() || (sWorld->getBoolConfig(CONFIG_MUST_HAVE_AUTHENTICATOR_ACCESS) && l_TokenKey.empty()))
         l_AccountGMLevel = 0;
     else
-    {
-        l_Fields            = l_Result->Fetch();
-        l_AccountGMLevel    = l_Fields[1].GetUInt8();
-    }
+        l_AccountGMLevel = l_Fields[16].GetUInt8();
 
     /// Re-check account ban (same check as in auth server)
-    QueryResult l_BanResult = LoginDatabase.PQuery ("SELECT 1 FROM account_banned WHERE id = %u AND active = 1  UNION  SELECT 1 FROM ip_banned WHERE ip = '%s'", l_AccountID, GetRemoteAddress().c_str());
-
-    /// if account banned
-    if (l_BanResult)
+    if (l_Fields[17].GetUInt64())
     {
         SendAuthResponse(AUTH_BANNED, false, 0);
         sLog->outError(LOG_FILTER_NETWORKIO, "WorldSocket::HandleAuthSession: Sent Auth Response (Account banned).");
@@ -1226,24 +1328,13 @@ int WorldSocket::HandleAuthSession(WorldPacket& p_RecvPacket)
     }
 
     /// - Vote buff
-    {
-        QueryResult l_VoteResult = LoginDatabase.PQuery("SELECT remainingTime FROM account_vote where account = %u", l_AccountID);
-        if (l_VoteResult)
-            l_VoteRemainingTime = l_VoteResult->Fetch()->GetUInt32();
-    }
+    l_VoteRemainingTime = uint32(l_Fields[18].GetUInt64());
 
     /// - Premium
+    if (!l_Fields[19].IsNull())
     {
-        QueryResult l_PremiumResult = LoginDatabase.PQuery("SELECT premium_type FROM account_premium WHERE id = '%u' AND active = 1", l_AccountID);
-
-        /// If account premium
-        if (l_PremiumResult)
-        {
-            Field * l_PremiumFields = l_PremiumResult->Fetch();
-
-            l_AccountIsPremium = true;
-            l_AccountPremiumType = l_PremiumFields->GetUInt8();
-        }
+        l_AccountIsPremium = true;
+        l_AccountPremiumType = l_Fields[19].GetUInt8();
     }
 
     /// Check locked state for server
@@ -1261,6 +1352,7 @@ int WorldSocket::HandleAuthSession(WorldPacket& p_RecvPacket)
     /// Check that Key and account name are the same on client and server
     uint32 l_ChallengeT = 0;
     uint32 l_ServerSeed = m_Seed;
+    uint32 l_ClientSeed = l_AuthSession->ClientSeed;
 
     SHA1Hash l_ServerAuthChallenge;
     l_ServerAuthChallenge.UpdateData(l_AccountIDStr);
@@ -1272,7 +1364,7 @@ int WorldSocket::HandleAuthSession(WorldPacket& p_RecvPacket)
 
     std::string l_SessionIP = GetRemoteAddress();
 
-    if (memcmp(l_ServerAuthChallenge.GetDigest(), l_ClientAuthChallenge, SHA_DIGEST_LENGTH))
+    if (memcmp(l_ServerAuthChallenge.GetDigest(), l_AuthSession->ClientAuthChallenge, SHA_DIGEST_LENGTH))
     {
         SendAuthResponse(AUTH_FAILED, false, 0);
         sLog->outError(LOG_FILTER_NETWORKIO, "WorldSocket::HandleAuthSession: Authentication failed for account: %u ('%s') address: %s", l_AccountID, l_AccountName.c_str(), l_SessionIP.c_str());
@@ -1294,10 +1386,8 @@ int WorldSocket::HandleAuthSession(WorldPacket& p_RecvPacket)
 
     m_Crypt.Init(&l_SessionKey);
 
-    m_Session->LoadGlobalAccountData();
-    m_Session->LoadTutorialsData();
-    m_Session->ReadAddonsInfo(l_AddonsCompressedData);
-    m_Session->SetClientBuild(l_ClientBuild);
+    m_Session->ReadAddonsInfo(l_AuthSession->AddonsCompressedData);
+    m_Session->SetClientBuild(l_AuthSession->ClientBuild);
     m_Session->SetAccountJoinDate(l_JoinDateTimestamp);
     m_Session->LoadPremades();
     m_Session->LoadLoyaltyData();
@@ -1306,15 +1396,29 @@ int WorldSocket::HandleAuthSession(WorldPacket& p_RecvPacket)
     if (sWorld->getBoolConfig(CONFIG_WARDEN_ENABLED))
         m_Session->InitWarden(&l_SessionKey, l_AccountOS);
 
-    /// Sleep this Network thread for
-    uint32 l_SleepTime = sWorld->getIntConfig(CONFIG_SESSION_ADD_DELAY);
-    ACE_OS::sleep(ACE_Time_Value(0, l_SleepTime));
+    /// Account data and tutorials are sent when the session is added, Update() adds it once they are loaded
+    PreparedStatement* l_Stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_ACCOUNT_DATA);
+    l_Stmt->setUInt32(0, l_AccountID);
+    m_AccountDataQuery = CharacterDatabase.AsyncQuery(l_Stmt);
 
-    sWorld->AddSession(m_Session);
+    l_Stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_TUTORIALS);
+    l_Stmt->setUInt32(0, l_AccountID);
+    m_TutorialsQuery = CharacterDatabase.AsyncQuery(l_Stmt);
+
+    m_SessionPending = true;
 
     return 0;
 }
 
+void WorldSocket::AddPendingSession()
+{
+    if (!m_SessionPending)
+        return;
+
+    m_SessionPending = false;
+    sWorld->AddSession(m_Session);
+}
+
 int WorldSocket::HandlePing(WorldPacket& recvPacket)
 {
     uint32 ping;
@@ -32,9 +32,13 @@
 
 #include "Common.h"
 #include "AuthCrypt.h"
+#include "DatabaseEnv.h"
+#include "MPSCQueue.h"
+#include "WorldPacket.h"
+
+#include <deque>
 
 class ACE_Message_Block;
-class WorldPacket;
 class WorldSession;
 
 /// Handler that can communicate over stream sockets.
@@ -48,14 +52,17 @@ typedef ACE_Svc_Handler<ACE_SOCK_STREAM, ACE_NULL_SYNCH> WorldHandler;
  * Most methods return -1 on failure.
  * The class uses reference counting.
  *
- * For output the class uses one buffer (64K usually) and
- * a queue where it stores packet if there is no place on
- * the queue. The reason this is done, is because the server
- * does really a lot of small-size writes to it, and it doesn't
- * scale well to allocate memory for every. When something is
- * written to the output buffer the socket is not immediately
- * activated for output (again for the same reason), there
- * is 10ms celling (thats why there is Update() method).
+ * For output the class uses a lock free queue of packets,
+ * producer threads only push them and never take a lock.
+ * A packet broadcasted to many sessions is reference counted,
+ * it is serialized once and shared by all of them. A unicast
+ * packet is copied once in a buffer of its size owned by its
+ * queue entry.
+ * The network thread encrypts the headers in queue order and
+ * gathers up to 64K (usually) of headers and payloads in one
+ * writev call. When something is queued the socket is not
+ * immediately activated for output, there is 10ms celling
+ * (thats why there is Update() method).
  * This concept is similar to TCP_CORK, but TCP_CORK
  * uses 200ms celling. As result overhead generated by
  * sending packets from "producer" threads is minimal,
@@ -98,10 +105,15 @@ class WorldSocket : public WorldHandler
         const std::string& GetRemoteAddress (void) const;
 
         /// Send A packet on the socket, this function is reentrant.
+        /// The payload is copied in the queued entry, the packet can be reused as soon as this returns.
         /// @param pct packet to send
         /// @return -1 of failure
         int SendPacket(const WorldPacket& pct);
 
+        /// Send a packet shared with other sockets, its content must not change anymore.
+        /// @return -1 of failure
+        int SendPacket(SharedWorldPacket const& p_Packet);
+
         /// Add reference to this object.
         long AddReference (void);
 
@@ -134,22 +146,41 @@ class WorldSocket : public WorldHandler
         int handle_input_header (void);
         int handle_input_payload (void);
         int handle_input_missing_data (void);
+        int handle_input_buffer (ACE_Message_Block& message_block);
 
         /// Help functions to mark/unmark the socket for output.
         /// @param g the guard is for m_OutBufferLock, the function will release it
         int cancel_wakeup_output (GuardType& g);
         int schedule_wakeup_output (GuardType& g);
 
-        /// Drain the queue if its not empty.
-        int handle_output_queue (GuardType& g);
+        /// Move the packets pushed by the producers to m_SendQueue, building their header.
+        void FetchQueuedPackets();
+
+        /// Packet log, statistics and script hook of a packet about to be sent.
+        /// @return false if the packet must not go to the client
+        bool OnSendPacket(WorldPacket const& pct);
+
+        struct OutgoingPacket;
+
+        /// Fill the header fields of p_Packet and count its bytes in m_QueuedBytes.
+        /// @return false if the send queue is full
+        bool ReserveOutgoingPacket(WorldPacket const& pct, OutgoingPacket& p_Packet);
 
         /// process one incoming packet.
         /// @param new_pct received packet, note that you need to delete it.
         int ProcessIncoming (WorldPacket* new_pct);
 
-        /// Called by ProcessIncoming() on CMSG_AUTH_SESSION.
+        /// Called by ProcessIncoming() on CMSG_AUTH_SESSION, queries the account and parks the socket.
         int HandleAuthSession (WorldPacket& recvPacket);
 
+        /// Called by Update() when the account query of HandleAuthSession() is done.
+        int HandleAuthSessionCallback (PreparedQueryResult result);
+
+        /// Hand the session to the world if it's still waiting for its account data.
+        /// A session of a closed socket is handed too, the world deletes it.
+        /// @note m_SessionLock must be held
+        void AddPendingSession();
+
         /// Called by ProcessIncoming() on CMSG_PING.
         int HandlePing (WorldPacket& recvPacket);
 
@@ -189,19 +220,68 @@ class WorldSocket : public WorldHandler
         ACE_Message_Block m_Header;
         ACE_Message_Block m_WorldHeader;
 
-        /// Mutex for protecting output related data.
+        /// Packet waiting to be written on the socket.
+        struct OutgoingPacket
+        {
+            /// Packet shared with other sockets, null for unicast packets
+            SharedWorldPacket Packet;
+            /// Payload of a unicast packet
+            std::vector<uint8> Payload;
+            /// Header and payload bytes
+            size_t Length;
+            uint32 Size;
+            uint16 Opcode;
+            /// Encryption state when the packet was sent, the header is built later by the network thread
+            bool Encrypt;
+            uint8 Header[4];
+            /// Bytes of header and payload already written
+            size_t Written;
+        };
+
+        /// Packets pushed by any thread, only the network thread pops them.
+        MPSCQueue<OutgoingPacket> m_PacketQueue;
+
+        /// Bytes pushed to m_PacketQueue and not written yet.
+        std::atomic<size_t> m_QueuedBytes;
+
+        /// Mutex for protecting output related data, producers never take it.
         LockType m_OutBufferLock;
 
-        /// Buffer used for writing output.
-        ACE_Message_Block* m_OutBuffer;
+        /// Packets with their header built, in sending order.
+        std::deque<OutgoingPacket> m_SendQueue;
 
-        /// Size of the m_OutBuffer.
+        /// Maximum bytes gathered in one write.
         size_t m_OutBufferSize;
 
+        /// Prevents a second call to open.
+        bool m_Opened;
+
         /// True if the socket is registered with the reactor for output
         bool m_OutActive;
 
         uint32 m_Seed;
+
+        /// CMSG_AUTH_SESSION content kept while its account query runs
+        struct PendingAuthSession
+        {
+            std::string AccountName;
+            uint32 ClientSeed;
+            uint8 ClientAuthChallenge[20];
+            uint16 ClientBuild;
+            WorldPacket AddonsCompressedData;
+        };
+
+        /// Set from CMSG_AUTH_SESSION until the account query result is handled.
+        std::unique_ptr<PendingAuthSession> m_PendingAuth;
+        PreparedQueryResultFuture m_AuthQuery;
+
+        /// Data received while m_PendingAuth is set, it can only be read once the crypt is initialized.
+        std::string m_PendingInput;
+
+        /// Set once m_Session is created until it's added to the world, when the queries below are done.
+        bool m_SessionPending;
+        PreparedQueryResultFuture m_AccountDataQuery;
+        PreparedQueryResultFuture m_TutorialsQuery;
 };
 
 #endif  /* _WORLDSOCKET_H */
@@ -2438,6 +2438,27 @@ void Spell::SearchAreaTargets(std::list<WorldObject*>& targets, float range, Pos
     if (!containerTypeMask)
         return;
     JadeCore::WorldObjectSpellAreaTargetCheck check(range, position, m_caster, referer, m_spellInfo, selectionType, condList);
+
+    /// Units only, the check includes the target size so the spatial index of the map finds every candidate
+    if (!(containerTypeMask & ~(GRID_MAP_TYPE_MASK_CREATURE | GRID_MAP_TYPE_MASK_PLAYER)))
+    {
+        /// Same phase filter as the list searcher
+        uint32 l_PhaseMask = m_caster->GetPhaseMask();
+
+        referer->GetMap()->GetUnitSpatialIndex().Visit(position->GetPositionX(), position->GetPositionY(), range, [&](Unit* p_Unit) -> void
+        {
+            if (!(containerTypeMask & (p_Unit->IsPlayer() ? GRID_MAP_TYPE_MASK_PLAYER : GRID_MAP_TYPE_MASK_CREATURE)))
+                return;
+
+            if (!p_Unit->InSamePhase(l_PhaseMask))
+                return;
+
+            if (check(p_Unit))
+                targets.push_back(p_Unit);
+        });
+        return;
+    }
+
     JadeCore::WorldObjectListSearcher<JadeCore::WorldObjectSpellAreaTargetCheck> searcher(m_caster, targets, check, containerTypeMask);
     SearchTargets<JadeCore::WorldObjectListSearcher<JadeCore::WorldObjectSpellAreaTargetCheck> > (searcher, containerTypeMask, m_caster, position, range);
 }
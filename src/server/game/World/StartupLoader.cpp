@@ -0,0 +1,146 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Project-Hellscream https://hellscream.org
+// Copyright (C) 2018-2020 Project-Hellscream-6.2
+// Discord https://discord.gg/CWCF3C9
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include "StartupLoader.h"
+#include "Errors.h"
+#include "Log.h"
+#include "Timer.h"
+#include <algorithm>
+#include <thread>
+
+StartupLoader::StartupLoader(std::string const& p_Name, uint32 p_Threads)
+    : m_Name(p_Name), m_Threads(p_Threads), m_FirstPending(0), m_RunTime(0), m_Remaining(0)
+{
+    if (!m_Threads)
+        m_Threads = std::max<uint32>(std::thread::hardware_concurrency(), 1);
+}
+
+uint32 StartupLoader::AddStep(std::string const& p_Name, StepFunction const& p_Function, std::vector<uint32> const& p_Dependencies)
+{
+    uint32 l_Id = m_Steps.size();
+
+    Step l_Step;
+    l_Step.Name                = p_Name;
+    l_Step.Function            = p_Function;
+    l_Step.PendingDependencies = 0;
+    l_Step.Time                = 0;
+    m_Steps.push_back(l_Step);
+
+    for (uint32 l_Dependency : p_Dependencies)
+    {
+        ASSERT(l_Dependency < l_Id);
+
+        /// Steps of a previous Run are already done
+        if (l_Dependency < m_FirstPending)
+            continue;
+
+        m_Steps[l_Dependency].Dependents.push_back(l_Id);
+        ++m_Steps[l_Id].PendingDependencies;
+    }
+
+    return l_Id;
+}
+
+void StartupLoader::ExecuteStep(uint32 p_Id)
+{
+    Step& l_Step = m_Steps[p_Id];
+
+    uint32 l_StartTime = getMSTime();
+    l_Step.Function();
+    l_Step.Time = GetMSTimeDiffToNow(l_StartTime);
+}
+
+void StartupLoader::WorkerThread()
+{
+    std::unique_lock<std::mutex> l_Lock(m_Lock);
+
+    while (true)
+    {
+        m_Condition.wait(l_Lock, [this]() { return !m_Ready.empty() || !m_Remaining; });
+
+        if (!m_Remaining)
+            return;
+
+        uint32 l_Id = m_Ready.front();
+        m_Ready.pop_front();
+
+        l_Lock.unlock();
+        ExecuteStep(l_Id);
+        l_Lock.lock();
+
+        --m_Remaining;
+
+        for (uint32 l_Dependent : m_Steps[l_Id].Dependents)
+        {
+            if (!--m_Steps[l_Dependent].PendingDependencies)
+                m_Ready.push_back(l_Dependent);
+        }
+
+        m_Condition.notify_all();
+    }
+}
+
+void StartupLoader::Run()
+{
+    uint32 l_End = m_Steps.size();
+    if (m_FirstPending == l_End)
+        return;
+
+    uint32 l_StartTime = getMSTime();
+
+    if (m_Threads <= 1)
+    {
+        /// Dependencies always point to earlier steps, the insertion order is a valid order
+        for (uint32 l_I = m_FirstPending; l_I < l_End; ++l_I)
+            ExecuteStep(l_I);
+    }
+    else
+    {
+        m_Remaining = l_End - m_FirstPending;
+
+        for (uint32 l_I = m_FirstPending; l_I < l_End; ++l_I)
+        {
+            if (!m_Steps[l_I].PendingDependencies)
+                m_Ready.push_back(l_I);
+        }
+
+        uint32 l_ThreadCount = std::min<uint32>(m_Threads, m_Remaining);
+
+        std::vector<std::thread> l_Threads;
+        for (uint32 l_I = 1; l_I < l_ThreadCount; ++l_I)
+            l_Threads.push_back(std::thread(&StartupLoader::WorkerThread, this));
+
+        /// The calling thread takes part
+        WorkerThread();
+
+        for (std::thread& l_Thread : l_Threads)
+            l_Thread.join();
+    }
+
+    m_FirstPending = l_End;
+    m_RunTime += GetMSTimeDiffToNow(l_StartTime);
+}
+
+void StartupLoader::LogTimings(uint32 p_Count) const
+{
+    std::vector<std::pair<uint32, uint32>> l_Times;
+    uint32 l_TotalTime = 0;
+
+    for (uint32 l_I = 0; l_I < m_FirstPending; ++l_I)
+    {
+        l_Times.push_back(std::make_pair(m_Steps[l_I].Time, l_I));
+        l_TotalTime += m_Steps[l_I].Time;
+    }
+
+    std::sort(l_Times.begin(), l_Times.end(), std::greater<std::pair<uint32, uint32>>());
+
+    sLog->outInfo(LOG_FILTER_SERVER_LOADING, ">> %s: %u steps in %u ms on %u threads (%u ms of work)", m_Name.c_str(), m_FirstPending, m_RunTime, m_Threads, l_TotalTime);
+
+    for (uint32 l_I = 0; l_I < l_Times.size() && l_I < p_Count; ++l_I)
+        sLog->outInfo(LOG_FILTER_SERVER_LOADING, "   %-40s %6u ms", m_Steps[l_Times[l_I].second].Name.c_str(), l_Times[l_I].first);
+}
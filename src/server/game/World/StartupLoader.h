@@ -0,0 +1,63 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Project-Hellscream https://hellscream.org
+// Copyright (C) 2018-2020 Project-Hellscream-6.2
+// Discord https://discord.gg/CWCF3C9
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _STARTUP_LOADER_H
+#define _STARTUP_LOADER_H
+
+#include "Common.h"
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+
+/// Startup task graph, a step starts once every step it depends on is done and independent steps run
+/// concurrently. Steps are queued with AddStep and executed by Run, which can be called several times
+/// to keep serial code between two batches. Every step is timed for LogTimings.
+class StartupLoader
+{
+    public:
+        typedef std::function<void()> StepFunction;
+
+        /// p_Threads includes the calling thread, 0 for one per core, 1 runs the steps in insertion order
+        StartupLoader(std::string const& p_Name, uint32 p_Threads);
+
+        /// p_Dependencies are ids returned by previous AddStep calls
+        uint32 AddStep(std::string const& p_Name, StepFunction const& p_Function, std::vector<uint32> const& p_Dependencies = std::vector<uint32>());
+
+        /// Executes the queued steps and returns once they are all done
+        void Run();
+
+        /// Logs the time spent in Run and the p_Count slowest steps
+        void LogTimings(uint32 p_Count) const;
+
+    private:
+        struct Step
+        {
+            std::string Name;
+            StepFunction Function;
+            std::vector<uint32> Dependents;
+            uint32 PendingDependencies;
+            uint32 Time;                                        ///< Milliseconds
+        };
+
+        void ExecuteStep(uint32 p_Id);
+        void WorkerThread();
+
+        std::string m_Name;
+        uint32 m_Threads;
+        std::vector<Step> m_Steps;
+        uint32 m_FirstPending;                                  ///< Steps before this one already ran
+        uint32 m_RunTime;                                       ///< Milliseconds
+
+        std::mutex m_Lock;
+        std::condition_variable m_Condition;
+        std::deque<uint32> m_Ready;
+        uint32 m_Remaining;
+};
+
+#endif
@@ -94,6 +94,9 @@
 #include "MMapFactory.h"
 #include "TaxiPathGraph.h"
 #include "ChatLexicsCutter.h"
+#include "OpcodeProfiler.h"
+#include "StartupLoader.h"
+#include "WorldSnapshot.h"
 #include <ctime>
 #include "../scripts/Custom/SpellRegulator.h"
 
@@ -663,6 +666,7 @@ void World::LoadConfigSettings(bool reload)
     m_bool_configs[CONFIG_PRESERVE_CUSTOM_CHANNELS] = ConfigMgr::GetBoolDefault("PreserveCustomChannels", false);
     m_int_configs[CONFIG_PRESERVE_CUSTOM_CHANNEL_DURATION] = ConfigMgr::GetIntDefault("PreserveCustomChannelDuration", 14);
     m_bool_configs[CONFIG_GRID_UNLOAD] = ConfigMgr::GetBoolDefault("GridUnload", true);
+    m_bool_configs[CONFIG_GRID_PREFETCH] = ConfigMgr::GetBoolDefault("GridPrefetch", true);
     m_int_configs[CONFIG_INTERVAL_SAVE] = ConfigMgr::GetIntDefault("PlayerSaveInterval", 15 * MINUTE * IN_MILLISECONDS);
     m_int_configs[CONFIG_INTERVAL_DISCONNECT_TOLERANCE] = ConfigMgr::GetIntDefault("DisconnectToleranceInterval", 0);
     m_bool_configs[CONFIG_STATS_SAVE_ONLY_ON_LOGOUT] = ConfigMgr::GetBoolDefault("PlayerSave.Stats.SaveOnlyOnLogout", true);
@@ -704,7 +708,6 @@ void World::LoadConfigSettings(bool reload)
         m_int_configs[CONFIG_PORT_WORLD] = ConfigMgr::GetIntDefault("WorldServerPort", 8085);
 
     m_int_configs[CONFIG_SOCKET_TIMEOUTTIME] = ConfigMgr::GetIntDefault("SocketTimeOutTime", 900000);
-    m_int_configs[CONFIG_SESSION_ADD_DELAY] = ConfigMgr::GetIntDefault("SessionAddDelay", 10000);
 
     m_float_configs[CONFIG_GROUP_XP_DISTANCE] = ConfigMgr::GetFloatDefault("MaxGroupXPDistance", 74.0f);
     m_float_configs[CONFIG_INSTANCE_GROUP_XP_DISTANCE] = ConfigMgr::GetFloatDefault("MaxInstanceGroupXPDistance", 150.0f);
@@ -1315,6 +1318,7 @@ void World::LoadConfigSettings(bool reload)
     m_int_configs[CONFIG_INTERVAL_LOG_UPDATE] = ConfigMgr::GetIntDefault("RecordUpdateTimeDiffInterval", 60000);
     m_int_configs[CONFIG_MIN_LOG_UPDATE] = ConfigMgr::GetIntDefault("MinRecordUpdateTimeDiff", 100);
     m_int_configs[CONFIG_NUMTHREADS] = ConfigMgr::GetIntDefault("MapUpdate.Threads", 1);
+    m_int_configs[CONFIG_STARTUP_LOADER_THREADS] = ConfigMgr::GetIntDefault("Startup.LoaderThreads", 4);
     m_int_configs[CONFIG_MAX_RESULTS_LOOKUP_COMMANDS] = ConfigMgr::GetIntDefault("Command.LookupMaxResults", 0);
 
     // chat logging
@@ -1366,6 +1370,20 @@ void World::LoadConfigSettings(bool reload)
     // MySQL ping time interval
     m_int_configs[CONFIG_DB_PING_INTERVAL] = ConfigMgr::GetIntDefault("MaxPingTime", 30);
 
+    /// World database snapshot, only read at startup
+    m_bool_configs[CONFIG_WORLD_SNAPSHOT] = ConfigMgr::GetBoolDefault("WorldSnapshot.Enable", false);
+
+    /// Opcode profiler
+    m_bool_configs[CONFIG_OPCODE_PROFILER] = ConfigMgr::GetBoolDefault("OpcodeProfiler.Enable", false);
+    m_int_configs[CONFIG_OPCODE_PROFILER_DUMP_INTERVAL] = ConfigMgr::GetIntDefault("OpcodeProfiler.DumpInterval", 0);
+    sOpcodeProfiler->SetDumpFile(ConfigMgr::GetStringDefault("OpcodeProfiler.DumpFile", "opcode_profile.log"));
+    sOpcodeProfiler->SetEnabled(m_bool_configs[CONFIG_OPCODE_PROFILER]);
+    if (reload)
+    {
+        m_timers[WUPDATE_OPCODE_PROFILER].SetInterval(m_int_configs[CONFIG_OPCODE_PROFILER_DUMP_INTERVAL] * MINUTE * IN_MILLISECONDS);
+        m_timers[WUPDATE_OPCODE_PROFILER].Reset();
+    }
+
     //Reset Duel Cooldown
     m_bool_configs[CONFIG_DUEL_RESET_COOLDOWN_ON_START] = ConfigMgr::GetBoolDefault("DuelReset.Cooldown.OnStart", false);
     m_bool_configs[CONFIG_DUEL_RESET_COOLDOWN_ON_FINISH] = ConfigMgr::GetBoolDefault("DuelReset.Cooldown.OnFinish", false);
@@ -1632,22 +1650,30 @@ void World::SetInitialWorldSettings()
 
     uint32 oldMSTime = getMSTime();
 
+    if (getBoolConfig(CONFIG_WORLD_SNAPSHOT))
+    {
+        sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading world snapshot...");
+        sWorldSnapshot->Open(ConfigMgr::GetStringDefault("WorldSnapshot.File", "world.snapshot"));
+    }
+
     sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Creature Texts...");
     sCreatureTextMgr->LoadCreatureTexts();
 
+    /// Groups of loaders filling their own containers from the database, they run concurrently
+    StartupLoader l_Loader("World tables", getIntConfig(CONFIG_STARTUP_LOADER_THREADS));
+
     if (sWorld->getBoolConfig(CONFIG_ENABLE_LOCALES))
     {
         sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Localization strings...");
-        sObjectMgr->LoadCreatureLocales();
-        sObjectMgr->LoadGameObjectLocales();
-        sObjectMgr->LoadQuestLocales();
-        sObjectMgr->LoadNpcTextLocales();
-        sObjectMgr->LoadPageTextLocales();
-        sObjectMgr->LoadGossipMenuItemsLocales();
-        sObjectMgr->LoadPointOfInterestLocales();
-
-        sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Creature Text Locales...");
-        sCreatureTextMgr->LoadCreatureTextLocales();
+        l_Loader.AddStep("CreatureLocales",         []() { sObjectMgr->LoadCreatureLocales();             });
+        l_Loader.AddStep("GameObjectLocales",       []() { sObjectMgr->LoadGameObjectLocales();           });
+        l_Loader.AddStep("QuestLocales",            []() { sObjectMgr->LoadQuestLocales();                });
+        l_Loader.AddStep("NpcTextLocales",          []() { sObjectMgr->LoadNpcTextLocales();              });
+        l_Loader.AddStep("PageTextLocales",         []() { sObjectMgr->LoadPageTextLocales();             });
+        l_Loader.AddStep("GossipMenuItemsLocales",  []() { sObjectMgr->LoadGossipMenuItemsLocales();      });
+        l_Loader.AddStep("PointOfInterestLocales",  []() { sObjectMgr->LoadPointOfInterestLocales();      });
+        l_Loader.AddStep("CreatureTextLocales",     []() { sCreatureTextMgr->LoadCreatureTextLocales();   });
+        l_Loader.Run();
     }
 
     sObjectMgr->SetDBCLocaleIndex(GetDefaultDbcLocale());        // Get once for all the locale index of DBC language (console/broadcasts)
@@ -1756,29 +1782,17 @@ void World::SetInitialWorldSettings()
     sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Creature template addons...");
     sObjectMgr->LoadCreatureTemplateAddons();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Reputation Reward Rates...");
-    sObjectMgr->LoadReputationRewardRate();
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Currency Loot Templates...");
-    sObjectMgr->LoadCurrencyOnKill();
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Currency Loot Templates Personnal...");
-    sObjectMgr->LoadPersonnalCurrencyOnKill();
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Creature Reputation OnKill Data...");
-    sObjectMgr->LoadReputationOnKill();
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Reputation Spillover Data...");
-    sObjectMgr->LoadReputationSpilloverTemplate();
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Points Of Interest Data...");
-    sObjectMgr->LoadPointsOfInterest();
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Creature Base Stats...");
-    sObjectMgr->LoadCreatureClassLevelStats();
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Creature Group Size Stats...");
-    sObjectMgr->LoadCreatureGroupSizeStats();
+    /// Only read the creature templates and the DBCs
+    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Reputation, Currency OnKill, Points Of Interest and Creature Base Stats...");
+    l_Loader.AddStep("ReputationRewardRate",        []() { sObjectMgr->LoadReputationRewardRate();        });
+    l_Loader.AddStep("CurrencyOnKill",              []() { sObjectMgr->LoadCurrencyOnKill();              });
+    l_Loader.AddStep("PersonnalCurrencyOnKill",     []() { sObjectMgr->LoadPersonnalCurrencyOnKill();     });
+    l_Loader.AddStep("ReputationOnKill",            []() { sObjectMgr->LoadReputationOnKill();            });
+    l_Loader.AddStep("ReputationSpilloverTemplate", []() { sObjectMgr->LoadReputationSpilloverTemplate(); });
+    l_Loader.AddStep("PointsOfInterest",            []() { sObjectMgr->LoadPointsOfInterest();            });
+    l_Loader.AddStep("CreatureClassLevelStats",     []() { sObjectMgr->LoadCreatureClassLevelStats();     });
+    l_Loader.AddStep("CreatureGroupSizeStats",      []() { sObjectMgr->LoadCreatureGroupSizeStats();      });
+    l_Loader.Run();
 
     sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Creature Data...");
     sObjectMgr->LoadCreatures();
@@ -2041,23 +2055,15 @@ void World::SetInitialWorldSettings()
     sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Conditions...");
     sConditionMgr->LoadConditions();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading faction change achievement pairs...");
-    sObjectMgr->LoadFactionChangeAchievements();
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading faction change spell pairs...");
-    sObjectMgr->LoadFactionChangeSpells();
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading faction change item pairs...");
-    sObjectMgr->LoadFactionChangeItems();
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading faction change reputation pairs...");
-    sObjectMgr->LoadFactionChangeReputations();
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading faction change title pairs...");
-    sObjectMgr->LoadFactionChangeTitles();
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading faction change title pairs...");
-    sObjectMgr->LoadFactionChangeQuests();
+    /// Only read the templates and the DBCs, every loader fills its own map
+    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading faction change achievement, spell, item, reputation, title and quest pairs...");
+    l_Loader.AddStep("FactionChangeAchievements",   []() { sObjectMgr->LoadFactionChangeAchievements();   });
+    l_Loader.AddStep("FactionChangeSpells",         []() { sObjectMgr->LoadFactionChangeSpells();         });
+    l_Loader.AddStep("FactionChangeItems",          []() { sObjectMgr->LoadFactionChangeItems();          });
+    l_Loader.AddStep("FactionChangeReputations",    []() { sObjectMgr->LoadFactionChangeReputations();    });
+    l_Loader.AddStep("FactionChangeTitles",         []() { sObjectMgr->LoadFactionChangeTitles();         });
+    l_Loader.AddStep("FactionChangeQuests",         []() { sObjectMgr->LoadFactionChangeQuests();         });
+    l_Loader.Run();
 
 #ifndef CROSS
     sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading GM tickets...");
@@ -2159,6 +2165,8 @@ void World::SetInitialWorldSettings()
 
     m_timers[WUPDATE_REALM_STATS].SetInterval(MINUTE * IN_MILLISECONDS);
 
+    m_timers[WUPDATE_OPCODE_PROFILER].SetInterval(getIntConfig(CONFIG_OPCODE_PROFILER_DUMP_INTERVAL) * MINUTE * IN_MILLISECONDS);
+
 #ifndef CROSS
     m_timers[WUPDATE_BLACKMARKET].SetInterval(MINUTE * IN_MILLISECONDS);
     m_timers[WUPDATE_TRANSFER].SetInterval(10 * IN_MILLISECONDS);
@@ -2326,6 +2334,8 @@ void World::SetInitialWorldSettings()
     InitServerAutoRestartTime();
 
     uint32 startupDuration = GetMSTimeDiffToNow(startupBegin);
+    l_Loader.LogTimings(10);
+    sWorldSnapshot->Close();
 
     QueryResult l_Result = LoginDatabase.PQuery("SELECT max(id) FROM account_log_ip");
     if (l_Result)
@@ -2378,6 +2388,20 @@ void World::RecordTimeDiff(const char *text, ...)
     m_currentTime = thisTime;
 }
 
+/// Same as above for a duration measured elsewhere, e.g. by a map updater thread
+void World::RecordTimeDiff(uint32 p_Diff, const char* p_Text, ...)
+{
+    if (m_updateTimeCount != 1 || p_Diff <= m_int_configs[CONFIG_MIN_LOG_UPDATE])
+        return;
+
+    va_list l_Args;
+    char l_Str[256];
+    va_start(l_Args, p_Text);
+    vsnprintf(l_Str, 256, p_Text, l_Args);
+    va_end(l_Args);
+    sLog->outInfo(LOG_FILTER_GENERAL, "Difftime %s: %u.", l_Str, p_Diff);
+}
+
 void World::LoadAutobroadcasts()
 {
     uint32 oldMSTime = getMSTime();
@@ -2682,6 +2706,15 @@ void World::Update(uint32 diff)
         m_timers[WUPDATE_EVENTS].Reset();
     }
 
+    ///- Dump the opcode profiler counters
+    if (getIntConfig(CONFIG_OPCODE_PROFILER_DUMP_INTERVAL) && m_timers[WUPDATE_OPCODE_PROFILER].Passed())
+    {
+        m_timers[WUPDATE_OPCODE_PROFILER].Reset();
+
+        if (sOpcodeProfiler->IsEnabled())
+            sOpcodeProfiler->DumpToFile();
+    }
+
     ///- Ping to keep MySQL connections alive
     if (m_timers[WUPDATE_PINGDB].Passed())
     {
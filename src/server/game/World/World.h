@@ -83,6 +83,7 @@ enum WorldTimers
     WUPDATE_PINGDB,
     WUPDATE_GUILDSAVE,
     WUPDATE_REALM_STATS,
+    WUPDATE_OPCODE_PROFILER,
 #ifndef CROSS
     WUPDATE_TRANSFER,
     WUPDATE_TRANSFER_EXP,
@@ -99,6 +100,9 @@ enum WorldBoolConfigs
     CONFIG_ALLOW_PLAYER_COMMANDS,
     CONFIG_CLEAN_CHARACTER_DB,
     CONFIG_GRID_UNLOAD,
+    CONFIG_GRID_PREFETCH,
+    CONFIG_OPCODE_PROFILER,
+    CONFIG_WORLD_SNAPSHOT,
     CONFIG_STATS_SAVE_ONLY_ON_LOGOUT,
     CONFIG_ALLOW_TWO_SIDE_ACCOUNTS,
     CONFIG_ALLOW_TWO_SIDE_INTERACTION_CALENDAR,
@@ -259,7 +263,6 @@ enum WorldIntConfigs
     CONFIG_INTERVAL_DISCONNECT_TOLERANCE,
     CONFIG_PORT_WORLD,
     CONFIG_SOCKET_TIMEOUTTIME,
-    CONFIG_SESSION_ADD_DELAY,
     CONFIG_GAME_TYPE,
     CONFIG_REALM_ZONE,
     CONFIG_STRICT_PLAYER_NAMES,
@@ -369,6 +372,7 @@ enum WorldIntConfigs
     CONFIG_ENABLE_SINFO_LOGIN,
     CONFIG_PLAYER_ALLOW_COMMANDS,
     CONFIG_NUMTHREADS,
+    CONFIG_STARTUP_LOADER_THREADS,
     CONFIG_LOGDB_CLEARINTERVAL,
     CONFIG_LOGDB_CLEARTIME,
     CONFIG_CLIENTCACHE_VERSION,
@@ -383,6 +387,7 @@ enum WorldIntConfigs
     CONFIG_AUTOBROADCAST_INTERVAL,
     CONFIG_MAX_RESULTS_LOOKUP_COMMANDS,
     CONFIG_DB_PING_INTERVAL,
+    CONFIG_OPCODE_PROFILER_DUMP_INTERVAL,
     CONFIG_PRESERVE_CUSTOM_CHANNEL_DURATION,
     CONFIG_PERSISTENT_CHARACTER_CLEAN_FLAGS,
     CONFIG_MAX_INSTANCES_PER_HOUR,
@@ -982,6 +987,7 @@ class World
         char const* GetDBVersion() const { return m_DBVersion.c_str(); }
 
         void RecordTimeDiff(const char * text, ...);
+        void RecordTimeDiff(uint32 p_Diff, const char* p_Text, ...);
 
         void LoadAutobroadcasts();
 
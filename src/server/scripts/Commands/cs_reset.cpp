@@ -77,7 +77,7 @@ public:
             player->SetShapeshiftForm(FORM_NONE);
 
         player->SetFloatValue(UNIT_FIELD_BOUNDING_RADIUS, DEFAULT_WORLD_OBJECT_SIZE);
-        player->SetFloatValue(UNIT_FIELD_COMBAT_REACH, DEFAULT_COMBAT_REACH);
+        player->SetCombatReach(DEFAULT_COMBAT_REACH);
 
         player->setFactionForRace(player->getRace());
 
@@ -19,6 +19,7 @@ EndScriptData */
 #include "Config.h"
 #include "ObjectAccessor.h"
 #include "MapManager.h"
+#include "OpcodeProfiler.h"
 #include <regex>
 
 class server_commandscript : public CommandScript
@@ -72,6 +73,7 @@ public:
             { "idleshutdown",   SEC_ADMINISTRATOR,  true,  NULL,                                    "", serverIdleShutdownCommandTable },
             { "info",           SEC_PLAYER,         true,  &HandleServerInfoCommand,                "", NULL },
             { "motd",           SEC_PLAYER,         true,  &HandleServerMotdCommand,                "", NULL },
+            { "opcodes",        SEC_ADMINISTRATOR,  true,  &HandleServerOpcodesCommand,             "", NULL },
             { "plimit",         SEC_ADMINISTRATOR,  true,  &HandleServerPLimitCommand,              "", NULL },
             { "restart",        SEC_ADMINISTRATOR,  true,  NULL,                                    "", serverRestartCommandTable },
             { "shutdown",       SEC_ADMINISTRATOR,  true,  NULL,                                    "", serverShutdownCommandTable },
@@ -297,6 +299,47 @@ public:
         return true;
     }
 
+    // Opcode profiler: on/off/reset/dump, or print the top N handlers and server opcodes
+    static bool HandleServerOpcodesCommand(ChatHandler* handler, char const* args)
+    {
+        if (strncmp(args, "on", 3) == 0)
+        {
+            sOpcodeProfiler->SetEnabled(true);
+            handler->SendSysMessage("Opcode profiler enabled.");
+            return true;
+        }
+        else if (strncmp(args, "off", 4) == 0)
+        {
+            sOpcodeProfiler->SetEnabled(false);
+            handler->SendSysMessage("Opcode profiler disabled.");
+            return true;
+        }
+        else if (strncmp(args, "reset", 6) == 0)
+        {
+            sOpcodeProfiler->Reset();
+            handler->SendSysMessage("Opcode profiler counters reset.");
+            return true;
+        }
+        else if (strncmp(args, "dump", 5) == 0)
+        {
+            sOpcodeProfiler->DumpToFile();
+            handler->SendSysMessage("Opcode profiler report written.");
+            return true;
+        }
+
+        int32 limit = *args ? atoi(args) : 15;
+        if (limit < 0)
+            return false;
+
+        std::vector<std::string> lines;
+        sOpcodeProfiler->BuildReport(lines, uint32(limit));
+
+        for (std::string const& line : lines)
+            handler->PSendSysMessage("%s", line.c_str());
+
+        return true;
+    }
+
 private:
     static bool ParseExitCode(std::string const& exitCodeStr, int32& exitCode)
     {
@@ -55,9 +55,12 @@ namespace MS { namespace UserReporting
     class ServerUserReporting : public ServerScript
     {
         public :
-            ServerUserReporting() : ServerScript("ServerUserReporting") {}
+            ServerUserReporting() : ServerScript("ServerUserReporting")
+            {
+                RegisterPacketReceiveHook(CMSG_LOAD_SCREEN);
+            }
 
-            void OnPacketReceive(WorldSocket* /*p_Socket*/, WorldPacket& p_Packet, WorldSession* p_Session) override
+            void OnPacketReceive(WorldSocket* /*p_Socket*/, WorldPacket const& p_Packet, WorldSession* p_Session) override
             {
                 if (p_Session != nullptr && p_Packet.GetOpcode() == CMSG_LOAD_SCREEN)
                     UpdateUserStep(p_Session, State::LoadScreen);
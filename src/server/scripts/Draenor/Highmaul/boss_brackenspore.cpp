@@ -907,7 +907,7 @@ class npc_highmaul_fungal_flesh_eater : public CreatureScript
                 {
                     me->SetFloatValue(EObjectFields::OBJECT_FIELD_SCALE, 1.0f);
                     me->SetFloatValue(EUnitFields::UNIT_FIELD_BOUNDING_RADIUS, 0.31f);
-                    me->SetFloatValue(EUnitFields::UNIT_FIELD_COMBAT_REACH, 7.0f);
+                    me->SetCombatReach(7.0f);
                 });
 
                 AddTimedDelayedOperation(5 * TimeConstants::IN_MILLISECONDS, [this]() -> void { me->PlayOneShotAnimKit(eData::AnimKit); });
@@ -77,7 +77,7 @@ namespace MS
                     me->SetSpeed(MOVE_WALK, 0.35f);
                     me->SetSpeed(MOVE_RUN, 0.3f);
                     me->SetSpeed(MOVE_FLIGHT, 0.3f);
-                    me->SetFloatValue(UNIT_FIELD_COMBAT_REACH, 0);
+                    me->SetCombatReach(0);
                     me->SetFloatValue(UNIT_FIELD_BOUNDING_RADIUS, 0);
                     me->SetReactState(REACT_PASSIVE);
                 }
@@ -315,7 +315,7 @@ class npc_energized_phoenix : public CreatureScript
                 me->SetSpeed(MOVE_WALK, 2.0f);
                 me->SetSpeed(MOVE_RUN, 2.0f);
                 me->SetSpeed(MOVE_FLIGHT, 2.0f);
-                me->SetFloatValue(UNIT_FIELD_COMBAT_REACH, 0);
+                me->SetCombatReach(0);
                 me->SetFloatValue(UNIT_FIELD_BOUNDING_RADIUS, 0);
                 me->SetReactState(REACT_PASSIVE);
                 m_KilledByPlayer = true;
@@ -296,7 +296,7 @@ class boss_chogall : public CreatureScript
                 summons.DespawnAll();
                 SetEquipmentSlots(false, EQUIPMENT_ID_WEAPON, 0, 0);
                 me->SetFloatValue(UNIT_FIELD_BOUNDING_RADIUS, 10);
-                me->SetFloatValue(UNIT_FIELD_COMBAT_REACH, 10);
+                me->SetCombatReach(10);
                 DoCorruption(CORRUPTION_CLEAR);
                 bPhase2 = false;
                 uiOrder = 0;
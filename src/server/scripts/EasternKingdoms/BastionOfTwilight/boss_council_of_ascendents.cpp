@@ -329,7 +329,7 @@ class boss_feludius : public CreatureScript
                 bPhaseTwo  = false;
                 me->RemoveFlag(UNIT_FIELD_FLAGS, UNIT_FLAG_NON_ATTACKABLE);
                 me->SetFloatValue(UNIT_FIELD_BOUNDING_RADIUS, 10);
-                me->SetFloatValue(UNIT_FIELD_COMBAT_REACH, 10);
+                me->SetCombatReach(10);
                 me->SetReactState(REACT_AGGRESSIVE);
                 summons.DespawnAll();
                 events.Reset();
@@ -551,7 +551,7 @@ class boss_ignacious : public CreatureScript
                 bPhaseTwo = false;
                 me->RemoveFlag(UNIT_FIELD_FLAGS, UNIT_FLAG_NON_ATTACKABLE);
                 me->SetFloatValue(UNIT_FIELD_BOUNDING_RADIUS, 10);
-                me->SetFloatValue(UNIT_FIELD_COMBAT_REACH, 10);
+                me->SetCombatReach(10);
                 me->SetReactState(REACT_AGGRESSIVE);
                 //summons.DespawnAll();
                 events.Reset();
@@ -830,7 +830,7 @@ class boss_arion : public CreatureScript
                 SetCombatMovement(false);
                 me->SetFlag(UNIT_FIELD_FLAGS, UNIT_FLAG_NON_ATTACKABLE);
                 me->SetFloatValue(UNIT_FIELD_BOUNDING_RADIUS, 10);
-                me->SetFloatValue(UNIT_FIELD_COMBAT_REACH, 10);
+                me->SetCombatReach(10);
                 summons.DespawnAll();
                 events.Reset();
             }
@@ -1023,7 +1023,7 @@ class boss_terrastra : public CreatureScript
                 me->SetReactState(REACT_PASSIVE);
                 me->SetFlag(UNIT_FIELD_FLAGS, UNIT_FLAG_NON_ATTACKABLE);
                 me->SetFloatValue(UNIT_FIELD_BOUNDING_RADIUS, 10);
-                me->SetFloatValue(UNIT_FIELD_COMBAT_REACH, 10);
+                me->SetCombatReach(10);
                 summons.DespawnAll();
                 events.Reset();
             }
@@ -1188,7 +1188,7 @@ class boss_elementium_monstrosity : public CreatureScript
             void Reset()
             {
                 me->SetFloatValue(UNIT_FIELD_BOUNDING_RADIUS, 10);
-                me->SetFloatValue(UNIT_FIELD_COMBAT_REACH, 10);
+                me->SetCombatReach(10);
 
                 summons.DespawnAll();
                 events.Reset();
@@ -178,7 +178,7 @@ class boss_halfus_wyrmbreaker : public CreatureScript
 
                 SetEquipmentSlots(false, EQUIPMENT_ONE, 0, 0);
                 me->SetFloatValue(UNIT_FIELD_BOUNDING_RADIUS, 10);
-                me->SetFloatValue(UNIT_FIELD_COMBAT_REACH, 10);
+                me->SetCombatReach(10);
                 bRoar = false;
                 bWhelps = false;
                 events.Reset();
@@ -279,7 +279,7 @@ class boss_sinestra : public CreatureScript
                 eggs = 0;
 
                 me->SetFloatValue(UNIT_FIELD_BOUNDING_RADIUS, 15);
-                me->SetFloatValue(UNIT_FIELD_COMBAT_REACH, 15);
+                me->SetCombatReach(15);
 
                 me->SetHealth(RAID_MODE(SINESTRA_HEALTH_10H, SINESTRA_HEALTH_25H, SINESTRA_HEALTH_10H, SINESTRA_HEALTH_25H));
 
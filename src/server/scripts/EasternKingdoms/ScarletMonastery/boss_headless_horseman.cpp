@@ -200,7 +200,7 @@ public:
 		{
 			phase = 0;
 			events.Reset();
-			me->SetFloatValue(UNIT_FIELD_COMBAT_REACH, 5);
+			me->SetCombatReach(5);
 			me->SetFloatValue(UNIT_FIELD_BOUNDING_RADIUS, 5);
 			me->RemoveFlag(UNIT_FIELD_FLAGS, UNIT_FLAG_NON_ATTACKABLE | UNIT_FLAG_NOT_SELECTABLE | UNIT_FLAG_IMMUNE_TO_PC);
 			DoCast(me, SPELL_HEAD, true);
@@ -135,7 +135,7 @@ public:
 
             me->SetDisableGravity(true);
             me->SetFloatValue(UNIT_FIELD_BOUNDING_RADIUS, 10);
-            me->SetFloatValue(UNIT_FIELD_COMBAT_REACH, 10);
+            me->SetCombatReach(10);
 
             DespawnSummons(MOB_VAPOR_TRAIL);
             me->setActive(false);
@@ -81,7 +81,7 @@ class boss_echo_of_baine : public CreatureScript
             {
                 _Reset();
                 me->SetFloatValue(UNIT_FIELD_BOUNDING_RADIUS, 5.0f);
-                me->SetFloatValue(UNIT_FIELD_COMBAT_REACH, 5.0f);
+                me->SetCombatReach(5.0f);
             }
 
             void EnterCombat(Unit* /*who*/)
@@ -99,7 +99,7 @@ class boss_hadronox : public CreatureScript
             {
                 me->SetReactState(REACT_PASSIVE);
                 me->SetFloatValue(UNIT_FIELD_BOUNDING_RADIUS, 9.0f);
-                me->SetFloatValue(UNIT_FIELD_COMBAT_REACH, 9.0f);
+                me->SetCombatReach(9.0f);
                 me->GetMotionMaster()->Clear();
                 me->GetMotionMaster()->MovePoint(50,me->GetHomePosition());
 
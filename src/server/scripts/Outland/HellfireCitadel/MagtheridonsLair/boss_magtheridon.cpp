@@ -210,7 +210,7 @@ class boss_magtheridon : public CreatureScript
             {
                 instance = creature->GetInstanceScript();
                 me->SetFloatValue(UNIT_FIELD_BOUNDING_RADIUS, 10);
-                me->SetFloatValue(UNIT_FIELD_COMBAT_REACH, 10);
+                me->SetCombatReach(10);
             }
 
             CubeMap Cube;
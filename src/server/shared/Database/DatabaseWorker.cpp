@@ -12,9 +12,13 @@
 #include "MySQLConnection.h"
 #include "MySQLThreading.h"
 
+/// Times a group of statements is replayed after losing its connection before falling back to one by one
+#define MAX_BATCH_ATTEMPTS 3
+
 DatabaseWorker::DatabaseWorker(ACE_Activation_Queue* new_queue, MySQLConnection* con) :
 m_queue(new_queue),
-m_conn(con)
+m_conn(con),
+m_BatchSize(0)
 {
     /// Assign thread to task
     activate();
@@ -26,13 +30,49 @@ int DatabaseWorker::svc()
         return -1;
 
     SQLOperation *request = NULL;
+    SQLOperation* l_Pending = NULL;
+    std::vector<SQLOperation*> l_Batch;
+
     while (1)
     {
-        request = (SQLOperation*)(m_queue->dequeue());
+        request = l_Pending ? l_Pending : (SQLOperation*)(m_queue->dequeue());
+        l_Pending = NULL;
         if (!request)
             break;
 
         request->SetConnection(m_conn);
+
+        uint32 l_BatchSize = m_BatchSize.load(std::memory_order_relaxed);
+        if (l_BatchSize > 1 && request->IsBatchable())
+        {
+            /// Take the one-way statements already waiting behind this one, without blocking
+            l_Batch.push_back(request);
+            while (l_Batch.size() < l_BatchSize)
+            {
+                ACE_Time_Value l_Now = ACE_OS::gettimeofday();
+                SQLOperation* l_Next = (SQLOperation*)(m_queue->dequeue(&l_Now));
+                if (!l_Next)
+                    break;
+
+                if (!l_Next->IsBatchable())
+                {
+                    l_Pending = l_Next;
+                    break;
+                }
+
+                l_Next->SetConnection(m_conn);
+                l_Batch.push_back(l_Next);
+            }
+
+            ExecuteBatch(l_Batch);
+
+            for (SQLOperation* l_Operation : l_Batch)
+                delete l_Operation;
+
+            l_Batch.clear();
+            continue;
+        }
+
         request->call();
 
         delete request;
@@ -40,3 +80,51 @@ int DatabaseWorker::svc()
 
     return 0;
 }
+
+void DatabaseWorker::ExecuteBatch(std::vector<SQLOperation*> const& p_Batch)
+{
+    if (p_Batch.size() == 1)
+    {
+        p_Batch.front()->call();
+        return;
+    }
+
+    /// A statement retried alone after a reconnection would run in autocommit, the ones before it being lost with
+    /// the transaction, so the whole group is replayed instead
+    m_conn->SetStatementRetry(false);
+
+    bool l_Committed = false;
+    for (uint32 l_Attempt = 0; l_Attempt < MAX_BATCH_ATTEMPTS && !l_Committed; ++l_Attempt)
+    {
+        uint32 l_Reconnects = m_conn->GetReconnectCount();
+
+        /// One commit for the whole group instead of one per statement
+        m_conn->BeginTransaction();
+
+        bool l_Failed = m_conn->GetReconnectCount() != l_Reconnects;
+        for (std::vector<SQLOperation*>::const_iterator l_Itr = p_Batch.begin(); l_Itr != p_Batch.end() && !l_Failed; ++l_Itr)
+            l_Failed = !(*l_Itr)->Execute();
+
+        if (!l_Failed)
+        {
+            m_conn->CommitTransaction();
+            l_Committed = m_conn->GetReconnectCount() == l_Reconnects;
+            continue;
+        }
+
+        m_conn->RollbackTransaction();
+
+        /// Not a lost connection, replaying the group would fail the same way
+        if (m_conn->GetReconnectCount() == l_Reconnects)
+            break;
+    }
+
+    m_conn->SetStatementRetry(true);
+
+    if (l_Committed)
+        return;
+
+    /// Statements were independent before being grouped, don't let a single failure drop the others
+    for (SQLOperation* l_Retry : p_Batch)
+        l_Retry->Execute();
+}
@@ -11,8 +11,13 @@
 
 #include <ace/Task.h>
 #include <ace/Activation_Queue.h>
+#include <atomic>
+#include <vector>
+
+#include "Define.h"
 
 class MySQLConnection;
+class SQLOperation;
 
 class DatabaseWorker : protected ACE_Task_Base
 {
@@ -23,10 +28,17 @@ class DatabaseWorker : protected ACE_Task_Base
         int svc();
         int wait() { return ACE_Task_Base::wait(); }
 
+        /// Max amount of queued one-way statements sent in a single transaction, 0 or 1 disables batching
+        void SetBatchSize(uint32 p_BatchSize) { m_BatchSize.store(p_BatchSize, std::memory_order_relaxed); }
+
     private:
         DatabaseWorker() : ACE_Task_Base() {}
+
+        void ExecuteBatch(std::vector<SQLOperation*> const& p_Batch);
+
         ACE_Activation_Queue* m_queue;
         MySQLConnection* m_conn;
+        std::atomic<uint32> m_BatchSize;
 };
 
 #endif
@@ -37,7 +37,7 @@ class DatabaseWorkerPool
     public:
         /* Activity state */
         DatabaseWorkerPool() :
-        _queue(new ACE_Activation_Queue())
+        _queue(new ACE_Activation_Queue()), _readQueue(NULL), _splitReadQueue(false), _writeBatchSize(0), _holderSplit(0), _readConnectionCount(0)
         {
             memset(_connectionCount, 0, sizeof(_connectionCount));
             
@@ -52,6 +52,20 @@ class DatabaseWorkerPool
         {
         }
 
+        //! Must be called before Open.
+        //! p_SplitReadQueue: queries with a result get their own queue and half of the async connections,
+        //! so reads (login, loading) never wait behind a backlog of one-way writes (saves).
+        //! A read may then run before a write enqueued earlier by the same caller: code reading back what it just wrote
+        //! must commit it first (DirectExecute, CommitTransaction callback) or keep the data in memory.
+        //! p_WriteBatchSize: max amount of queued one-way statements a worker sends in a single transaction.
+        //! p_HolderSplit: max amount of parts a query holder is split in, executed at the same time by the read connections.
+        void SetAsyncMode(bool p_SplitReadQueue, uint32 p_WriteBatchSize, uint32 p_HolderSplit)
+        {
+            _splitReadQueue = p_SplitReadQueue;
+            _writeBatchSize = p_WriteBatchSize;
+            _holderSplit    = p_HolderSplit;
+        }
+
         bool Open(const std::string& infoString, uint8 async_threads, uint8 synch_threads)
         {
             bool res = true;
@@ -60,16 +74,32 @@ class DatabaseWorkerPool
             sLog->outInfo(LOG_FILTER_SQL_DRIVER, "Opening DatabasePool '%s'. Asynchronous connections: %u, synchronous connections: %u.",
                 GetDatabaseName(), async_threads, synch_threads);
 
-            //! Open asynchronous connections (delayed operations)
+            //! Reads need their own connections to skip the write backlog, that takes at least two of them
+            uint8 readThreads = 0;
+            if (_splitReadQueue && async_threads > 1)
+            {
+                _readQueue = new ACE_Activation_Queue();
+                _readQueue->queue()->high_water_mark(8 * 1024 * 1024);
+                _readQueue->queue()->low_water_mark(8 * 1024 * 1024);
+                readThreads = async_threads / 2;
+            }
+
+            //! Open asynchronous connections (delayed operations), read connections come last
             _connections[IDX_ASYNC].resize(async_threads);
             for (uint8 i = 0; i < async_threads; ++i)
             {
-                T* t = new T(_queue, _connectionInfo);
+                bool readConnection = i >= async_threads - readThreads;
+                T* t = new T(readConnection ? _readQueue : _queue, _connectionInfo);
+                if (!readConnection)
+                    t->m_worker->SetBatchSize(_writeBatchSize);
+
                 res &= t->Open();
                 _connections[IDX_ASYNC][i] = t;
                 ++_connectionCount[IDX_ASYNC];
             }
 
+            _readConnectionCount = readThreads;
+
             //! Open synchronous connections (direct, blocking operations)
             _connections[IDX_SYNCH].resize(synch_threads);
             for (uint8 i = 0; i < synch_threads; ++i)
@@ -97,6 +127,8 @@ class DatabaseWorkerPool
             //! The next dequeue attempt in the worker thread tasks will result in an error,
             //! ultimately ending the worker thread task.
             _queue->queue()->close();
+            if (_readQueue)
+                _readQueue->queue()->close();
 
             for (uint8 i = 0; i < _connectionCount[IDX_ASYNC]; ++i)
             {
@@ -119,6 +151,7 @@ class DatabaseWorkerPool
 
             //! Deletes the ACE_Activation_Queue object and its underlying ACE_Message_Queue
             delete _queue;
+            delete _readQueue;
 
             sLog->outInfo(LOG_FILTER_SQL_DRIVER, "All connections on DatabasePool '%s' closed.", GetDatabaseName());
         }
@@ -334,7 +367,7 @@ class DatabaseWorkerPool
         {
             QueryResultFuture res;
             BasicStatementTask* task = new BasicStatementTask(sql, res);
-            Enqueue(task);
+            EnqueueRead(task);
             return res;         //! Actual return value has no use yet
         }
 
@@ -366,7 +399,7 @@ class DatabaseWorkerPool
 
             PreparedQueryResultFuture res;
             PreparedStatementTask* task = new PreparedStatementTask(stmt, res);
-            Enqueue(task);
+            EnqueueRead(task);
             return res;
         }
 
@@ -377,9 +410,21 @@ class DatabaseWorkerPool
         QueryResultHolderFuture DelayQueryHolder(SQLQueryHolder* holder)
         {
             QueryResultHolderFuture res;
-            SQLQueryHolderTask* task = new SQLQueryHolderTask(holder, res);
-            Enqueue(task);
-            return res;     //! Fool compiler, has no use yet
+
+            //! One part per connection serving the reads, the last part to finish sets the future
+            uint32 parts = std::min<uint32>(_holderSplit, _readQueue ? _readConnectionCount : _connectionCount[IDX_ASYNC]);
+            parts = std::min<uint32>(parts, holder->GetSize());
+            if (parts <= 1)
+            {
+                EnqueueRead(new SQLQueryHolderTask(holder, res));
+                return res;
+            }
+
+            std::shared_ptr<std::atomic<uint32>> remaining = std::make_shared<std::atomic<uint32>>(parts);
+            for (uint32 i = 0; i < parts; ++i)
+                EnqueueRead(new SQLQueryHolderTask(holder, res, i, parts, remaining));
+
+            return res;
         }
 
         /**
@@ -528,7 +573,12 @@ class DatabaseWorkerPool
             //! If one or more worker threads are busy, the ping operations will not be split evenly, but this doesn't matter
             //! as the sole purpose is to prevent connections from idling.
             for (size_t i = 0; i < _connections[IDX_ASYNC].size(); ++i)
-                Enqueue(new PingOperation);
+            {
+                if (i >= _connections[IDX_ASYNC].size() - _readConnectionCount)
+                    EnqueueRead(new PingOperation);
+                else
+                    Enqueue(new PingOperation);
+            }
         }
 
     private:
@@ -545,6 +595,16 @@ class DatabaseWorkerPool
             _queue->enqueue(op);
         }
 
+        //! Operations returning a result, they bypass the write queue when the read queue is split and are no
+        //! longer ordered after the writes enqueued before them, see SetAsyncMode
+        void EnqueueRead(SQLOperation* op)
+        {
+            if (_readQueue)
+                _readQueue->enqueue(op);
+            else
+                _queue->enqueue(op);
+        }
+
         //! Gets a free connection in the synchronous connection pool.
         //! Caller MUST call t->Unlock() after touching the MySQL context to prevent deadlocks.
         T* GetFreeConnection()
@@ -558,6 +618,10 @@ class DatabaseWorkerPool
                 //! Must be matched with t->Unlock() or you will get deadlocks
                 if (t->LockIfReady())
                     return t;
+
+                //! Every connection is busy, give the owners a chance to finish instead of spinning
+                if (i % num_cons == 0)
+                    ACE_Thread::yield();
             }
 
             //! This will be called when Celine Dion learns to sing
@@ -578,6 +642,11 @@ class DatabaseWorkerPool
         };
 
         ACE_Activation_Queue*           _queue;             //! Queue shared by async worker threads.
+        ACE_Activation_Queue*           _readQueue;         //! Queue of the async read connections, NULL when reads share _queue.
+        bool                            _splitReadQueue;
+        uint32                          _writeBatchSize;
+        uint32                          _holderSplit;
+        uint8                           _readConnectionCount;
         std::vector<T*>                 _connections[IDX_SIZE];
         uint32                          _connectionCount[IDX_SIZE];       //! Counter of MySQL connections;
         MySQLConnectionInfo             _connectionInfo;
@@ -269,6 +269,11 @@ class Field
             return data.length;
         }
 
+        bool IsNull() const
+        {
+            return data.value == NULL;
+        }
+
         struct Metadata
         {
             char const* TableName;
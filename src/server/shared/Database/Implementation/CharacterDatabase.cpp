@@ -291,6 +291,8 @@ void CharacterDatabaseConnection::DoPrepareStatements()
     PREPARE_STATEMENT(CHAR_INS_AURA_EFFECT, "INSERT INTO character_aura_effect (guid, slot, effect, baseamount, amount) "
     "VALUES (?, ?, ?, ?, ?)",  CONNECTION_ASYNC)
 
+    PREPARE_STATEMENT(CHAR_UPD_AURA_DURATION, "UPDATE character_aura SET maxduration = ?, remaintime = ? WHERE guid = ? AND slot = ?", CONNECTION_ASYNC)
+
     PREPARE_STATEMENT(CHAR_SEL_CHAR_CUF_PROFILES, "SELECT id, Name, FrameHeight, FrameWidth, SortBy, HealthText, KeepGroupsTogether, DisplayPets, DisplayMainTankAndAssist, DisplayHealPrediction, DisplayAggroHighlight, DisplayOnlyDispellableDebuffs, DisplayPowerBar, DisplayBorder, UseClassColors, HorizontalGroups, DisplayNonBossDebuffs, DynamicPosition, TopPoint, BottomPoint, LeftPoint, TopOffset, BottomOffset, LeftOffset, Locked, Shown, AutoActivate2Players, AutoActivate3Players, AutoActivate5Players, AutoActivate10Players, AutoActivate15Players, AutoActivate25Players, AutoActivate40Players, AutoActivateSpec1, AutoActivateSpec2, AutoActivatePvP, AutoActivatePvE FROM character_cuf_profiles WHERE guid = ?", CONNECTION_ASYNC);
     PREPARE_STATEMENT(CHAR_REP_CHAR_CUF_PROFILES, "REPLACE INTO character_cuf_profiles (guid, id, Name, FrameHeight, FrameWidth, SortBy, HealthText, KeepGroupsTogether, DisplayPets, DisplayMainTankAndAssist, DisplayHealPrediction, DisplayAggroHighlight, DisplayOnlyDispellableDebuffs, DisplayPowerBar, DisplayBorder, UseClassColors, HorizontalGroups, DisplayNonBossDebuffs, DynamicPosition, TopPoint, BottomPoint, LeftPoint, TopOffset, BottomOffset, LeftOffset, Locked, Shown, AutoActivate2Players, AutoActivate3Players, AutoActivate5Players, AutoActivate10Players, AutoActivate15Players, AutoActivate25Players, AutoActivate40Players, AutoActivateSpec1, AutoActivateSpec2, AutoActivatePvP, AutoActivatePvE) VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)", CONNECTION_ASYNC);
     PREPARE_STATEMENT(CHAR_DEL_CHAR_CUF_PROFILES, "DELETE FROM character_cuf_profiles WHERE guid = ? and id = ?", CONNECTION_ASYNC);
@@ -312,7 +314,7 @@ void CharacterDatabaseConnection::DoPrepareStatements()
     PREPARE_STATEMENT(CHAR_INS_PLAYER_ARCHAEOLOGY_PROJECTS, "INSERT INTO character_archaeology_projects (guid, project, count, first_date) VALUES (?, ?, ?, ?)", CONNECTION_ASYNC);
 
     /// Account data
-    PREPARE_STATEMENT(CHAR_SEL_ACCOUNT_DATA, "SELECT type, time, data FROM account_data WHERE accountId = ?", CONNECTION_SYNCH)
+    PREPARE_STATEMENT(CHAR_SEL_ACCOUNT_DATA, "SELECT type, time, data FROM account_data WHERE accountId = ?", CONNECTION_BOTH)
     PREPARE_STATEMENT(CHAR_REP_ACCOUNT_DATA, "REPLACE INTO account_data (accountId, type, time, data) VALUES (?, ?, ?, ?)", CONNECTION_ASYNC)
     PREPARE_STATEMENT(CHAR_DEL_ACCOUNT_DATA, "DELETE FROM account_data WHERE accountId = ?", CONNECTION_ASYNC)
     PREPARE_STATEMENT(CHAR_SEL_PLAYER_ACCOUNT_DATA, "SELECT type, time, data FROM character_account_data WHERE guid = ?", CONNECTION_ASYNC)
@@ -320,7 +322,7 @@ void CharacterDatabaseConnection::DoPrepareStatements()
     PREPARE_STATEMENT(CHAR_DEL_PLAYER_ACCOUNT_DATA, "DELETE FROM character_account_data WHERE guid = ?", CONNECTION_ASYNC)
 
     /// Tutorials
-    PREPARE_STATEMENT(CHAR_SEL_TUTORIALS, "SELECT tut0, tut1, tut2, tut3, tut4, tut5, tut6, tut7 FROM account_tutorial WHERE accountId = ?", CONNECTION_SYNCH)
+    PREPARE_STATEMENT(CHAR_SEL_TUTORIALS, "SELECT tut0, tut1, tut2, tut3, tut4, tut5, tut6, tut7 FROM account_tutorial WHERE accountId = ?", CONNECTION_BOTH)
     PREPARE_STATEMENT(CHAR_SEL_HAS_TUTORIALS, "SELECT 1 FROM account_tutorial WHERE accountId = ?", CONNECTION_SYNCH)
     PREPARE_STATEMENT(CHAR_INS_TUTORIALS, "REPLACE INTO account_tutorial(tut0, tut1, tut2, tut3, tut4, tut5, tut6, tut7, accountId) VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?)", CONNECTION_ASYNC)
     PREPARE_STATEMENT(CHAR_UPD_TUTORIALS, "UPDATE account_tutorial SET tut0 = ?, tut1 = ?, tut2 = ?, tut3 = ?, tut4 = ?, tut5 = ?, tut6 = ?, tut7 = ? WHERE accountId = ?", CONNECTION_ASYNC)
@@ -736,7 +738,7 @@ void CharacterDatabaseConnection::DoPrepareStatements()
 
     //////////////////////////////////////////////////////////////////////////
     /// Premades
-    PREPARE_STATEMENT(CHAR_SEL_PREMADES, "SELECT transaction, templateId, faction, type FROM webshop_delivery_premade WHERE account = ? and delivery = 0", CONNECTION_SYNCH);
+    PREPARE_STATEMENT(CHAR_SEL_PREMADES, "SELECT transaction, templateId, faction, type FROM webshop_delivery_premade WHERE account = ? and delivery = 0", CONNECTION_ASYNC);
     PREPARE_STATEMENT(CHAR_UPD_PREMADE_SUCESS, "UPDATE webshop_delivery_premade SET delivery = 1 WHERE transaction = ?", CONNECTION_ASYNC);
     //////////////////////////////////////////////////////////////////////////
 
@@ -258,6 +258,7 @@ enum CharacterDatabaseStatements
 
     CHAR_INS_AURA,
     CHAR_INS_AURA_EFFECT,
+    CHAR_UPD_AURA_DURATION,
 
     CHAR_SEL_PLAYER_CURRENCY,
     CHAR_UPD_PLAYER_CURRENCY,
@@ -16,11 +16,11 @@ void LoginDatabaseConnection::DoPrepareStatements()
     PREPARE_STATEMENT(LOGIN_SEL_REALMLIST, "SELECT id, name, address, port, icon, flag, timezone, allowedSecurityLevel, population, gamebuild FROM realmlist WHERE flag <> 3 ORDER BY name", CONNECTION_SYNCH)
     PREPARE_STATEMENT(LOGIN_DEL_EXPIRED_IP_BANS, "DELETE FROM ip_banned WHERE unbandate<>bandate AND unbandate<=UNIX_TIMESTAMP()", CONNECTION_ASYNC)
     PREPARE_STATEMENT(LOGIN_UPD_EXPIRED_ACCOUNT_BANS, "UPDATE account_banned SET active = 0 WHERE active = 1 AND unbandate<>bandate AND unbandate<=UNIX_TIMESTAMP()", CONNECTION_ASYNC)
-    PREPARE_STATEMENT(LOGIN_SEL_IP_BANNED, "SELECT * FROM ip_banned WHERE ip = ?", CONNECTION_SYNCH)
     PREPARE_STATEMENT(LOGIN_INS_IP_AUTO_BANNED, "INSERT INTO ip_banned VALUES (?, UNIX_TIMESTAMP(), UNIX_TIMESTAMP()+?, 'Trinity realmd', 'Failed login autoban')", CONNECTION_ASYNC)
     PREPARE_STATEMENT(LOGIN_SEL_IP_BANNED_ALL, "SELECT ip, bandate, unbandate, bannedby, banreason FROM ip_banned WHERE (bandate = unbandate OR unbandate > UNIX_TIMESTAMP()) ORDER BY unbandate", CONNECTION_SYNCH);
     PREPARE_STATEMENT(LOGIN_SEL_IP_BANNED_BY_IP, "SELECT ip, bandate, unbandate, bannedby, banreason FROM ip_banned WHERE (bandate = unbandate OR unbandate > UNIX_TIMESTAMP()) AND ip LIKE CONCAT('%%', ?, '%%') ORDER BY unbandate", CONNECTION_SYNCH);
-    PREPARE_STATEMENT(LOGIN_SEL_ACCOUNT_BANNED, "SELECT bandate, unbandate FROM account_banned WHERE id = ? AND active = 1", CONNECTION_SYNCH)
+    PREPARE_STATEMENT(LOGIN_SEL_IP_BANS_SINCE, "SELECT ip, bandate, unbandate FROM ip_banned WHERE bandate >= ? AND (bandate = unbandate OR unbandate > UNIX_TIMESTAMP())", CONNECTION_SYNCH)
+    PREPARE_STATEMENT(LOGIN_SEL_ACCOUNT_BANS_SINCE, "SELECT id, bandate, unbandate FROM account_banned WHERE bandate >= ? AND active = 1", CONNECTION_SYNCH)
     PREPARE_STATEMENT(LOGIN_SEL_ACCOUNT_BANNED_ALL, "SELECT account.id, username FROM account, account_banned WHERE account.id = account_banned.id AND active = 1 GROUP BY account.id", CONNECTION_SYNCH);
     PREPARE_STATEMENT(LOGIN_SEL_ACCOUNT_BANNED_BY_USERNAME, "SELECT account.id, username FROM account, account_banned WHERE account.id = account_banned.id AND active = 1 AND username LIKE CONCAT('%%', ?, '%%') GROUP BY account.id", CONNECTION_SYNCH);
     //PREPARE_STATEMENT(LOGIN_INS_ACCOUNT_AUTO_BANNED, "INSERT INTO account_banned VALUES (?, UNIX_TIMESTAMP(), UNIX_TIMESTAMP()+?, 'Trinity realmd', 'Failed login autoban', 1)", CONNECTION_ASYNC)
@@ -37,8 +37,14 @@ void LoginDatabaseConnection::DoPrepareStatements()
     PREPARE_STATEMENT(LOGIN_SEL_ACCOUNT_ID_BY_NAME, "SELECT id FROM account WHERE username = ?", CONNECTION_SYNCH)
     PREPARE_STATEMENT(LOGIN_SEL_ACCOUNT_LIST_BY_NAME, "SELECT id, username FROM account WHERE username = ?", CONNECTION_SYNCH);
     PREPARE_STATEMENT(LOGIN_SEL_ACCOUNT_INFO_BY_NAME, "SELECT id, sessionkey, last_ip, locked, v, s, expansion, mutetime, locale, recruiter, os FROM account WHERE username = ?", CONNECTION_SYNCH);
+    PREPARE_STATEMENT(LOGIN_SEL_ACCOUNT_INFO_BY_ID, "SELECT a.id, a.sessionkey, a.last_ip, a.locked, a.v, a.s, a.expansion, a.mutetime, a.locale, a.recruiter, a.os, a.username, UNIX_TIMESTAMP(a.joindate), a.service_flags, a.custom_flags, a.token_key, "
+        "(SELECT aa.gmlevel FROM account_access aa WHERE aa.id = a.id AND (aa.RealmID = ? OR aa.RealmID = -1) LIMIT 1), "
+        "CAST(EXISTS(SELECT 1 FROM account_banned ab WHERE ab.id = a.id AND ab.active = 1) OR EXISTS(SELECT 1 FROM ip_banned ib WHERE ib.ip = ?) AS UNSIGNED), "
+        "CAST(IFNULL((SELECT av.remainingTime FROM account_vote av WHERE av.account = a.id LIMIT 1), 0) AS UNSIGNED), "
+        "(SELECT ap.premium_type FROM account_premium ap WHERE ap.id = a.id AND ap.active = 1 LIMIT 1) "
+        "FROM account a WHERE a.id = ?", CONNECTION_ASYNC);
     PREPARE_STATEMENT(LOGIN_SEL_ACCOUNT_LIST_BY_EMAIL, "SELECT id, username FROM account WHERE email = ?", CONNECTION_SYNCH);
-    PREPARE_STATEMENT(LOGIN_SEL_NUM_CHARS_ON_REALM, "SELECT numchars FROM realmcharacters WHERE realmid = ? AND acctid= ?", CONNECTION_SYNCH)
+    PREPARE_STATEMENT(LOGIN_SEL_REALM_CHARACTERS_BY_ACCOUNT, "SELECT realmid, numchars FROM realmcharacters WHERE acctid = ?", CONNECTION_SYNCH)
     PREPARE_STATEMENT(LOGIN_SEL_ACCOUNT_BY_IP, "SELECT id, username FROM account WHERE last_ip = ?", CONNECTION_SYNCH)
     PREPARE_STATEMENT(LOGIN_SEL_ACCOUNT_BY_ID, "SELECT 1 FROM account WHERE id = ?", CONNECTION_SYNCH);
     PREPARE_STATEMENT(LOGIN_INS_IP_BANNED, "INSERT INTO ip_banned VALUES (?, UNIX_TIMESTAMP(), UNIX_TIMESTAMP()+?, ?, ?)", CONNECTION_ASYNC)
@@ -47,7 +53,7 @@ void LoginDatabaseConnection::DoPrepareStatements()
     PREPARE_STATEMENT(LOGIN_SEL_ACCOUNT_ALWAYS_BANNED, "SELECT unbandate-UNIX_TIMESTAMP() AS unban FROM account_banned WHERE id = ? AND active = 1 AND bandate <> unbandate", CONNECTION_SYNCH)
     PREPARE_STATEMENT(LOGIN_SEL_ACCOUNT_BANNED_PERMANENT, "SELECT 1 FROM account_banned WHERE id = ? AND active = 1 AND bandate = unbandate", CONNECTION_SYNCH)
     PREPARE_STATEMENT(LOGIN_UPD_ACCOUNT_NOT_BANNED, "UPDATE account_banned SET active = 0 WHERE id = ? AND active != 0", CONNECTION_ASYNC)
-    PREPARE_STATEMENT(LOGIN_SEL_LAST_BANNED_DATE, "SELECT MAX(bandate) FROM account_banned WHERE id = ?", CONNECTION_SYNCH)
+    PREPARE_STATEMENT(LOGIN_SEL_LAST_BANNED_DATE, "SELECT MAX(bandate) FROM account_banned WHERE id = ?", CONNECTION_ASYNC)
     PREPARE_STATEMENT(LOGIN_DEL_REALM_CHARACTERS_BY_REALM, "DELETE FROM realmcharacters WHERE acctid = ? AND realmid = ?", CONNECTION_ASYNC)
     PREPARE_STATEMENT(LOGIN_DEL_REALM_CHARACTERS, "DELETE FROM realmcharacters WHERE acctid = ?", CONNECTION_ASYNC);
     PREPARE_STATEMENT(LOGIN_INS_REALM_CHARACTERS, "INSERT INTO realmcharacters (numchars, acctid, realmid) VALUES (?, ?, ?)", CONNECTION_ASYNC)
@@ -138,10 +144,10 @@ void LoginDatabaseConnection::DoPrepareStatements()
 
     PREPARE_STATEMENT(LOGIN_RPL_CHARACTER_RENDERER_QUEUE, "REPLACE INTO character_renderer_queue (guid, race, gender, class, skinColor, face, hairStyle, hairColor, facialHair, equipment) VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?)", CONNECTION_ASYNC);
 
-    PREPARE_STATEMENT(LOGIN_SEL_ACTIVITY, "SELECT CONCAT(WEEK(DATE), ' - ', DATE_FORMAT(DATE, '%Y')) AS `week`, COUNT(DISTINCT(DATE_FORMAT(DATE, '%y - %m - %d'))) `countperweek` FROM account_log_ip WHERE accountid = ? AND source > 1 AND error = 0 GROUP BY CONCAT(WEEK(DATE), ' - ', DATE_FORMAT(DATE, '%y')) ORDER BY DATE", CONNECTION_SYNCH);
-    PREPARE_STATEMENT(LOGIN_SEL_ACC_LOYALTY, "SELECT LastClaim, LastEventReset FROM account_loyalty WHERE AccountID = ?", CONNECTION_SYNCH)
+    PREPARE_STATEMENT(LOGIN_SEL_ACTIVITY, "SELECT CONCAT(WEEK(DATE), ' - ', DATE_FORMAT(DATE, '%Y')) AS `week`, COUNT(DISTINCT(DATE_FORMAT(DATE, '%y - %m - %d'))) `countperweek` FROM account_log_ip WHERE accountid = ? AND source > 1 AND error = 0 GROUP BY CONCAT(WEEK(DATE), ' - ', DATE_FORMAT(DATE, '%y')) ORDER BY DATE", CONNECTION_ASYNC);
+    PREPARE_STATEMENT(LOGIN_SEL_ACC_LOYALTY, "SELECT LastClaim, LastEventReset FROM account_loyalty WHERE AccountID = ?", CONNECTION_ASYNC)
     PREPARE_STATEMENT(LOGIN_REP_ACC_LOYALTY, "REPLACE INTO account_loyalty(AccountID, LastClaim, LastEventReset) VALUES (?, ?, ?)", CONNECTION_ASYNC)
-    PREPARE_STATEMENT(LOGIN_SEL_ACC_LOYALTY_EVENT, "SELECT Event, Count FROM account_loyalty_event WHERE AccountID = ?", CONNECTION_SYNCH)
+    PREPARE_STATEMENT(LOGIN_SEL_ACC_LOYALTY_EVENT, "SELECT Event, Count FROM account_loyalty_event WHERE AccountID = ?", CONNECTION_ASYNC)
     PREPARE_STATEMENT(LOGIN_DEL_ACC_LOYALTY_EVENT, "DELETE FROM account_loyalty_event WHERE AccountID = ?", CONNECTION_ASYNC)
     PREPARE_STATEMENT(LOGIN_REP_ACC_LOYALTY_EVENT, "REPLACE INTO account_loyalty_event(AccountID, Event, Count) VALUES (?, ?, ?)", CONNECTION_ASYNC)
 
@@ -23,9 +23,9 @@ enum LoginDatabaseStatements
     LOGIN_SEL_REALMLIST = 1,
     LOGIN_DEL_EXPIRED_IP_BANS,
     LOGIN_UPD_EXPIRED_ACCOUNT_BANS,
-    LOGIN_SEL_IP_BANNED,
     LOGIN_INS_IP_AUTO_BANNED,
-    LOGIN_SEL_ACCOUNT_BANNED,
+    LOGIN_SEL_IP_BANS_SINCE,
+    LOGIN_SEL_ACCOUNT_BANS_SINCE,
     LOGIN_SEL_ACCOUNT_BANNED_ALL,
     LOGIN_SEL_ACCOUNT_BANNED_BY_USERNAME,
     LOGIN_INS_ACCOUNT_AUTO_BANNED,
@@ -47,8 +47,9 @@ enum LoginDatabaseStatements
     LOGIN_SEL_ACCOUNT_ID_BY_NAME,
     LOGIN_SEL_ACCOUNT_LIST_BY_NAME,
     LOGIN_SEL_ACCOUNT_INFO_BY_NAME,
+    LOGIN_SEL_ACCOUNT_INFO_BY_ID,
     LOGIN_SEL_ACCOUNT_LIST_BY_EMAIL,
-    LOGIN_SEL_NUM_CHARS_ON_REALM,
+    LOGIN_SEL_REALM_CHARACTERS_BY_ACCOUNT,
     LOGIN_SEL_ACCOUNT_BY_IP,
     LOGIN_INS_IP_BANNED,
     LOGIN_DEL_IP_NOT_BANNED,
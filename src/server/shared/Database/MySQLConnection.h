@@ -88,6 +88,12 @@ class MySQLConnection
 
         uint32 GetLastError() { return mysql_errno(m_Mysql); }
 
+        //! While disabled, a statement failing on a lost connection reconnects but isn't executed again,
+        //! the caller replays the whole transaction it belonged to.
+        void SetStatementRetry(bool retry) { m_statementRetry = retry; }
+        //! Incremented on every successful reconnection, a transaction open before is gone.
+        uint32 GetReconnectCount() const { return m_reconnectCount; }
+
     protected:
         bool LockIfReady()
         {
@@ -114,6 +120,8 @@ class MySQLConnection
         PreparedStatementMap                 m_queries;       //! Query storage
         bool                                 m_reconnecting;  //! Are we reconnecting?
         bool                                 m_prepareError;  //! Was there any error while preparing statements?
+        bool                                 m_statementRetry; //! Is a statement failing on a lost connection executed again?
+        uint32                               m_reconnectCount; //! Successful reconnections
 
     private:
         bool _HandleMySQLErrno(uint32 errNo);
@@ -156,6 +156,7 @@ class PreparedStatementTask : public SQLOperation
         ~PreparedStatementTask();
 
         bool Execute();
+        bool IsBatchable() const { return !m_has_result; }
 
     protected:
         PreparedStatement* m_stmt;
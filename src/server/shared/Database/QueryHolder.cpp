@@ -164,7 +164,8 @@ bool SQLQueryHolderTask::Execute()
     /// we can do this, we are friends
     std::vector<SQLQueryHolder::SQLResultPair> &queries = m_holder->m_queries;
 
-    for (size_t i = 0; i < queries.size(); i++)
+    /// queries are interleaved between the parts, the heavy ones are often set next to each other
+    for (size_t i = m_Part; i < queries.size(); i += m_PartCount)
     {
         /// execute all queries in the holder and pass the results
         if (SQLElementData* data = &queries[i].first)
@@ -189,6 +190,9 @@ bool SQLQueryHolderTask::Execute()
         }
     }
 
-    m_result.set(m_holder);
+    /// each part only writes its own results, the last one to finish hands the holder over
+    if (!m_RemainingParts || m_RemainingParts->fetch_sub(1, std::memory_order_acq_rel) == 1)
+        m_result.set(m_holder);
+
     return true;
 }
@@ -10,6 +10,8 @@
 #define _QUERYHOLDER_H
 
 #include <ace/Future.h>
+#include <atomic>
+#include <memory>
 
 class SQLQueryHolder
 {
@@ -24,6 +26,7 @@ class SQLQueryHolder
         bool SetPQuery(size_t index, const char *format, ...) ATTR_PRINTF(3, 4);
         bool SetPreparedQuery(size_t index, PreparedStatement* stmt);
         void SetSize(size_t size);
+        size_t GetSize() const { return m_queries.size(); }
         QueryResult GetResult(size_t index);
         PreparedQueryResult GetPreparedResult(size_t index);
         void SetResult(size_t index, ResultSet* result);
@@ -38,9 +41,14 @@ class SQLQueryHolderTask : public SQLOperation
         SQLQueryHolder * m_holder;
         QueryResultHolderFuture m_result;
 
+        /// A holder split over several connections executes the queries p_Part, p_Part + p_PartCount... of each task
+        uint32 m_Part;
+        uint32 m_PartCount;
+        std::shared_ptr<std::atomic<uint32>> m_RemainingParts;
+
     public:
-        SQLQueryHolderTask(SQLQueryHolder *holder, QueryResultHolderFuture res)
-            : m_holder(holder), m_result(res){};
+        SQLQueryHolderTask(SQLQueryHolder *holder, QueryResultHolderFuture res, uint32 p_Part = 0, uint32 p_PartCount = 1, std::shared_ptr<std::atomic<uint32>> p_RemainingParts = nullptr)
+            : m_holder(holder), m_result(res), m_Part(p_Part), m_PartCount(p_PartCount), m_RemainingParts(p_RemainingParts) {};
         bool Execute();
 
 };
@@ -13,7 +13,8 @@ ResultSet::ResultSet(MYSQL_RES *result, MYSQL_FIELD *fields, uint64 rowCount, ui
 _rowCount(rowCount),
 _fieldCount(fieldCount),
 _result(result),
-_fields(fields)
+_fields(fields),
+_rowsOffset(0)
 {
     _currentRow = new Field[_fieldCount];
 #ifdef TRINITY_DEBUG
@@ -22,6 +23,18 @@ _fields(fields)
 #endif
 }
 
+ResultSet::ResultSet(std::shared_ptr<std::vector<char> const> p_Rows, std::vector<enum_field_types> const& p_Types, uint64 rowCount) :
+_rowCount(rowCount),
+_fieldCount(p_Types.size()),
+_result(NULL),
+_fields(NULL),
+_rows(p_Rows),
+_types(p_Types),
+_rowsOffset(0)
+{
+    _currentRow = new Field[_fieldCount];
+}
+
 PreparedResultSet::PreparedResultSet(MYSQL_STMT* stmt, MYSQL_RES *result, uint64 rowCount, uint32 fieldCount) :
 m_rowCount(rowCount),
 m_rowPosition(0),
@@ -158,6 +171,34 @@ bool ResultSet::NextRow()
 {
     MYSQL_ROW row;
 
+    if (_rows)
+    {
+        if (!_currentRow || _rowsOffset >= _rows->size())
+        {
+            CleanUp();
+            return false;
+        }
+
+        char* l_Data = const_cast<char*>(_rows->data());
+        for (uint32 i = 0; i < _fieldCount; i++)
+        {
+            uint32 l_Length;
+            memcpy(&l_Length, l_Data + _rowsOffset, sizeof(l_Length));
+            _rowsOffset += sizeof(l_Length);
+
+            if (l_Length == 0xFFFFFFFF)
+            {
+                _currentRow[i].SetStructuredValue(NULL, _types[i]);
+                continue;
+            }
+
+            _currentRow[i].SetStructuredValue(l_Data + _rowsOffset, _types[i]);
+            _rowsOffset += l_Length + 1;
+        }
+
+        return true;
+    }
+
     if (!_result)
         return false;
 
@@ -174,6 +215,34 @@ bool ResultSet::NextRow()
     return true;
 }
 
+enum_field_types ResultSet::GetFieldType(uint32 index) const
+{
+    ASSERT(index < _fieldCount);
+
+    if (_fields)
+        return _fields[index].type;
+
+    return _types[index];
+}
+
+void ResultSet::AppendRow(std::vector<char>& p_Rows) const
+{
+    for (uint32 i = 0; i < _fieldCount; i++)
+    {
+        Field const& l_Field = _currentRow[i];
+
+        uint32 l_Length = l_Field.data.value ? l_Field.data.length : 0xFFFFFFFF;
+        p_Rows.insert(p_Rows.end(), reinterpret_cast<char const*>(&l_Length), reinterpret_cast<char const*>(&l_Length) + sizeof(l_Length));
+
+        if (!l_Field.data.value)
+            continue;
+
+        char const* l_Value = static_cast<char const*>(l_Field.data.value);
+        p_Rows.insert(p_Rows.end(), l_Value, l_Value + l_Length);
+        p_Rows.push_back('\0');
+    }
+}
+
 bool PreparedResultSet::NextRow()
 {
     /// Only updates the m_rowPosition so upper level code knows in which element
@@ -215,6 +284,8 @@ void ResultSet::CleanUp()
         mysql_free_result(_result);
         _result = NULL;
     }
+
+    _rows.reset();
 }
 
 void PreparedResultSet::CleanUp()
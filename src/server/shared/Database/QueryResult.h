@@ -10,6 +10,7 @@
 #define QUERYRESULT_H
 
 #include <memory>
+#include <vector>
 #include "Field.h"
 #include "Errors.h"
 
@@ -22,6 +23,8 @@ class ResultSet
 {
     public:
         ResultSet(MYSQL_RES* result, MYSQL_FIELD* fields, uint64 rowCount, uint32 fieldCount);
+        /// Rows already fetched, see AppendRow for the layout of p_Rows
+        ResultSet(std::shared_ptr<std::vector<char> const> p_Rows, std::vector<enum_field_types> const& p_Types, uint64 rowCount);
         ~ResultSet();
 
         bool NextRow();
@@ -29,6 +32,11 @@ class ResultSet
         uint32 GetFieldCount() const { return _fieldCount; }
 
         Field* Fetch() const { return _currentRow; }
+        enum_field_types GetFieldType(uint32 index) const;
+
+        /// Appends the current row to p_Rows, every value is its uint32 length (or 0xFFFFFFFF for NULL) followed by its bytes and a terminating zero
+        void AppendRow(std::vector<char>& p_Rows) const;
+
         const Field & operator [] (uint32 index) const
         {
             ASSERT(index < _fieldCount);
@@ -45,6 +53,10 @@ class ResultSet
         MYSQL_RES* _result;
         MYSQL_FIELD* _fields;
 
+        std::shared_ptr<std::vector<char> const> _rows;
+        std::vector<enum_field_types> _types;
+        size_t _rowsOffset;
+
         ResultSet(ResultSet const& right) = delete;
         ResultSet& operator=(ResultSet const& right) = delete;
 };
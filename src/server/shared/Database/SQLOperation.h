@@ -59,6 +59,9 @@ class SQLOperation : public ACE_Method_Request
         virtual bool Execute() = 0;
         virtual void SetConnection(MySQLConnection* con) { m_conn = con; }
 
+        /// One-way statements can be grouped with their neighbours in a single transaction by the worker
+        virtual bool IsBatchable() const { return false; }
+
         MySQLConnection* m_conn;
 };
 
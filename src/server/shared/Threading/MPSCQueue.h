@@ -0,0 +1,76 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Project-Hellscream https://hellscream.org
+// Copyright (C) 2018-2020 Project-Hellscream-6.2
+// Discord https://discord.gg/CWCF3C9
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _MPSC_QUEUE_H
+#define _MPSC_QUEUE_H
+
+#include <atomic>
+#include <utility>
+
+/// Unbounded lock free queue, any thread can push but only one thread may pop.
+/// Producers only exchange the head pointer, they never wait on each other or on the consumer.
+template <typename T>
+class MPSCQueue
+{
+    private:
+        struct Node
+        {
+            Node() : Next(nullptr) { }
+            explicit Node(T&& p_Data) : Data(std::move(p_Data)), Next(nullptr) { }
+
+            T Data;
+            std::atomic<Node*> Next;
+        };
+
+        std::atomic<Node*> m_Head;
+        Node* m_Tail;
+
+        MPSCQueue(MPSCQueue const&) = delete;
+        MPSCQueue& operator=(MPSCQueue const&) = delete;
+
+    public:
+        MPSCQueue() : m_Head(new Node()), m_Tail(m_Head.load(std::memory_order_relaxed)) { }
+
+        ~MPSCQueue()
+        {
+            T l_Output;
+            while (Dequeue(l_Output))
+                ;
+
+            delete m_Tail;
+        }
+
+        void Enqueue(T&& p_Input)
+        {
+            Node* l_Node = new Node(std::move(p_Input));
+            Node* l_Previous = m_Head.exchange(l_Node, std::memory_order_acq_rel);
+            l_Previous->Next.store(l_Node, std::memory_order_release);
+        }
+
+        /// Consumer side only
+        bool Dequeue(T& p_Result)
+        {
+            Node* l_Tail = m_Tail;
+            Node* l_Next = l_Tail->Next.load(std::memory_order_acquire);
+            if (!l_Next)
+                return false;
+
+            p_Result = std::move(l_Next->Data);
+            m_Tail = l_Next;
+            delete l_Tail;
+            return true;
+        }
+
+        /// Consumer side only, an element being pushed may not be visible yet
+        bool Empty() const
+        {
+            return m_Tail->Next.load(std::memory_order_acquire) == nullptr;
+        }
+};
+
+#endif
@@ -0,0 +1,137 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Project-Hellscream https://hellscream.org
+// Copyright (C) 2018-2020 Project-Hellscream-6.2
+// Discord https://discord.gg/CWCF3C9
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include "ObjectPool.h"
+#include "Common.h"
+#include "Errors.h"
+#include <algorithm>
+#include <cstddef>
+#include <new>
+
+/// Free blocks a thread keeps for itself, half of them move to the pool when it's full
+#define OBJECT_POOL_CACHE_SIZE 32
+
+/// Per thread free lists, plain data so it works with every thread_local flavor of Common.h.
+/// The blocks cached by a thread which exits are lost, the pool threads live as long as the server.
+struct ObjectPoolCache
+{
+    void* Head;
+    uint32 Count;
+};
+
+static thread_local ObjectPoolCache t_ObjectPoolCaches[MAX_OBJECT_POOLS];
+
+static uint32 s_ObjectPoolCount = 0;
+
+ObjectPool::ObjectPool(size_t p_ObjectSize, uint32 p_ObjectsPerChunk)
+    : m_ObjectSize(p_ObjectSize), m_ObjectsPerChunk(p_ObjectsPerChunk), m_Free(nullptr)
+{
+    size_t l_Alignment = alignof(std::max_align_t);
+    m_BlockSize = (std::max(p_ObjectSize, sizeof(FreeBlock)) + l_Alignment - 1) / l_Alignment * l_Alignment;
+
+    /// Pools are static objects of the entities, built before any thread starts
+    m_Id = s_ObjectPoolCount++;
+    ASSERT(m_Id < MAX_OBJECT_POOLS);
+}
+
+void* ObjectPool::Allocate(size_t p_Size)
+{
+    if (p_Size != m_ObjectSize)
+        return ::operator new(p_Size);
+
+    ObjectPoolCache& l_Cache = t_ObjectPoolCaches[m_Id];
+
+    if (!l_Cache.Head)
+    {
+        uint32 l_Count = 0;
+        l_Cache.Head  = Refill(l_Count);
+        l_Cache.Count = l_Count;
+    }
+
+    FreeBlock* l_Block = static_cast<FreeBlock*>(l_Cache.Head);
+    l_Cache.Head = l_Block->Next;
+    --l_Cache.Count;
+
+    return l_Block;
+}
+
+void ObjectPool::Deallocate(void* p_Object, size_t p_Size)
+{
+    if (!p_Object)
+        return;
+
+    if (p_Size != m_ObjectSize)
+    {
+        ::operator delete(p_Object);
+        return;
+    }
+
+    ObjectPoolCache& l_Cache = t_ObjectPoolCaches[m_Id];
+
+    FreeBlock* l_Block = static_cast<FreeBlock*>(p_Object);
+    l_Block->Next = static_cast<FreeBlock*>(l_Cache.Head);
+    l_Cache.Head = l_Block;
+
+    if (++l_Cache.Count < OBJECT_POOL_CACHE_SIZE)
+        return;
+
+    /// Keep the most recently freed half, still hot in this thread's cache lines
+    FreeBlock* l_Last = l_Block;
+    for (uint32 l_I = 1; l_I < OBJECT_POOL_CACHE_SIZE / 2; ++l_I)
+        l_Last = l_Last->Next;
+
+    FreeBlock* l_First = l_Last->Next;
+    l_Last->Next = nullptr;
+    l_Cache.Count = OBJECT_POOL_CACHE_SIZE / 2;
+
+    FreeBlock* l_End = l_First;
+    while (l_End->Next)
+        l_End = l_End->Next;
+
+    Release(l_First, l_End);
+}
+
+ObjectPool::FreeBlock* ObjectPool::Refill(uint32& p_Count)
+{
+    std::lock_guard<std::mutex> l_Lock(m_Lock);
+
+    if (!m_Free)
+    {
+        /// Objects of a chunk are contiguous, the ones spawned together by a grid are updated together too
+        char* l_Chunk = static_cast<char*>(::operator new(m_BlockSize * m_ObjectsPerChunk));
+        for (uint32 l_I = 0; l_I < m_ObjectsPerChunk; ++l_I)
+        {
+            FreeBlock* l_Block = reinterpret_cast<FreeBlock*>(l_Chunk + (m_ObjectsPerChunk - 1 - l_I) * m_BlockSize);
+            l_Block->Next = m_Free;
+            m_Free = l_Block;
+        }
+    }
+
+    FreeBlock* l_First = m_Free;
+    FreeBlock* l_Last  = m_Free;
+    p_Count = 1;
+
+    while (p_Count < OBJECT_POOL_CACHE_SIZE / 2 && l_Last->Next)
+    {
+        l_Last = l_Last->Next;
+        ++p_Count;
+    }
+
+    m_Free = l_Last->Next;
+    l_Last->Next = nullptr;
+
+    return l_First;
+}
+
+void ObjectPool::Release(FreeBlock* p_First, FreeBlock* p_Last)
+{
+    std::lock_guard<std::mutex> l_Lock(m_Lock);
+
+    p_Last->Next = m_Free;
+    m_Free = p_First;
+}
@@ -0,0 +1,53 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Project-Hellscream https://hellscream.org
+// Copyright (C) 2018-2020 Project-Hellscream-6.2
+// Discord https://discord.gg/CWCF3C9
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _OBJECT_POOL_H
+#define _OBJECT_POOL_H
+
+#include "Define.h"
+#include <mutex>
+
+/// Maximum number of ObjectPool instances, each of them owns one slot of the per thread caches
+#define MAX_OBJECT_POOLS 8
+
+/// Fixed size allocator for the objects spawned and despawned with the grids.
+/// Memory is taken from the system by chunks of p_ObjectsPerChunk objects which are never given back,
+/// freed objects are kept for the next allocation. Every thread has a small cache of free objects so
+/// the map threads only take the pool lock once per batch; an object may be freed by another thread
+/// than the one which allocated it.
+/// Meant to back the class operator new/delete: allocations of another size, coming from the derived
+/// classes, go to the global allocator.
+class ObjectPool
+{
+    public:
+        ObjectPool(size_t p_ObjectSize, uint32 p_ObjectsPerChunk);
+
+        void* Allocate(size_t p_Size);
+        void Deallocate(void* p_Object, size_t p_Size);
+
+    private:
+        struct FreeBlock
+        {
+            FreeBlock* Next;
+        };
+
+        /// Takes a batch of free blocks for the calling thread cache, allocating a new chunk if needed
+        FreeBlock* Refill(uint32& p_Count);
+        /// Gives back a batch of the calling thread cache
+        void Release(FreeBlock* p_First, FreeBlock* p_Last);
+
+        size_t m_ObjectSize;
+        size_t m_BlockSize;                                             ///< m_ObjectSize rounded up to the alignment
+        uint32 m_ObjectsPerChunk;
+        uint32 m_Id;                                                    ///< Slot in the thread caches
+
+        std::mutex m_Lock;
+        FreeBlock* m_Free;
+};
+
+#endif
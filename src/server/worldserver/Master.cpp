@@ -679,6 +679,10 @@ bool Master::_StartDB()
     std::string dbstring;
     uint8 async_threads, synch_threads;
 
+    bool splitReadQueue = ConfigMgr::GetBoolDefault("Database.SplitReadQueue", false);
+    uint32 writeBatchSize = uint32(ConfigMgr::GetIntDefault("Database.WriteBatchSize", 0));
+    uint32 holderSplit = uint32(ConfigMgr::GetIntDefault("Database.QueryHolderSplit", 0));
+
     dbstring = ConfigMgr::GetStringDefault("WorldDatabaseInfo", "");
     if (dbstring.empty())
     {
@@ -696,6 +700,7 @@ bool Master::_StartDB()
 
     synch_threads = ConfigMgr::GetIntDefault("WorldDatabase.SynchThreads", 1);
     ///- Initialize the world database
+    WorldDatabase.SetAsyncMode(splitReadQueue, writeBatchSize, holderSplit);
     if (!WorldDatabase.Open(dbstring, async_threads, synch_threads))
     {
         sLog->outError(LOG_FILTER_WORLDSERVER, "Cannot connect to world database %s", dbstring.c_str());
@@ -724,6 +729,7 @@ bool Master::_StartDB()
     synch_threads = ConfigMgr::GetIntDefault("CharacterDatabase.SynchThreads", 2);
 
     ///- Initialize the Character database
+    CharacterDatabase.SetAsyncMode(splitReadQueue, writeBatchSize, holderSplit);
     if (!CharacterDatabase.Open(dbstring, async_threads, synch_threads))
     {
         sLog->outError(LOG_FILTER_WORLDSERVER, "Cannot connect to Character database %s", dbstring.c_str());
@@ -751,6 +757,7 @@ bool Master::_StartDB()
 
     synch_threads = ConfigMgr::GetIntDefault("LoginDatabase.SynchThreads", 1);
     ///- Initialize the login database
+    LoginDatabase.SetAsyncMode(splitReadQueue, writeBatchSize, holderSplit);
     if (!LoginDatabase.Open(dbstring, async_threads, synch_threads))
     {
         sLog->outError(LOG_FILTER_WORLDSERVER, "Cannot connect to login database %s", dbstring.c_str());
@@ -834,6 +841,7 @@ bool Master::_StartDB()
     synch_threads = uint8(ConfigMgr::GetIntDefault("HotfixDatabase.SynchThreads", 1));
 
     ///- Initialize the hotfix database
+    HotfixDatabase.SetAsyncMode(splitReadQueue, writeBatchSize, holderSplit);
     if (!HotfixDatabase.Open(dbstring, async_threads, synch_threads))
     {
         sLog->outError(LOG_FILTER_WORLDSERVER, "Cannot connect to Hotfix database %s", dbstring.c_str());
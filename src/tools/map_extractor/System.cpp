@@ -14,10 +14,13 @@
 #include <set>
 #include <cstdlib>
 #include <cstring>
+#include <string>
+#include <vector>
 
 #ifdef _WIN32
 #include "direct.h"
 #else
+#include <dirent.h>
 #include <sys/stat.h>
 #include <unistd.h>
 #define ERROR_PATH_NOT_FOUND ERROR_FILE_NOT_FOUND
@@ -116,6 +119,9 @@ float CONF_flat_liquid_delta_limit = 0.001f; // If max - min less this value - l
 
 uint32 CONF_Locale = 0;
 
+// Rewrite the already extracted maps in the memory mapped layout instead of extracting
+bool  CONF_convert_mapped = false;
+
 #define LOCALES_COUNT 17
 
 char const* Locales[LOCALES_COUNT] =
@@ -167,6 +173,7 @@ void Usage(char const* prg)
         "-o set output path (max %d characters)\n"\
         "-e extract only MAP(1)/DBC(2) - standard: both(3)\n"\
         "-f height stored as int (less map size but lost some accuracy) 1 by default\n"\
+        "-m convert the maps found in the output path to the memory mapped layout, nothing is extracted\n"\
         "Example: %s -f 0 -i \"c:\\games\\game\"\n", prg, MAX_PATH_LENGTH - 1, MAX_PATH_LENGTH - 1, prg);
     exit(1);
 }
@@ -179,6 +186,7 @@ void HandleArgs(int argc, char* arg[])
         // o - output path
         // e - extract only MAP(1)/DBC(2) - standard both(3)
         // f - use float to int conversion
+        // m - convert extracted maps to the memory mapped layout
         // h - limit minimum height
         // b - target client build
         if (arg[c][0] != '-')
@@ -231,6 +239,9 @@ void HandleArgs(int argc, char* arg[])
                 else
                     Usage(arg[0]);
                 break;
+            case 'm':
+                CONF_convert_mapped = true;
+                break;
             case 'h':
                 Usage(arg[0]);
                 break;
@@ -392,6 +403,7 @@ void ReadLiquidTypeTableDBC()
 // Map file format data
 static char const* MAP_MAGIC         = "MAPS";
 static char const* MAP_VERSION_MAGIC = "v1.8";
+static char const* MAP_MAPPED_VERSION_MAGIC = "m1.8";
 static char const* MAP_AREA_MAGIC    = "AREA";
 static char const* MAP_HEIGHT_MAGIC  = "MHGT";
 static char const* MAP_LIQUID_MAGIC  = "MLIQ";
@@ -1066,6 +1078,262 @@ void ExtractWmos(ChunkedFile& file, std::set<std::string>& wmoList)
     }
 }
 
+// **************************************************
+// Memory mapped layout
+// **************************************************
+// Same headers as the extracted maps, but every section and every array of a section start on an
+// 8 bytes boundary so the server can map the file read only and read the arrays in place
+#define MAP_MAPPED_ALIGNMENT 8
+
+class MappedMapWriter
+{
+public:
+    MappedMapWriter(std::vector<char> const& source) : _source(source) { }
+
+    // Returns false if a block of the source is out of the file
+    bool Copy(uint32 offset, uint32 size)
+    {
+        if (size_t(offset) + size > _source.size())
+            return false;
+
+        _output.insert(_output.end(), _source.begin() + offset, _source.begin() + offset + size);
+        Align();
+        return true;
+    }
+
+    void Align()
+    {
+        _output.resize((_output.size() + MAP_MAPPED_ALIGNMENT - 1) & ~size_t(MAP_MAPPED_ALIGNMENT - 1), 0);
+    }
+
+    template<class T>
+    T const* Source(uint32 offset) const
+    {
+        return size_t(offset) + sizeof(T) <= _source.size() ? reinterpret_cast<T const*>(&_source[offset]) : nullptr;
+    }
+
+    uint32 Size() const { return uint32(_output.size()); }
+    std::vector<char>& Output() { return _output; }
+
+private:
+    std::vector<char> const& _source;
+    std::vector<char> _output;
+};
+
+bool ConvertMapSection(MappedMapWriter& writer, uint32 offset, uint32& newOffset, uint32& newSize)
+{
+    if (!offset)
+        return true;
+
+    newOffset = writer.Size();
+
+    if (map_areaHeader const* area = writer.Source<map_areaHeader>(offset))
+    {
+        if (area->fourcc == *(uint32 const*)MAP_AREA_MAGIC)
+        {
+            if (!writer.Copy(offset, sizeof(map_areaHeader)))
+                return false;
+
+            if (!(area->flags & MAP_AREA_NO_AREA) && !writer.Copy(offset + sizeof(map_areaHeader), sizeof(uint16) * 16 * 16))
+                return false;
+
+            newSize = writer.Size() - newOffset;
+            return true;
+        }
+    }
+
+    if (map_heightHeader const* height = writer.Source<map_heightHeader>(offset))
+    {
+        if (height->fourcc == *(uint32 const*)MAP_HEIGHT_MAGIC)
+        {
+            uint32 flags = height->flags;
+            if (!writer.Copy(offset, sizeof(map_heightHeader)))
+                return false;
+
+            offset += sizeof(map_heightHeader);
+
+            if (!(flags & MAP_HEIGHT_NO_HEIGHT))
+            {
+                uint32 valueSize = sizeof(float);
+                if (flags & MAP_HEIGHT_AS_INT16)
+                    valueSize = sizeof(uint16);
+                else if (flags & MAP_HEIGHT_AS_INT8)
+                    valueSize = sizeof(uint8);
+
+                if (!writer.Copy(offset, 129 * 129 * valueSize))
+                    return false;
+                offset += 129 * 129 * valueSize;
+
+                if (!writer.Copy(offset, 128 * 128 * valueSize))
+                    return false;
+                offset += 128 * 128 * valueSize;
+            }
+
+            if (flags & MAP_HEIGHT_HAS_FLIGHT_BOUNDS)
+            {
+                if (!writer.Copy(offset, sizeof(int16) * 3 * 3) || !writer.Copy(offset + sizeof(int16) * 3 * 3, sizeof(int16) * 3 * 3))
+                    return false;
+            }
+
+            newSize = writer.Size() - newOffset;
+            return true;
+        }
+    }
+
+    if (map_liquidHeader const* liquid = writer.Source<map_liquidHeader>(offset))
+    {
+        if (liquid->fourcc == *(uint32 const*)MAP_LIQUID_MAGIC)
+        {
+            uint16 flags = liquid->flags;
+            uint32 count = uint32(liquid->width) * uint32(liquid->height);
+            if (!writer.Copy(offset, sizeof(map_liquidHeader)))
+                return false;
+
+            offset += sizeof(map_liquidHeader);
+
+            if (!(flags & MAP_LIQUID_NO_TYPE))
+            {
+                if (!writer.Copy(offset, sizeof(uint16) * 16 * 16) || !writer.Copy(offset + sizeof(uint16) * 16 * 16, sizeof(uint8) * 16 * 16))
+                    return false;
+                offset += (sizeof(uint16) + sizeof(uint8)) * 16 * 16;
+            }
+
+            if (!(flags & MAP_LIQUID_NO_HEIGHT) && !writer.Copy(offset, sizeof(float) * count))
+                return false;
+
+            newSize = writer.Size() - newOffset;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// Returns 1 if the file was converted, 0 if it already was, -1 on error
+int ConvertMapFileToMapped(std::string const& filename)
+{
+    FILE* input = fopen(filename.c_str(), "rb");
+    if (!input)
+        return -1;
+
+    std::vector<char> source;
+    char buffer[64 * 1024];
+    size_t readBytes;
+    while ((readBytes = fread(buffer, 1, sizeof(buffer), input)) > 0)
+        source.insert(source.end(), buffer, buffer + readBytes);
+    fclose(input);
+
+    if (source.size() < sizeof(map_fileheader))
+        return -1;
+
+    map_fileheader header = *reinterpret_cast<map_fileheader const*>(&source[0]);
+    if (header.mapMagic != *(uint32 const*)MAP_MAGIC)
+        return -1;
+
+    if (header.versionMagic == *(uint32 const*)MAP_MAPPED_VERSION_MAGIC)
+        return 0;
+
+    if (header.versionMagic != *(uint32 const*)MAP_VERSION_MAGIC)
+        return -1;
+
+    MappedMapWriter writer(source);
+    writer.Output().resize(sizeof(map_fileheader), 0);
+    writer.Align();
+
+    map_fileheader mapped = header;
+    mapped.versionMagic = *(uint32 const*)MAP_MAPPED_VERSION_MAGIC;
+
+    if (!ConvertMapSection(writer, header.areaMapOffset, mapped.areaMapOffset, mapped.areaMapSize)
+        || !ConvertMapSection(writer, header.heightMapOffset, mapped.heightMapOffset, mapped.heightMapSize)
+        || !ConvertMapSection(writer, header.liquidMapOffset, mapped.liquidMapOffset, mapped.liquidMapSize))
+        return -1;
+
+    if (header.holesOffset)
+    {
+        mapped.holesOffset = writer.Size();
+        if (!writer.Copy(header.holesOffset, header.holesSize))
+            return -1;
+    }
+
+    memcpy(&writer.Output()[0], &mapped, sizeof(mapped));
+
+    // Written next to the source and renamed over it, a server mapping the old file keeps its pages
+    std::string tempName = filename + ".tmp";
+    FILE* output = fopen(tempName.c_str(), "wb");
+    if (!output)
+        return -1;
+
+    bool written = fwrite(&writer.Output()[0], 1, writer.Size(), output) == writer.Size();
+    fclose(output);
+
+    if (!written)
+    {
+        remove(tempName.c_str());
+        return -1;
+    }
+
+#ifdef _WIN32
+    remove(filename.c_str());
+#endif
+    if (rename(tempName.c_str(), filename.c_str()) != 0)
+    {
+        remove(tempName.c_str());
+        return -1;
+    }
+
+    return 1;
+}
+
+void ConvertMapsToMapped()
+{
+    std::string path = output_path;
+    path += "/maps/";
+
+    printf("Converting maps in %s to the memory mapped layout...\n", path.c_str());
+
+    std::vector<std::string> files;
+#ifdef _WIN32
+    _finddata_t findData;
+    intptr_t findHandle = _findfirst((path + "*.map").c_str(), &findData);
+    if (findHandle != -1)
+    {
+        do
+            files.push_back(path + findData.name);
+        while (_findnext(findHandle, &findData) == 0);
+        _findclose(findHandle);
+    }
+#else
+    if (DIR* dir = opendir(path.c_str()))
+    {
+        while (dirent* entry = readdir(dir))
+        {
+            size_t length = strlen(entry->d_name);
+            if (length > 4 && !strcmp(entry->d_name + length - 4, ".map"))
+                files.push_back(path + entry->d_name);
+        }
+        closedir(dir);
+    }
+#endif
+
+    uint32 converted = 0, skipped = 0, failed = 0;
+    for (size_t i = 0; i < files.size(); ++i)
+    {
+        switch (ConvertMapFileToMapped(files[i]))
+        {
+            case 1: ++converted; break;
+            case 0: ++skipped; break;
+            default:
+                printf("Can't convert %s\n", files[i].c_str());
+                ++failed;
+                break;
+        }
+
+        printf("Processing........................%u%%\r", uint32((100 * (i + 1)) / files.size()));
+    }
+
+    printf("\n%u converted, %u already mapped, %u failed\n", converted, skipped, failed);
+}
+
 void ExtractMaps(uint32 build)
 {
     char storagePath[1024];
@@ -1223,6 +1491,12 @@ int main(int argc, char * arg[])
 
     HandleArgs(argc, arg);
 
+    if (CONF_convert_mapped)
+    {
+        ConvertMapsToMapped();
+        return 0;
+    }
+
     int FirstLocale = -1;
     uint32 build = 0;
 